@@ -0,0 +1,153 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file parse_bench.c
+ * @brief Finds the table size at which a threaded lazybiosParseAll() pays off.
+ *
+ * Usage: lazybios_parse_bench [threads [max_structures]]
+ *
+ * Synthetic tables shaped like a large memory partition, mostly Type 17 with
+ * its strings plus Types 18, 19 and 20, are parsed on one thread and on a
+ * pool. The smallest table where the pool wins is the crossover that
+ * LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES should sit above.
+ */
+
+#include "lazybios_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static size_t put_structure(uint8_t* out, uint8_t type, uint8_t length, uint16_t handle, int strings) {
+	memset(out, 0, length);
+	out[0] = type;
+	out[1] = length;
+	out[2] = (uint8_t)handle;
+	out[3] = (uint8_t)(handle >> 8);
+	size_t n = length;
+	if (type == 17) {
+		static const uint8_t slots[] = { 0x10, 0x11, 0x17, 0x18, 0x19, 0x1A };
+		for (size_t i = 0; i < sizeof(slots); i++) out[slots[i]] = (uint8_t)(i + 1);
+		for (int i = 0; i < strings; i++)
+			n += (size_t)sprintf((char*)out + n, "DIMM_%c%u_string%d", 'A' + i, (unsigned)handle, i) + 1;
+	}
+	if (n == length) out[n++] = 0;
+	out[n++] = 0;
+	return n;
+}
+
+// Four of every seven structures are Type 17, the rest split over Types 18 to 20.
+static uint8_t* make_table(size_t structures, size_t* len) {
+	uint8_t* table = malloc(structures * 192 + 8);
+	if (!table) return NULL;
+
+	size_t n = 0;
+	for (size_t i = 0; i < structures; i++) {
+		uint16_t handle = (uint16_t)(i + 1);
+		switch (i % 7) {
+		case 4: n += put_structure(table + n, 18, 0x17, handle, 0); break;
+		case 5: n += put_structure(table + n, 19, 0x1F, handle, 0); break;
+		case 6: n += put_structure(table + n, 20, 0x23, handle, 0); break;
+		default: n += put_structure(table + n, 17, 0x5C, handle, 6); break;
+		}
+	}
+	n += put_structure(table + n, 127, 4, 0xFFFF, 0);
+	*len = n;
+	return table;
+}
+
+static void make_entry(uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH], size_t table_len) {
+	memset(entry, 0, SMBIOS3_ENTRY_POINT_LENGTH);
+	memcpy(entry, SMBIOS3_ANCHOR, SMBIOS3_ANCHOR_SIZE);
+	entry[SMBIOS3_LENGTH_OFFSET] = SMBIOS3_ENTRY_POINT_LENGTH;
+	entry[SMBIOS3_MAJOR_OFFSET] = 3;
+	entry[SMBIOS3_MINOR_OFFSET] = 7;
+	entry[SMBIOS3_REVISION_OFFSET] = 1;
+	for (size_t i = 0; i < 4; i++)
+		entry[SMBIOS3_TABLE_MAX_SIZE_OFFSET + i] = (uint8_t)(table_len >> (8 * i));
+
+	uint8_t sum = 0;
+	for (size_t i = 0; i < SMBIOS3_ENTRY_POINT_LENGTH; i++) sum = (uint8_t)(sum + entry[i]);
+	entry[SMBIOS3_CHECKSUM_OFFSET] = (uint8_t)(-sum);
+}
+
+// Best of several runs, in nanoseconds per lazybiosParseAllThreads() call; only parsing is timed.
+static double time_parse(const uint8_t* entry, const uint8_t* table, size_t table_len, unsigned threads, size_t* count) {
+	double best = 0;
+	for (int run = 0; run < 5; run++) {
+		lazybiosCTX_t* ctx = lazybiosCTXNew();
+		if (!ctx || lazybiosLoadBorrowed(ctx, entry, SMBIOS3_ENTRY_POINT_LENGTH, table, table_len, 0, NULL, NULL) != 0) {
+			lazybiosCleanup(ctx);
+			return -1;
+		}
+
+		double start = now_ns();
+		int rc = lazybiosParseAllThreads(ctx, 0, threads);
+		double elapsed = now_ns() - start;
+		*count = ctx->type17_count;
+		lazybiosCleanup(ctx);
+		if (rc != 0) return -1;
+		if (run == 0 || elapsed < best) best = elapsed;
+	}
+	return best;
+}
+
+int main(int argc, char** argv) {
+	unsigned threads = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 4;
+	size_t max_structures = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 65536;
+	if (threads < 2) threads = 2;
+
+	printf("%u-thread pool against one thread, %u CPUs online\n", threads, lazybiosCPUCount());
+	printf("%10s %12s %12s %8s\n", "structures", "serial us", "parallel us", "speedup");
+
+	size_t crossover = 0;
+	for (size_t structures = 64; structures <= max_structures; structures *= 2) {
+		size_t table_len;
+		uint8_t* table = make_table(structures, &table_len);
+		if (!table) return 1;
+		uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+		make_entry(entry, table_len);
+
+		size_t serial_count = 0;
+		size_t parallel_count = 0;
+		double serial = time_parse(entry, table, table_len, 1, &serial_count);
+		double parallel = time_parse(entry, table, table_len, threads, &parallel_count);
+		free(table);
+		if (serial < 0 || parallel < 0 || serial_count != parallel_count) {
+			fprintf(stderr, "parse failed at %zu structures\n", structures);
+			return 1;
+		}
+
+		printf("%10zu %12.1f %12.1f %7.2fx\n", structures, serial / 1e3, parallel / 1e3, serial / parallel);
+		if (!crossover && parallel < serial) crossover = structures;
+		if (crossover && parallel >= serial) crossover = 0;
+	}
+
+	if (crossover)
+		printf("The pool wins from %zu structures; the threshold is %d\n", crossover, LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES);
+	else
+		printf("The pool never won; the threshold is %d\n", LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES);
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file sysfs_bench.c
+ * @brief Counts the syscalls and time each Linux file loader spends on one table.
+ *
+ * Usage: lazybios_sysfs_bench [entry_path dmi_path [iterations]]
+ *
+ * Paths default to the sysfs tables, which need root; copies of them work
+ * just as well. Syscalls are counted by tracing a child through exactly one
+ * load, minus the tracing's own overhead.
+ */
+
+#include "lazybios_internal.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef int (*load_fn)(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_path);
+
+static int load_nothing(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_path) {
+	(void)ctx;
+	(void)entry_path;
+	(void)dmi_path;
+	return 0;
+}
+
+static const struct {
+	const char* name;
+	load_fn load;
+} loaders[] = {
+	{ "lazybiosFile", lazybiosFile },
+	{ "lazybiosFileMapped", lazybiosFileMapped },
+	{ "lazybiosLinuxSysfs", lazybiosLinuxSysfs },
+};
+
+/*
+ * The child stops itself around one load; the parent counts syscall stops in
+ * between. Each syscall stops twice, on entry and on exit.
+ */
+static long traced_stops(load_fn load, const char* entry_path, const char* dmi_path) {
+	pid_t pid = fork();
+	if (pid < 0) return -1;
+	if (pid == 0) {
+		lazybiosCTX_t* ctx = lazybiosCTXNew();
+		if (!ctx || ptrace(PTRACE_TRACEME, 0, NULL, NULL) != 0) _exit(2);
+		raise(SIGSTOP);
+		int rc = load(ctx, entry_path, dmi_path);
+		raise(SIGSTOP);
+		_exit(rc == 0 ? 0 : 1);
+	}
+
+	int status;
+	if (waitpid(pid, &status, 0) != pid || !WIFSTOPPED(status)) return -1;
+	ptrace(PTRACE_SETOPTIONS, pid, NULL, (void*)(long)PTRACE_O_TRACESYSGOOD);
+
+	long stops = 0;
+	ptrace(PTRACE_SYSCALL, pid, NULL, NULL);
+	while (waitpid(pid, &status, 0) == pid && WIFSTOPPED(status)) {
+		if (WSTOPSIG(status) == SIGSTOP) {
+			kill(pid, SIGKILL);
+			waitpid(pid, &status, 0);
+			return stops;
+		}
+		if (WSTOPSIG(status) == (SIGTRAP | 0x80)) stops++;
+		ptrace(PTRACE_SYSCALL, pid, NULL, NULL);
+	}
+	return -1;
+}
+
+static double load_ns(load_fn load, const char* entry_path, const char* dmi_path, int iterations) {
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (int i = 0; i < iterations; i++) {
+		lazybiosCTX_t* ctx = lazybiosCTXNew();
+		if (!ctx || load(ctx, entry_path, dmi_path) != 0) {
+			lazybiosCleanup(ctx);
+			return -1.0;
+		}
+		lazybiosCleanup(ctx);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	double ns = (double)(end.tv_sec - start.tv_sec) * 1e9 + (double)(end.tv_nsec - start.tv_nsec);
+	return ns / iterations;
+}
+
+int main(int argc, char** argv) {
+	const char* entry_path = argc > 2 ? argv[1] : LINUX_SYSFS_SMBIOS_ENTRY;
+	const char* dmi_path = argc > 2 ? argv[2] : LINUX_SYSFS_DMI_TABLE;
+	int iterations = argc > 3 ? atoi(argv[3]) : 10000;
+	if (iterations <= 0) iterations = 1;
+
+	long baseline = traced_stops(load_nothing, entry_path, dmi_path);
+	if (baseline < 0)
+		fprintf(stderr, "ptrace unavailable; syscall counts are not reported\n");
+
+	printf("%-20s %10s %12s\n", "loader", "syscalls", "ns/load");
+	for (size_t i = 0; i < sizeof(loaders) / sizeof(loaders[0]); i++) {
+		double ns = load_ns(loaders[i].load, entry_path, dmi_path, iterations);
+		if (ns < 0) {
+			printf("%-20s %10s %12s\n", loaders[i].name, "-", "failed");
+			continue;
+		}
+
+		long stops = baseline < 0 ? -1 : traced_stops(loaders[i].load, entry_path, dmi_path);
+		if (stops < 0)
+			printf("%-20s %10s %12.0f\n", loaders[i].name, "-", ns);
+		else
+			printf("%-20s %10ld %12.0f\n", loaders[i].name, (stops - baseline) / 2, ns);
+	}
+	return EXIT_SUCCESS;
+}
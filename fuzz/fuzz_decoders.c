@@ -187,11 +187,11 @@ static void fuzz_buffer_decoders(fuzz_reader_t r, char* buf, size_t buf_len) {
 	type25.next_scheduled_power_on_hour = fuzz_u8(&r);
 	type25.next_scheduled_power_on_minute = fuzz_u8(&r);
 	type25.next_scheduled_power_on_second = fuzz_u8(&r);
-	type25.field_status.next_scheduled_power_on_month = (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT;
-	type25.field_status.next_scheduled_power_on_day = (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT;
-	type25.field_status.next_scheduled_power_on_hour = (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT;
-	type25.field_status.next_scheduled_power_on_minute = (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT;
-	type25.field_status.next_scheduled_power_on_second = (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT;
+	LAZYBIOS_SET_FIELD_STATUS(&type25, next_scheduled_power_on_month, (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT);
+	LAZYBIOS_SET_FIELD_STATUS(&type25, next_scheduled_power_on_day, (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT);
+	LAZYBIOS_SET_FIELD_STATUS(&type25, next_scheduled_power_on_hour, (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT);
+	LAZYBIOS_SET_FIELD_STATUS(&type25, next_scheduled_power_on_minute, (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT);
+	LAZYBIOS_SET_FIELD_STATUS(&type25, next_scheduled_power_on_second, (fuzz_u8(&r) & 1) ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT);
 	lazybiosType25NextScheduledPowerOnStr(&type25, buf, buf_len);
 }
 
@@ -92,12 +92,67 @@ typedef enum {
     LAZYBIOS_FIELD_UNREACHABLE   /**< The field was added in a newer SMBIOS spec; structure is too short to contain it. */
 } lazybiosFieldStatus_t;
 
+/**
+ * @brief Number of 64-bit words holding the statuses of a structure's fields.
+ * @param fields Number of fields with a status.
+ */
+#define LAZYBIOS_FIELD_STATUS_WORDS(fields) (((fields) * 2 + 63) / 64)
+
+/**
+ * @brief Position of a field's status within its structure's status words.
+ *
+ * Each type declares a never-instantiated index struct whose member for the
+ * field at position n is a char array of n + 1 bytes, so the position is a
+ * compile-time constant found through sizeof.
+ */
+#define LAZYBIOS_FIELD_INDEX(structure, field) (sizeof((structure)->field_status.index->field) - 1)
+
+/** @brief Reads the two-bit status at a field position. */
+static inline lazybiosFieldStatus_t lazybiosFieldStatusGet(const uint64_t* bits, size_t index) {
+	return (lazybiosFieldStatus_t)((bits[index / 32] >> (index % 32 * 2)) & 3u);
+}
+
+/** @brief Stores the two-bit status at a field position. */
+static inline void lazybiosFieldStatusSet(uint64_t* bits, size_t index, lazybiosFieldStatus_t status) {
+	const unsigned shift = (unsigned)(index % 32 * 2);
+	bits[index / 32] = (bits[index / 32] & ~(UINT64_C(3) << shift)) | ((uint64_t)status << shift);
+}
+
 /**
  * @brief Returns the status associated with a parsed structure field.
  * @param structure Non-NULL pointer to a parsed SMBIOS structure.
  * @param field Public field name in the parsed structure.
  */
-#define LAZYBIOS_FIELD_STATUS(structure, field) ((structure)->field_status.field)
+#define LAZYBIOS_FIELD_STATUS(structure, field) \
+	lazybiosFieldStatusGet((structure)->field_status.bits, LAZYBIOS_FIELD_INDEX(structure, field))
+
+/**
+ * @brief Sets the status associated with a parsed structure field.
+ * @param structure Non-NULL pointer to a parsed SMBIOS structure.
+ * @param field Public field name in the parsed structure.
+ * @param status New lazybiosFieldStatus_t value.
+ */
+#define LAZYBIOS_SET_FIELD_STATUS(structure, field, status) \
+	lazybiosFieldStatusSet((structure)->field_status.bits, LAZYBIOS_FIELD_INDEX(structure, field), (status))
+
+/**
+ * @brief Tests bit @p row of a column-set presence bitmap, such as
+ *        `lazybiosType17Columns_t::size_present`.
+ */
+#define LAZYBIOS_COLUMN_PRESENT(bitmap, row) (((bitmap)[(row) / 64] >> ((row) % 64)) & 1u)
+
+/**
+ * @brief Read-only view of raw bytes inside the DMI table.
+ *
+ * Like string members, views point into `dmi_data` and are valid only while
+ * the parsed table stays loaded. Use @ref lazybiosBytesCopy to keep the bytes
+ * longer.
+ * @ingroup api_parsing
+ */
+typedef struct {
+	const uint8_t* ptr; /**< First byte, or NULL when the view is empty. */
+	size_t len;         /**< Number of bytes in the view. */
+} lazybiosBytes_t;
 
 /**
  * @brief Raw SMBIOS 2.x entry point layout.
@@ -147,6 +202,48 @@ typedef enum {
 	SMBIOS_VER_3X           /**< The SMBIOS 3.x entry point member is active. */
 } lazybiosSMBIOSVersionTag;
 
+/**
+ * @brief Opaque per-table structure index built when a DMI table is loaded.
+ * @ingroup api_entry
+ */
+typedef struct lazybiosDMIIndex lazybiosDMIIndex_t;
+
+/**
+ * @brief Opaque allocator holding the arrays a context parses for itself.
+ * @ingroup api_parsing
+ */
+typedef struct lazybiosArena lazybiosArena_t;
+
+/**
+ * @brief Allocation hook: returns at least size bytes aligned for any object, or NULL.
+ * @ingroup api_context
+ */
+typedef void* (*lazybiosAllocFn)(size_t size, void* user);
+
+/**
+ * @brief Release hook for memory returned by the matching lazybiosAllocFn; ptr is never NULL.
+ * @ingroup api_context
+ */
+typedef void (*lazybiosFreeFn)(void* ptr, void* user);
+
+/**
+ * @brief Notifies the owner of a borrowed table that the context no longer reads it.
+ * @ingroup api_context
+ */
+typedef void (*lazybiosReleaseFn)(void* user);
+
+/**
+ * @brief Allocation hooks and the user pointer passed to both.
+ *
+ * A zeroed allocator stands for the global hooks in effect at each call.
+ * @ingroup api_context
+ */
+typedef struct {
+	lazybiosAllocFn alloc;
+	lazybiosFreeFn free;
+	void* user;
+} lazybiosAllocator_t;
+
 /**
  * @brief Owns raw DMI table data and its parsed SMBIOS entry point.
  * @ingroup api_entry
@@ -161,6 +258,14 @@ typedef struct lazybiosDMI {
 		lazybiosSMBIOS2Entry* v2;
 		lazybiosSMBIOS3Entry* v3;
 	} entry_union;
+	lazybiosDMIIndex_t* index; /**< Structure index over dmi_data, or NULL when none was built. */
+	lazybiosAllocator_t allocator; /**< Hooks serving the table buffers, the index and the context arena. */
+	void* mapping;                 /**< File mapping dmi_data points into, or NULL when dmi_data is allocated. */
+	size_t mapping_len;            /**< Length of mapping in bytes. */
+	int table_borrowed;            /**< Nonzero when dmi_data is caller memory the context never frees. */
+	int table_in_entry_block;      /**< Nonzero when dmi_data lies in entry_data's allocation, so freeing entry_data releases both. */
+	lazybiosReleaseFn release;     /**< Called by lazybiosCleanup() once a borrowed table is unused, or NULL. */
+	void* release_user;            /**< Argument passed to release. */
 } lazybiosDMI_t;
 
 /**
@@ -399,6 +504,8 @@ struct lazybiosCTX {
     lazybiosOemHpType204_t* HpType204;
     size_t hptype204_count;
 
+	uint64_t parsed_types[4]; /**< Bit n is set once type n has been parsed into the context, even if none was found. */
+	lazybiosArena_t* arena;   /**< Backing store of arrays parsed by the context, or NULL before the first parse. */
 };
 
 /**
@@ -407,6 +514,48 @@ struct lazybiosCTX {
  */
 lazybiosCTX_t* lazybiosCTXNew(void);
 
+/**
+ * @brief Returns a context to its freshly allocated state so it can load another table.
+ *
+ * Everything @ref lazybiosCleanup would release is released, except that the
+ * parse arena keeps its memory for the next table. The allocator hooks and
+ * the backend selection are kept.
+ *
+ * @param ctx Context to reset.
+ * @return 0 on success, or -1 if ctx is NULL.
+ * @ingroup api_context
+ */
+int lazybiosCTXReset(lazybiosCTX_t* ctx);
+
+/**
+ * @brief Routes lazybios allocations through caller-supplied hooks.
+ *
+ * With a NULL context the hooks become the global allocator. It serves new
+ * contexts, the `lazybiosGetType*` getters and `lazybiosFreeType*` functions,
+ * @ref lazybiosBytesCopy, and the cJSON nodes built by the JSON extension.
+ * Install global hooks before lazybios allocates anything, since memory is
+ * always released through the hooks that are current at that time.
+ *
+ * With a context the hooks serve its DMI buffers, structure index and parse
+ * arena. The context must not hold a table yet; the hooks are kept until
+ * @ref lazybiosCleanup.
+ *
+ * Hooks need not be thread-safe. While custom hooks serve a context,
+ * @ref LAZYBIOS_PARSE_PARALLEL parses it on the calling thread, and while
+ * custom global hooks are installed @ref lazybiosBatchLoad runs no workers
+ * of its own. Callers that
+ * use lazybios from several threads of their own must make shared hooks,
+ * global ones in particular, safe for that themselves.
+ *
+ * @param ctx Context to configure, or NULL for the global allocator.
+ * @param alloc Allocation hook, or NULL together with free_fn to restore the default.
+ * @param free_fn Release hook matching alloc.
+ * @param user Pointer passed unchanged to both hooks.
+ * @return 0 on success, or -1 if only one hook is given or the context already holds a table.
+ * @ingroup api_context
+ */
+int lazybiosSetAllocator(lazybiosCTX_t* ctx, lazybiosAllocFn alloc, lazybiosFreeFn free_fn, void* user);
+
 /**
  * @brief Loads SMBIOS data using the context's selected platform backend.
  * @param ctx Context that receives the raw entry point and DMI table data.
@@ -414,6 +563,65 @@ lazybiosCTX_t* lazybiosCTXNew(void);
  */
 int lazybiosInit(lazybiosCTX_t* ctx);
 
+/**
+ * @brief lazybiosInitFlags() flag: load from the cache at @ref LAZYBIOS_CACHE_PATH and refresh it.
+ * @ingroup api_context
+ */
+#define LAZYBIOS_INIT_CACHE 0x1u
+
+/** @brief Format version written by @ref lazybiosCacheStore; other versions are ignored. */
+#define LAZYBIOS_CACHE_VERSION 1u
+/** @brief Directory @ref lazybiosInitFlags creates for its cache. */
+#define LAZYBIOS_CACHE_DIR "/run/lazybios"
+/** @brief Cache file used by @ref LAZYBIOS_INIT_CACHE. */
+#define LAZYBIOS_CACHE_PATH LAZYBIOS_CACHE_DIR "/smbios.cache"
+
+/**
+ * @brief Loads SMBIOS data like @ref lazybiosInit, optionally through the on-disk cache.
+ *
+ * With @ref LAZYBIOS_INIT_CACHE a valid cache is mapped instead of running the
+ * platform backend, so unprivileged processes start from what a privileged one
+ * stored. When the cache is missing or invalid, or its entry point differs
+ * from the one the firmware serves now, the backend loads the table and the
+ * cache is rewritten; failing to write it does not fail the load. Where the
+ * live entry point cannot be read, a valid cache is used as is, relying on
+ * @ref LAZYBIOS_CACHE_DIR being on a tmpfs cleared at boot.
+ *
+ * @param ctx Fresh context that receives the data.
+ * @param flags Zero or more `LAZYBIOS_INIT_*` flags.
+ * @return 0 on success, or -1 on failure.
+ * @ingroup api_context
+ */
+int lazybiosInitFlags(lazybiosCTX_t* ctx, unsigned flags);
+
+/**
+ * @brief Maps a cache written by @ref lazybiosCacheStore into a fresh context.
+ *
+ * The file is checked against its version, its layout and a hash of the entry
+ * point and table it carries, and its structure index is validated against
+ * the table before use. The table and index are read in place from the
+ * mapping, which @ref lazybiosCleanup releases.
+ *
+ * @param ctx Fresh context that receives the data.
+ * @param path Cache file to load.
+ * @return 0 on success, or -1 if the file is missing, stale, or invalid.
+ * @ingroup api_context
+ */
+int lazybiosCacheLoad(lazybiosCTX_t* ctx, const char* path);
+
+/**
+ * @brief Writes a context's entry point, table and structure index to a cache file.
+ *
+ * The file is written next to path and renamed over it once complete, so
+ * concurrent readers see either the old cache or the new one.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @param path Cache file to replace.
+ * @return 0 on success, or -1 on failure.
+ * @ingroup api_context
+ */
+int lazybiosCacheStore(const lazybiosCTX_t* ctx, const char* path);
+
 /**
  * @brief Loads an SMBIOS entry point and DMI table from separate files.
  * @param ctx Context that receives the loaded data.
@@ -432,6 +640,488 @@ int lazybiosFile(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_pat
  */
 int lazybiosSingleFile(lazybiosCTX_t* ctx, const char* bin_path);
 
+/**
+ * @brief Loads from separate files like lazybiosFile(), borrowing the table file's pages.
+ *
+ * The DMI table file is mapped read-only and the context points into the
+ * mapping until @ref lazybiosCleanup unmaps it, so the table is never copied.
+ * Files that cannot be mapped, such as sysfs attributes, are read by
+ * lazybiosFile() instead. The file must not be truncated while mapped.
+ * @param ctx Context that receives the loaded data.
+ * @param entry_path Path to the raw SMBIOS entry point file.
+ * @param dmi_path Path to the raw DMI structure table file.
+ * @return 0 on success, or -1 on failure.
+ */
+int lazybiosFileMapped(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_path);
+
+/**
+ * @brief Loads a merged file like lazybiosSingleFile(), borrowing its pages.
+ *
+ * Only the entry point is copied; the table stays in a read-only mapping of
+ * the file until @ref lazybiosCleanup. Falls back to lazybiosSingleFile()
+ * when the file cannot be mapped.
+ * @param ctx Context that receives the loaded data.
+ * @param bin_path Path to a merged entry point and DMI table file.
+ * @return 0 on success, or -1 on failure.
+ */
+int lazybiosSingleFileMapped(lazybiosCTX_t* ctx, const char* bin_path);
+
+/**
+ * @brief Borrowed-load flag: skip the structure index.
+ *
+ * The index costs a few bytes per structure; without it getters walk the
+ * table, which suits a table parsed once and dropped.
+ * @ingroup api_context
+ */
+#define LAZYBIOS_LOAD_NO_INDEX 0x1u
+
+/**
+ * @brief Loads an entry point and DMI table the caller keeps, without copying the table.
+ *
+ * The context reads @p dmi_data in place from this call until
+ * @ref lazybiosCleanup, which calls @p release, if given, after its last
+ * access. Until then the table must stay valid and unmodified. The entry
+ * point is small and is copied, so it may be discarded on return. If the
+ * load fails the context never took the table and @p release is not called.
+ *
+ * @param ctx Fresh context that receives the data.
+ * @param entry_data SMBIOS 2.x or 3.x entry point.
+ * @param entry_len Length of entry_data in bytes.
+ * @param dmi_data DMI structure table to borrow.
+ * @param dmi_len Length of dmi_data in bytes.
+ * @param flags 0 or @ref LAZYBIOS_LOAD_NO_INDEX.
+ * @param release Optional callback run once the table is no longer used.
+ * @param user Argument passed to release.
+ * @return 0 on success, or -1 on invalid input, unknown flags or a context that already holds a table.
+ * @ingroup api_context
+ */
+int lazybiosLoadBorrowed(lazybiosCTX_t* ctx,
+	const uint8_t* entry_data, size_t entry_len,
+	const uint8_t* dmi_data, size_t dmi_len, unsigned flags,
+	lazybiosReleaseFn release, void* user);
+
+/**
+ * @brief Borrows a table in the Windows raw SMBIOS format, as GetSystemFirmwareTable('RSMB') returns it.
+ *
+ * The table is read in place after the raw header, under the lifetime rules
+ * of @ref lazybiosLoadBorrowed; the implied entry point is built and copied.
+ * @param ctx Fresh context that receives the data.
+ * @param raw_data Raw SMBIOS data header followed by the table.
+ * @param raw_len Length of raw_data in bytes.
+ * @param flags 0 or @ref LAZYBIOS_LOAD_NO_INDEX.
+ * @param release Optional callback run once the table is no longer used.
+ * @param user Argument passed to release.
+ * @return 0 on success, or -1 on failure.
+ * @ingroup api_context
+ */
+int lazybiosLoadWindowsRawBorrowed(lazybiosCTX_t* ctx,
+	const uint8_t* raw_data, size_t raw_len, unsigned flags,
+	lazybiosReleaseFn release, void* user);
+
+/**
+ * @brief lazybiosParseAll() flag: also decode the vendor-specific types lazybios knows.
+ *
+ * OEM type numbers are only meaningful on the vendor's own firmware, so the
+ * Dell and HP decoders run only when the caller asks for them.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_PARSE_OEM 0x1u
+
+/**
+ * @brief lazybiosParseAll() flag: decode large tables on a small thread pool.
+ *
+ * Tables with at least @ref LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES structures
+ * to decode are split by type and index range across up to one thread per
+ * CPU, at most 8. Every record lands in the same array slot as in a
+ * single-threaded parse, so the result is identical. Smaller tables, tables
+ * without a structure index, contexts using custom allocator hooks, and
+ * platforms without threads are parsed on the calling thread.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_PARSE_PARALLEL 0x2u
+
+/**
+ * @brief Fewest structures for which @ref LAZYBIOS_PARSE_PARALLEL starts threads.
+ *
+ * Below it, starting and joining the pool costs more than the decoding it
+ * shares out; `lazybios_parse_bench` measures the crossover.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES 2048
+
+/**
+ * @brief Parses every supported structure type into the context in one table walk.
+ *
+ * Each `ctx->TypeN` array is sized from a single count of the table's types
+ * and filled in table order, exactly as the matching `lazybiosGetTypeN` getter
+ * would fill it. Types whose context array is already set are left untouched,
+ * and types absent from the table keep a NULL array and a zero count.
+ *
+ * The arrays come from the context's arena and are released together by
+ * @ref lazybiosCleanup; do not pass them to the `lazybiosFreeType*` functions.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @param flags Zero or more `LAZYBIOS_PARSE_*` flags.
+ * @return 0 on success, or -1 on failure; the context arrays are unchanged on failure.
+ * @ingroup api_parsing
+ */
+int lazybiosParseAll(lazybiosCTX_t* ctx, unsigned flags);
+
+/**
+ * @brief Returns the parsed array of one SMBIOS type, parsing it on first use.
+ *
+ * The first call for a type parses it into the context member that
+ * `lazybiosGetTypeN` would fill (for example `ctx->Type17`); later calls return
+ * that same array without walking the table again. Members filled earlier by
+ * @ref lazybiosParseAll or by the caller are returned as they are. The arrays
+ * stay owned by the context, live in its arena like those of
+ * @ref lazybiosParseAll, and are released by @ref lazybiosCleanup.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @param type SMBIOS structure type, including the supported OEM types.
+ * @param count Output location for the number of records.
+ * @return The type's records, or NULL with a zero count when the table has none,
+ * the type has no parser, or parsing failed.
+ * @ingroup api_parsing
+ */
+void* lazybiosCTXGetType(lazybiosCTX_t* ctx, uint8_t type, size_t* count);
+
+/**
+ * @brief Copies the bytes of a view for use after the context is cleaned up.
+ * @param bytes View returned in a parsed structure.
+ * @return Copy from the global allocator, to release with its free hook
+ * (free() by default), or NULL if the view is empty or the copy cannot be
+ * allocated.
+ * @ingroup api_parsing
+ */
+uint8_t* lazybiosBytesCopy(lazybiosBytes_t bytes);
+
+/** @addtogroup api_parsing
+ * @{
+ */
+
+/** @name Typed lazybiosCTXGetType() wrappers
+ * @{
+ */
+static inline lazybiosType0_t* lazybiosCTXGetType0(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType0_t*)lazybiosCTXGetType(ctx, 0, count);
+}
+static inline lazybiosType1_t* lazybiosCTXGetType1(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType1_t*)lazybiosCTXGetType(ctx, 1, count);
+}
+static inline lazybiosType2_t* lazybiosCTXGetType2(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType2_t*)lazybiosCTXGetType(ctx, 2, count);
+}
+static inline lazybiosType3_t* lazybiosCTXGetType3(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType3_t*)lazybiosCTXGetType(ctx, 3, count);
+}
+static inline lazybiosType4_t* lazybiosCTXGetType4(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType4_t*)lazybiosCTXGetType(ctx, 4, count);
+}
+static inline lazybiosType5_t* lazybiosCTXGetType5(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType5_t*)lazybiosCTXGetType(ctx, 5, count);
+}
+static inline lazybiosType6_t* lazybiosCTXGetType6(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType6_t*)lazybiosCTXGetType(ctx, 6, count);
+}
+static inline lazybiosType7_t* lazybiosCTXGetType7(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType7_t*)lazybiosCTXGetType(ctx, 7, count);
+}
+static inline lazybiosType8_t* lazybiosCTXGetType8(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType8_t*)lazybiosCTXGetType(ctx, 8, count);
+}
+static inline lazybiosType9_t* lazybiosCTXGetType9(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType9_t*)lazybiosCTXGetType(ctx, 9, count);
+}
+static inline lazybiosType10_t* lazybiosCTXGetType10(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType10_t*)lazybiosCTXGetType(ctx, 10, count);
+}
+static inline lazybiosType11_t* lazybiosCTXGetType11(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType11_t*)lazybiosCTXGetType(ctx, 11, count);
+}
+static inline lazybiosType12_t* lazybiosCTXGetType12(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType12_t*)lazybiosCTXGetType(ctx, 12, count);
+}
+static inline lazybiosType13_t* lazybiosCTXGetType13(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType13_t*)lazybiosCTXGetType(ctx, 13, count);
+}
+static inline lazybiosType14_t* lazybiosCTXGetType14(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType14_t*)lazybiosCTXGetType(ctx, 14, count);
+}
+static inline lazybiosType15_t* lazybiosCTXGetType15(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType15_t*)lazybiosCTXGetType(ctx, 15, count);
+}
+static inline lazybiosType16_t* lazybiosCTXGetType16(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType16_t*)lazybiosCTXGetType(ctx, 16, count);
+}
+static inline lazybiosType17_t* lazybiosCTXGetType17(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType17_t*)lazybiosCTXGetType(ctx, 17, count);
+}
+static inline lazybiosType18_t* lazybiosCTXGetType18(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType18_t*)lazybiosCTXGetType(ctx, 18, count);
+}
+static inline lazybiosType19_t* lazybiosCTXGetType19(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType19_t*)lazybiosCTXGetType(ctx, 19, count);
+}
+static inline lazybiosType20_t* lazybiosCTXGetType20(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType20_t*)lazybiosCTXGetType(ctx, 20, count);
+}
+static inline lazybiosType21_t* lazybiosCTXGetType21(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType21_t*)lazybiosCTXGetType(ctx, 21, count);
+}
+static inline lazybiosType22_t* lazybiosCTXGetType22(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType22_t*)lazybiosCTXGetType(ctx, 22, count);
+}
+static inline lazybiosType23_t* lazybiosCTXGetType23(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType23_t*)lazybiosCTXGetType(ctx, 23, count);
+}
+static inline lazybiosType24_t* lazybiosCTXGetType24(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType24_t*)lazybiosCTXGetType(ctx, 24, count);
+}
+static inline lazybiosType25_t* lazybiosCTXGetType25(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType25_t*)lazybiosCTXGetType(ctx, 25, count);
+}
+static inline lazybiosType26_t* lazybiosCTXGetType26(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType26_t*)lazybiosCTXGetType(ctx, 26, count);
+}
+static inline lazybiosType27_t* lazybiosCTXGetType27(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType27_t*)lazybiosCTXGetType(ctx, 27, count);
+}
+static inline lazybiosType28_t* lazybiosCTXGetType28(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType28_t*)lazybiosCTXGetType(ctx, 28, count);
+}
+static inline lazybiosType29_t* lazybiosCTXGetType29(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType29_t*)lazybiosCTXGetType(ctx, 29, count);
+}
+static inline lazybiosType30_t* lazybiosCTXGetType30(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType30_t*)lazybiosCTXGetType(ctx, 30, count);
+}
+static inline lazybiosType31_t* lazybiosCTXGetType31(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType31_t*)lazybiosCTXGetType(ctx, 31, count);
+}
+static inline lazybiosType32_t* lazybiosCTXGetType32(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType32_t*)lazybiosCTXGetType(ctx, 32, count);
+}
+static inline lazybiosType33_t* lazybiosCTXGetType33(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType33_t*)lazybiosCTXGetType(ctx, 33, count);
+}
+static inline lazybiosType34_t* lazybiosCTXGetType34(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType34_t*)lazybiosCTXGetType(ctx, 34, count);
+}
+static inline lazybiosType35_t* lazybiosCTXGetType35(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType35_t*)lazybiosCTXGetType(ctx, 35, count);
+}
+static inline lazybiosType36_t* lazybiosCTXGetType36(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType36_t*)lazybiosCTXGetType(ctx, 36, count);
+}
+static inline lazybiosType37_t* lazybiosCTXGetType37(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType37_t*)lazybiosCTXGetType(ctx, 37, count);
+}
+static inline lazybiosType38_t* lazybiosCTXGetType38(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType38_t*)lazybiosCTXGetType(ctx, 38, count);
+}
+static inline lazybiosType39_t* lazybiosCTXGetType39(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType39_t*)lazybiosCTXGetType(ctx, 39, count);
+}
+static inline lazybiosType40_t* lazybiosCTXGetType40(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType40_t*)lazybiosCTXGetType(ctx, 40, count);
+}
+static inline lazybiosType41_t* lazybiosCTXGetType41(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType41_t*)lazybiosCTXGetType(ctx, 41, count);
+}
+static inline lazybiosType42_t* lazybiosCTXGetType42(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType42_t*)lazybiosCTXGetType(ctx, 42, count);
+}
+static inline lazybiosType43_t* lazybiosCTXGetType43(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType43_t*)lazybiosCTXGetType(ctx, 43, count);
+}
+static inline lazybiosType44_t* lazybiosCTXGetType44(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType44_t*)lazybiosCTXGetType(ctx, 44, count);
+}
+static inline lazybiosType45_t* lazybiosCTXGetType45(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType45_t*)lazybiosCTXGetType(ctx, 45, count);
+}
+static inline lazybiosType46_t* lazybiosCTXGetType46(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosType46_t*)lazybiosCTXGetType(ctx, 46, count);
+}
+static inline lazybiosOemDellType177_t* lazybiosCTXGetOemDellType177(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosOemDellType177_t*)lazybiosCTXGetType(ctx, 177, count);
+}
+static inline lazybiosOemDellType212_t* lazybiosCTXGetOemDellType212(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosOemDellType212_t*)lazybiosCTXGetType(ctx, 212, count);
+}
+static inline lazybiosOemHpType204_t* lazybiosCTXGetOemHpType204(lazybiosCTX_t* ctx, size_t* count) {
+	return (lazybiosOemHpType204_t*)lazybiosCTXGetType(ctx, 204, count);
+}
+/** @} */
+
+/** @} */
+
+/**
+ * @brief lazybiosIterBegin() filter that visits structures of every type.
+ *
+ * Like the structure index, the walk ends at the end-of-table structure.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_ITER_ALL_TYPES (-1)
+
+/**
+ * @brief Bytes an iterator reserves for the decoded record of its structure.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_ITER_RECORD_SIZE 256
+
+/**
+ * @brief Bytes an iterator reserves for the nested arrays of its record.
+ *
+ * Records whose arrays do not fit, such as a Type 42 with many protocol
+ * records, take the remainder from the context's arena.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_ITER_SCRATCH_SIZE 2048
+
+/**
+ * @brief Walks the structures of a loaded table one at a time.
+ *
+ * An iterator lives wherever the caller puts it, usually on the stack, and
+ * never allocates to advance. The record of the current structure is decoded
+ * only when @ref lazybiosIterRecord asks for it, into storage inside the
+ * iterator. The public members describe the current structure; the rest is
+ * private state.
+ * @ingroup api_parsing
+ */
+typedef struct {
+	const uint8_t* header; /**< Current structure, from its type byte; the string-set follows the formatted area. */
+	size_t size;           /**< Bytes from header through the string-set terminator. */
+	uint8_t type;          /**< SMBIOS structure type. */
+	uint8_t length;        /**< Formatted length, clamped to the table. */
+	uint16_t handle;       /**< Structure handle. */
+
+	lazybiosCTX_t* ctx;
+	int decoded;
+	union { uint64_t words[16]; void* ptr; } cursor;
+	union { uint64_t words[LAZYBIOS_ITER_RECORD_SIZE / 8]; void* ptr; long double ld; } record;
+	union { uint64_t words[LAZYBIOS_ITER_SCRATCH_SIZE / 8]; void* ptr; long double ld; } scratch;
+} lazybiosIter_t;
+
+/**
+ * @brief Positions an iterator before the first structure of a table.
+ *
+ * The iterator walks the structure index when the table has one and follows
+ * the raw table with DMINext() otherwise.
+ *
+ * @param it Iterator to initialize.
+ * @param ctx Context holding a loaded DMI table; it must outlive the iterator.
+ * @param type_filter SMBIOS type to visit, or @ref LAZYBIOS_ITER_ALL_TYPES.
+ * @return 0 on success, or -1 if the context holds no table or the filter is out of range.
+ * @ingroup api_parsing
+ */
+int lazybiosIterBegin(lazybiosIter_t* it, lazybiosCTX_t* ctx, int type_filter);
+
+/**
+ * @brief Advances an iterator to the next matching structure.
+ * @return 1 when the iterator is on a structure, or 0 at the end of the table.
+ * @ingroup api_parsing
+ */
+int lazybiosIterNext(lazybiosIter_t* it);
+
+/**
+ * @brief Decodes the iterator's current structure on first use.
+ *
+ * The record has the type the matching `lazybiosGetTypeN` getter returns,
+ * for example @ref lazybiosType17_t. It stays valid until the iterator moves,
+ * and it needs no release; its strings and byte views point into the table.
+ *
+ * @return The record, or NULL if the type has no decoder or decoding failed.
+ * @ingroup api_parsing
+ */
+const void* lazybiosIterRecord(lazybiosIter_t* it);
+
+/**
+ * @brief Callback for @ref lazybiosForEach.
+ *
+ * @param it Iterator positioned on the structure; its record is already decoded.
+ * @param record Decoded record as from @ref lazybiosIterRecord, or NULL.
+ * @param user Pointer passed to @ref lazybiosForEach.
+ * @return 0 to continue the walk, or non-zero to stop it.
+ * @ingroup api_parsing
+ */
+typedef int (*lazybiosVisitFn)(const lazybiosIter_t* it, const void* record, void* user);
+
+/**
+ * @brief Sets bit @p type in a 256-bit @ref lazybiosForEach type mask.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_TYPE_MASK_SET(mask, type) ((mask)[(uint8_t)(type) >> 6] |= UINT64_C(1) << ((uint8_t)(type) & 63))
+
+/**
+ * @brief Visits the structures of several types in one walk of the table.
+ *
+ * Bit `t % 64` of `type_mask[t / 64]` selects type `t`. Structures are visited
+ * in table order, and each record lives only for its callback, as with
+ * @ref lazybiosIterRecord.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @param type_mask Types to visit, or NULL for every type.
+ * @param callback Function called for each selected structure.
+ * @param user Pointer passed through to @p callback.
+ * @return 0 after the whole table, the callback's value if it stopped the walk,
+ *         or -1 if the context holds no table or @p callback is NULL.
+ * @ingroup api_parsing
+ */
+int lazybiosForEach(lazybiosCTX_t* ctx, const uint64_t type_mask[4], lazybiosVisitFn callback, void* user);
+
+/**
+ * @brief Largest structure, string-set included, a stream can hold.
+ * @ingroup api_parsing
+ */
+#define LAZYBIOS_STREAM_MAX_STRUCTURE 4096
+
+/**
+ * @brief Opaque incremental parser for a DMI table delivered in chunks.
+ * @ingroup api_parsing
+ */
+typedef struct lazybiosStream lazybiosStream_t;
+
+/**
+ * @brief Creates a stream that decodes the table described by an entry point.
+ *
+ * The stream copies the entry point, which supplies the SMBIOS version the
+ * decoders check, and then holds at most one pending structure, so its
+ * memory stays constant however long the table is.
+ *
+ * @param entry SMBIOS 2.x or 3.x entry point.
+ * @param entry_len Bytes available at @p entry.
+ * @param callback Called for each complete structure, as by @ref lazybiosForEach.
+ * @param user Pointer passed through to @p callback.
+ * @return The stream, or NULL if the entry point is invalid, @p callback is NULL
+ *         or allocation fails. Release it with @ref lazybiosStreamFree.
+ * @ingroup api_parsing
+ */
+lazybiosStream_t* lazybiosStreamNew(const uint8_t* entry, size_t entry_len, lazybiosVisitFn callback, void* user);
+
+/**
+ * @brief Feeds the next chunk of the table to a stream.
+ *
+ * Chunks may split a structure anywhere. Each structure is decoded and passed
+ * to the callback as soon as its string-set terminator arrives; its record
+ * lives only for that call. Records whose nested arrays outgrow
+ * @ref LAZYBIOS_ITER_SCRATCH_SIZE are passed as NULL.
+ *
+ * @return 0 when more input is expected, 1 once the end-of-table structure
+ *         arrived or the callback stopped the stream, or -1 if a structure is
+ *         malformed or larger than @ref LAZYBIOS_STREAM_MAX_STRUCTURE.
+ *         A finished or failed stream keeps returning the same value.
+ * @ingroup api_parsing
+ */
+int lazybiosStreamFeed(lazybiosStream_t* stream, const void* bytes, size_t n);
+
+/**
+ * @brief Releases a stream; NULL is ignored.
+ * @ingroup api_parsing
+ */
+void lazybiosStreamFree(lazybiosStream_t* stream);
+
 /**
  * @brief Releases a context and all SMBIOS data owned by it.
  * @param ctx Context to release.
@@ -439,12 +1129,204 @@ int lazybiosSingleFile(lazybiosCTX_t* ctx, const char* bin_path);
  */
 int lazybiosCleanup(lazybiosCTX_t* ctx);
 
+/** @brief Size in bytes of a @ref lazybiosFingerprint result. */
+#define LAZYBIOS_FINGERPRINT_SIZE 32
+
+/**
+ * @brief Hashes a context's entry point and DMI table for change detection.
+ *
+ * The first 16 bytes hash the entry point and table together and the last 16
+ * the entry point alone, which is what @ref lazybiosFingerprintChanged
+ * rechecks. The hash is fast and not cryptographic, and it reads the bytes in
+ * host order, so compare fingerprints taken on the same machine.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @param out Output for LAZYBIOS_FINGERPRINT_SIZE bytes.
+ * @return 0 on success, or -1 if the context holds no table.
+ * @ingroup api_context
+ */
+int lazybiosFingerprint(const lazybiosCTX_t* ctx, uint8_t out[LAZYBIOS_FINGERPRINT_SIZE]);
+
+/**
+ * @brief Cheaply checks whether the host's SMBIOS data differs from a fingerprint.
+ *
+ * On Linux this reads only the sysfs entry point, which carries the table's
+ * address, length and SMBIOS version but nothing of its contents. A return of
+ * 0 therefore only rules out a table that moved, changed size or changed
+ * version. An edit that keeps the length, such as a firmware update that
+ * changes a version string, goes unnoticed. Callers that must catch those
+ * reload and compare the full @ref lazybiosFingerprint.
+ *
+ * @param fingerprint Result of an earlier @ref lazybiosFingerprint.
+ * @return 1 if the data changed, 0 if it did not, or -1 if no cheap check is
+ * available on this platform or the entry point cannot be read.
+ * @ingroup api_context
+ */
+int lazybiosFingerprintChanged(const uint8_t fingerprint[LAZYBIOS_FINGERPRINT_SIZE]);
+
+/**
+ * @brief Frozen, fully parsed SMBIOS data shared by reference count.
+ * @ingroup api_context
+ */
+typedef struct lazybiosSnapshot lazybiosSnapshot_t;
+
+/**
+ * @brief Freezes a loaded context into a snapshot that any number of threads can read.
+ *
+ * Every supported type, OEM types included, is parsed up front as by
+ * @ref lazybiosParseAll, so nothing is decoded or allocated afterwards and
+ * readers need no locks. On success the snapshot owns ctx: do not modify it,
+ * pass it to functions taking a non-const context, or clean it up. The last
+ * @ref lazybiosSnapshotRelease does that.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @return Snapshot holding one reference, or NULL on failure, in which case the caller keeps ctx.
+ * @ingroup api_context
+ */
+lazybiosSnapshot_t* lazybiosSnapshotNew(lazybiosCTX_t* ctx);
+
+/**
+ * @brief Takes another reference to a snapshot; safe from any thread holding one.
+ * @param snapshot Snapshot to retain, or NULL.
+ * @return snapshot, for handing to another owner.
+ * @ingroup api_context
+ */
+lazybiosSnapshot_t* lazybiosSnapshotRetain(lazybiosSnapshot_t* snapshot);
+
+/**
+ * @brief Drops a reference, releasing the snapshot and its context with the last one.
+ * @param snapshot Snapshot to release, or NULL.
+ * @ingroup api_context
+ */
+void lazybiosSnapshotRelease(lazybiosSnapshot_t* snapshot);
+
+/**
+ * @brief Returns the frozen context, whose `TypeN` arrays and table can be read directly.
+ * @param snapshot Snapshot to read.
+ * @return The context, valid while a reference is held, or NULL if snapshot is NULL.
+ * @ingroup api_context
+ */
+const lazybiosCTX_t* lazybiosSnapshotCTX(const lazybiosSnapshot_t* snapshot);
+
+/**
+ * @brief Returns the parsed records of one SMBIOS type, like @ref lazybiosCTXGetType.
+ * @param snapshot Snapshot to read.
+ * @param type SMBIOS structure type, including the supported OEM types.
+ * @param count Output location for the number of records.
+ * @return The type's records, or NULL with a zero count when the snapshot has none.
+ * @ingroup api_context
+ */
+const void* lazybiosSnapshotGetType(const lazybiosSnapshot_t* snapshot, uint8_t type, size_t* count);
+
+/**
+ * @brief Loads a dump in any of the layouts `lazybios_test --dump` and the test corpus use.
+ *
+ * A regular file is read as a merged entry point and table. A directory is
+ * read from its `smbios_entry_point` and `DMI` files, or else from a merged
+ * file named after it, such as `test-7/test-7.bin`. Tables are mapped where
+ * the platform allows it.
+ *
+ * @param ctx Fresh context that receives the data.
+ * @param path Dump file or directory.
+ * @return 0 on success, or -1 if no dump is found or it fails to load.
+ * @ingroup api_context
+ */
+int lazybiosLoadDump(lazybiosCTX_t* ctx, const char* path);
+
+/**
+ * @brief Receives each dump visited by @ref lazybiosBatchLoad.
+ *
+ * Calls come from the worker threads, several at a time. The context is only
+ * valid during the call; it is reset and reused for a later dump afterwards.
+ *
+ * @param ctx Context holding the loaded dump, or NULL if it failed to load.
+ * @param index Position of the dump in the path list.
+ * @param path The dump's path.
+ * @param user Pointer passed to @ref lazybiosBatchLoad.
+ * @return 0 to continue, or non-zero to stop the batch.
+ * @ingroup api_context
+ */
+typedef int (*lazybiosBatchFn)(lazybiosCTX_t* ctx, size_t index, const char* path, void* user);
+
+/**
+ * @brief Loads many dumps on a fixed pool of worker threads.
+ *
+ * Each worker keeps one context for its whole run and loads every dump it
+ * takes with @ref lazybiosLoadDump. Workers start on equal slices of the list
+ * and take from each other's slices once their own runs out, so the order
+ * of callbacks is unspecified. When a callback asks to stop, dumps already
+ * being loaded still finish but no new ones are started.
+ *
+ * Workers allocate through the global hooks. While custom ones are
+ * installed with @ref lazybiosSetAllocator, which need not be thread-safe,
+ * every dump is loaded on the calling thread whatever threads asks for.
+ *
+ * @param paths Dump files or directories.
+ * @param n Number of paths.
+ * @param threads Number of workers, counting the calling thread, or 0 for one per online CPU.
+ * @param callback Called once for every visited dump.
+ * @param user Pointer passed unchanged to callback.
+ * @return 0 once every dump was visited or a callback stopped the batch, or
+ * -1 on invalid arguments or if the workers could not be set up.
+ * @ingroup api_context
+ */
+int lazybiosBatchLoad(const char* const* paths, size_t n, unsigned threads, lazybiosBatchFn callback, void* user);
+
+/**
+ * @brief Loads many local dumps with a fixed number of reads in flight.
+ *
+ * On Linux the statx, open, read and close calls for every dump go through
+ * io_uring, and the calling thread runs the callbacks as dumps complete. The
+ * completed read buffer is borrowed by the context, so tables are not copied.
+ * Where io_uring is unavailable, disabled, or missing an operation, this is
+ * @ref lazybiosBatchLoad with one thread per CPU, and callbacks come from the
+ * worker threads. Dumps are found as by @ref lazybiosLoadDump, and the
+ * callback contract is that of @ref lazybiosBatchLoad.
+ *
+ * @param paths Dump files or directories.
+ * @param n Number of paths.
+ * @param depth Dumps in flight at once, or 0 for 32; ignored by the fallback.
+ * @param callback Called once for every visited dump.
+ * @param user Pointer passed unchanged to callback.
+ * @return 0 once every dump was visited or a callback stopped the load, or -1
+ * on invalid arguments or an I/O setup failure.
+ * @ingroup api_context
+ */
+int lazybiosBulkLoad(const char* const* paths, size_t n, unsigned depth, lazybiosBatchFn callback, void* user);
+
 /**
  * @brief Prints SMBIOS version information to stdout.
  * @param ctx Initialized lazybios context.
  */
 void lazybiosPrintSMVer(const lazybiosCTX_t* ctx);
 
+/**
+ * @brief Describes the SMBIOS structure that carries a handle.
+ * @ingroup api_context
+ */
+typedef struct {
+	uint8_t type;         /**< SMBIOS structure type. */
+	uint8_t length;       /**< Formatted length, clamped to the end of the table. */
+	const uint8_t* raw;   /**< Start of the structure inside the context's DMI table. */
+	const void* record;   /**< Parsed record in the context array for the type, or NULL if it has not been parsed into the context. */
+} lazybiosHandleRef_t;
+
+/**
+ * @brief Looks up the structure that carries an SMBIOS handle.
+ *
+ * Tables loaded by lazybios are indexed by handle, so the lookup takes constant
+ * time; hand-assembled DMI containers without an index are walked instead.
+ * The record member points into the array stored in the context for the
+ * structure's type (for example ctx->Type7 for a cache handle) and can be cast
+ * to that type's record.
+ *
+ * @param ctx Context holding a loaded DMI table.
+ * @param handle Handle to look up, such as lazybiosType4_t::l1_cache_handle.
+ * @param ref Output location for the structure description.
+ * @return 0 on success, or -1 if no structure carries the handle.
+ */
+int lazybiosFindByHandle(const lazybiosCTX_t* ctx, uint16_t handle, lazybiosHandleRef_t* ref);
+
 #endif
 
 #ifdef __cplusplus
@@ -35,9 +35,15 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for DELL OEM SMBIOS Type 177 fields. */
+/** @brief Status positions for DELL OEM SMBIOS Type 177 fields; only their sizes are used. */
 typedef struct {
-    lazybiosFieldStatus_t acpi_wmi_supported;
+    char acpi_wmi_supported[1];
+} lazybiosOemDellType177FieldIndex_t;
+
+/** @brief Availability metadata for DELL OEM SMBIOS Type 177 fields, packed two bits per field. */
+typedef union {
+    uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(1)];
+    const lazybiosOemDellType177FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosOemDellType177FieldStatus_t;
 
 /**
@@ -45,7 +51,7 @@ typedef struct {
  * @ingroup api_dell_type177
  */
 typedef struct {
-
+    uint16_t handle;
     const char* acpi_wmi_supported; //  Yes | No
 	lazybiosOemDellType177FieldStatus_t field_status;
 } lazybiosOemDellType177_t;
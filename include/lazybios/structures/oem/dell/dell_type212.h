@@ -37,15 +37,21 @@ extern "C" {
 
 
 
-/** @brief Availability metadata for DELL OEM SMBIOS Type 212 fields. */
+/** @brief Status positions for DELL OEM SMBIOS Type 212 fields; only their sizes are used. */
 typedef struct {
-    lazybiosFieldStatus_t index_port;
-    lazybiosFieldStatus_t data_port;
-    lazybiosFieldStatus_t checksum_type;
-    lazybiosFieldStatus_t start_index;
-    lazybiosFieldStatus_t end_index;
-    lazybiosFieldStatus_t value_index;
-    lazybiosFieldStatus_t tokens;
+    char index_port[1];
+    char data_port[2];
+    char checksum_type[3];
+    char start_index[4];
+    char end_index[5];
+    char value_index[6];
+    char tokens[7];
+} lazybiosOemDellType212FieldIndex_t;
+
+/** @brief Availability metadata for DELL OEM SMBIOS Type 212 fields, packed two bits per field. */
+typedef union {
+    uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(7)];
+    const lazybiosOemDellType212FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosOemDellType212FieldStatus_t;
 
 typedef struct {
@@ -60,6 +66,7 @@ typedef struct {
  * @ingroup api_dell_type212
  */
 typedef struct {
+    uint16_t handle;
     uint16_t index_port;
     uint16_t data_port;
     const char* checksum_type;
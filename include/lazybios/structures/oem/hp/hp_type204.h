@@ -39,15 +39,21 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for HP OEM SMBIOS Type 204 fields. */
+/** @brief Status positions for HP OEM SMBIOS Type 204 fields; only their sizes are used. */
 typedef struct {
-    lazybiosFieldStatus_t rack_name;
-    lazybiosFieldStatus_t enclosure_name;
-    lazybiosFieldStatus_t enclosure_model;
-    lazybiosFieldStatus_t enclosure_serial;
-    lazybiosFieldStatus_t enclosure_bays;
-    lazybiosFieldStatus_t server_bay;
-    lazybiosFieldStatus_t bays_filled;
+    char rack_name[1];
+    char enclosure_name[2];
+    char enclosure_model[3];
+    char enclosure_serial[4];
+    char enclosure_bays[5];
+    char server_bay[6];
+    char bays_filled[7];
+} lazybiosOemHpType204FieldIndex_t;
+
+/** @brief Availability metadata for HP OEM SMBIOS Type 204 fields, packed two bits per field. */
+typedef union {
+    uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(7)];
+    const lazybiosOemHpType204FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosOemHpType204FieldStatus_t;
 
 /**
@@ -57,6 +63,7 @@ typedef struct {
  * @note Experimental and untested.
  */
 typedef struct {
+    uint16_t handle;
     const char* rack_name;
     const char* enclosure_name;
     const char* enclosure_model;
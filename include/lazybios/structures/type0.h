@@ -35,22 +35,27 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 0 fields. */
+/** @brief Status positions for SMBIOS Type 0 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t vendor;
-	lazybiosFieldStatus_t version;
-	lazybiosFieldStatus_t release_date;
-	lazybiosFieldStatus_t bios_starting_segment;
-	lazybiosFieldStatus_t rom_size;
-	lazybiosFieldStatus_t characteristics;
-	lazybiosFieldStatus_t firmware_char_ext_bytes_count;
-	lazybiosFieldStatus_t firmware_char_ext_bytes;
-	lazybiosFieldStatus_t platform_major_release;
-	lazybiosFieldStatus_t platform_minor_release;
-	lazybiosFieldStatus_t ec_major_release;
-	lazybiosFieldStatus_t ec_minor_release;
-	lazybiosFieldStatus_t extended_rom_size;
-	lazybiosFieldStatus_t unit;
+	char vendor[1];
+	char version[2];
+	char release_date[3];
+	char bios_starting_segment[4];
+	char rom_size[5];
+	char characteristics[6];
+	char firmware_char_ext_bytes[7];
+	char platform_major_release[8];
+	char platform_minor_release[9];
+	char ec_major_release[10];
+	char ec_minor_release[11];
+	char extended_rom_size[12];
+	char unit[13];
+} lazybiosType0FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 0 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(13)];
+	const lazybiosType0FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType0FieldStatus_t;
 
 /**
@@ -58,14 +63,14 @@ typedef struct {
  * @ingroup api_type0
  */
 typedef struct {
+	uint16_t handle;
 	const char* vendor;
 	const char* version;
 	const char* release_date;
 	uint16_t bios_starting_segment;
 	uint32_t rom_size;
 	uint64_t characteristics;
-	size_t firmware_char_ext_bytes_count;
-	uint8_t* firmware_char_ext_bytes;
+	lazybiosBytes_t firmware_char_ext_bytes;
 	uint8_t platform_major_release;
 	uint8_t platform_minor_release;
 	uint8_t ec_major_release;
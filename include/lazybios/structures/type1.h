@@ -35,16 +35,22 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 1 fields. */
+/** @brief Status positions for SMBIOS Type 1 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t product_name;
-	lazybiosFieldStatus_t version;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t uuid;
-	lazybiosFieldStatus_t wake_up_type;
-	lazybiosFieldStatus_t sku_number;
-	lazybiosFieldStatus_t family;
+	char manufacturer[1];
+	char product_name[2];
+	char version[3];
+	char serial_number[4];
+	char uuid[5];
+	char wake_up_type[6];
+	char sku_number[7];
+	char family[8];
+} lazybiosType1FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 1 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(8)];
+	const lazybiosType1FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType1FieldStatus_t;
 
 /**
@@ -52,6 +58,7 @@ typedef struct {
  * @ingroup api_type1
  */
 typedef struct {
+	uint16_t handle;
 	const char* manufacturer;
 	const char* product_name;
 	const char* version;
@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for an obsolete SMBIOS Type 10 device entry. */
+/** @brief Status positions for an obsolete SMBIOS Type 10 device entry; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t device_type_and_status;
-	lazybiosFieldStatus_t description;
+	char device_type_and_status[1];
+	char description[2];
+} lazybiosType10DeviceFieldIndex_t;
+
+/** @brief Availability metadata for an obsolete SMBIOS Type 10 device entry, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType10DeviceFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType10DeviceFieldStatus_t;
 
 /**
@@ -51,10 +57,16 @@ typedef struct {
 	lazybiosType10DeviceFieldStatus_t field_status;
 } lazybiosType10Device_t;
 
-/** @brief Availability metadata for SMBIOS Type 10 fields. */
+/** @brief Status positions for SMBIOS Type 10 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t device_count;
-	lazybiosFieldStatus_t devices;
+	char device_count[1];
+	char devices[2];
+} lazybiosType10FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 10 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType10FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType10FieldStatus_t;
 
 /**
@@ -62,6 +74,7 @@ typedef struct {
  * @ingroup api_type10
  */
 typedef struct {
+	uint16_t handle;
 	size_t device_count;
 	lazybiosType10Device_t* devices;
 	lazybiosType10FieldStatus_t field_status;
@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 11 fields. */
+/** @brief Status positions for SMBIOS Type 11 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t string_count;
-	lazybiosFieldStatus_t strings;
+	char string_count[1];
+	char strings[2];
+} lazybiosType11FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 11 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType11FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType11FieldStatus_t;
 
 /**
@@ -46,6 +52,7 @@ typedef struct {
  * @ingroup api_type11
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t string_count;
 	const char** strings;
 	lazybiosType11FieldStatus_t field_status;
@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 12 fields. */
+/** @brief Status positions for SMBIOS Type 12 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t option_count;
-	lazybiosFieldStatus_t options;
+	char option_count[1];
+	char options[2];
+} lazybiosType12FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 12 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType12FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType12FieldStatus_t;
 
 /**
@@ -46,6 +52,7 @@ typedef struct {
  * @ingroup api_type12
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t option_count;
 	const char** options;
 	lazybiosType12FieldStatus_t field_status;
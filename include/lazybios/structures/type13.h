@@ -35,12 +35,18 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 13 fields. */
+/** @brief Status positions for SMBIOS Type 13 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t installable_languages;
-	lazybiosFieldStatus_t flags;
-	lazybiosFieldStatus_t languages;
-	lazybiosFieldStatus_t current_language;
+	char installable_languages[1];
+	char flags[2];
+	char languages[3];
+	char current_language[4];
+} lazybiosType13FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 13 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(4)];
+	const lazybiosType13FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType13FieldStatus_t;
 
 /**
@@ -48,6 +54,7 @@ typedef struct {
  * @ingroup api_type13
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t installable_languages;
 	uint8_t flags;
 	const char** languages;
@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for an SMBIOS Type 14 group item. */
+/** @brief Status positions for an SMBIOS Type 14 group item; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t item_type;
-	lazybiosFieldStatus_t item_handle;
+	char item_type[1];
+	char item_handle[2];
+} lazybiosType14ItemFieldIndex_t;
+
+/** @brief Availability metadata for an SMBIOS Type 14 group item, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType14ItemFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType14ItemFieldStatus_t;
 
 /**
@@ -51,11 +57,17 @@ typedef struct {
 	lazybiosType14ItemFieldStatus_t field_status;
 } lazybiosType14Item_t;
 
-/** @brief Availability metadata for SMBIOS Type 14 fields. */
+/** @brief Status positions for SMBIOS Type 14 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t group_name;
-	lazybiosFieldStatus_t item_count;
-	lazybiosFieldStatus_t items;
+	char group_name[1];
+	char item_count[2];
+	char items[3];
+} lazybiosType14FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 14 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(3)];
+	const lazybiosType14FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType14FieldStatus_t;
 
 /**
@@ -63,6 +75,7 @@ typedef struct {
  * @ingroup api_type14
  */
 typedef struct {
+	uint16_t handle;
 	const char* group_name;
 	size_t item_count;
 	lazybiosType14Item_t* items;
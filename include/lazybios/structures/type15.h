@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for an SMBIOS Type 15 event-log descriptor. */
+/** @brief Status positions for an SMBIOS Type 15 event-log descriptor; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t log_type;
-	lazybiosFieldStatus_t variable_data_format_type;
+	char log_type[1];
+	char variable_data_format_type[2];
+} lazybiosType15LogTypeDescriptorFieldIndex_t;
+
+/** @brief Availability metadata for an SMBIOS Type 15 event-log descriptor, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType15LogTypeDescriptorFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType15LogTypeDescriptorFieldStatus_t;
 
 /**
@@ -51,19 +57,25 @@ typedef struct {
 	lazybiosType15LogTypeDescriptorFieldStatus_t field_status;
 } lazybiosType15LogTypeDescriptor_t;
 
-/** @brief Availability metadata for SMBIOS Type 15 fields. */
+/** @brief Status positions for SMBIOS Type 15 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t log_area_length;
-	lazybiosFieldStatus_t log_header_start_offset;
-	lazybiosFieldStatus_t log_data_start_offset;
-	lazybiosFieldStatus_t access_method;
-	lazybiosFieldStatus_t log_status;
-	lazybiosFieldStatus_t log_change_token;
-	lazybiosFieldStatus_t access_method_address;
-	lazybiosFieldStatus_t log_header_format;
-	lazybiosFieldStatus_t number_of_supported_log_type_descriptors;
-	lazybiosFieldStatus_t length_of_each_log_type_descriptor;
-	lazybiosFieldStatus_t supported_log_type_descriptors;
+	char log_area_length[1];
+	char log_header_start_offset[2];
+	char log_data_start_offset[3];
+	char access_method[4];
+	char log_status[5];
+	char log_change_token[6];
+	char access_method_address[7];
+	char log_header_format[8];
+	char number_of_supported_log_type_descriptors[9];
+	char length_of_each_log_type_descriptor[10];
+	char supported_log_type_descriptors[11];
+} lazybiosType15FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 15 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(11)];
+	const lazybiosType15FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType15FieldStatus_t;
 
 /**
@@ -71,6 +83,7 @@ typedef struct {
  * @ingroup api_type15
  */
 typedef struct {
+	uint16_t handle;
 	uint16_t log_area_length;
 	uint16_t log_header_start_offset;
 	uint16_t log_data_start_offset;
@@ -35,15 +35,21 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 16 fields. */
+/** @brief Status positions for SMBIOS Type 16 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t location;
-	lazybiosFieldStatus_t use;
-	lazybiosFieldStatus_t memory_error_correction;
-	lazybiosFieldStatus_t maximum_capacity;
-	lazybiosFieldStatus_t memory_error_information_handle;
-	lazybiosFieldStatus_t number_of_memory_devices;
-	lazybiosFieldStatus_t extended_maximum_capacity;
+	char location[1];
+	char use[2];
+	char memory_error_correction[3];
+	char maximum_capacity[4];
+	char memory_error_information_handle[5];
+	char number_of_memory_devices[6];
+	char extended_maximum_capacity[7];
+} lazybiosType16FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 16 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(7)];
+	const lazybiosType16FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType16FieldStatus_t;
 
 /**
@@ -51,6 +57,7 @@ typedef struct {
  * @ingroup api_type16
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t location;
 	uint8_t use;
 	uint8_t memory_error_correction;
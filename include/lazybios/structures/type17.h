@@ -35,47 +35,53 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 17 fields. */
+/** @brief Status positions for SMBIOS Type 17 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t physical_memory_array_handle;
-	lazybiosFieldStatus_t memory_error_information_handle;
-	lazybiosFieldStatus_t total_width;
-	lazybiosFieldStatus_t data_width;
-	lazybiosFieldStatus_t size;
-	lazybiosFieldStatus_t form_factor;
-	lazybiosFieldStatus_t device_set;
-	lazybiosFieldStatus_t device_locator;
-	lazybiosFieldStatus_t bank_locator;
-	lazybiosFieldStatus_t memory_type;
-	lazybiosFieldStatus_t type_detail;
-	lazybiosFieldStatus_t speed;
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t asset_tag;
-	lazybiosFieldStatus_t part_number;
-	lazybiosFieldStatus_t attributes;
-	lazybiosFieldStatus_t extended_size;
-	lazybiosFieldStatus_t configured_memory_speed;
-	lazybiosFieldStatus_t minimum_voltage;
-	lazybiosFieldStatus_t maximum_voltage;
-	lazybiosFieldStatus_t configured_voltage;
-	lazybiosFieldStatus_t memory_technology;
-	lazybiosFieldStatus_t memory_operating_mode_capability;
-	lazybiosFieldStatus_t firmware_version;
-	lazybiosFieldStatus_t module_manufacturer_id;
-	lazybiosFieldStatus_t module_product_id;
-	lazybiosFieldStatus_t memory_subsystem_controller_manufacturer_id;
-	lazybiosFieldStatus_t memory_subsystem_controller_product_id;
-	lazybiosFieldStatus_t non_volatile_size;
-	lazybiosFieldStatus_t volatile_size;
-	lazybiosFieldStatus_t cache_size;
-	lazybiosFieldStatus_t logical_size;
-	lazybiosFieldStatus_t extended_speed;
-	lazybiosFieldStatus_t extended_configured_memory_speed;
-	lazybiosFieldStatus_t pmic0_manufacturer_id;
-	lazybiosFieldStatus_t pmic0_revision_number;
-	lazybiosFieldStatus_t rcd_manufacturer_id;
-	lazybiosFieldStatus_t rcd_revision_number;
+	char physical_memory_array_handle[1];
+	char memory_error_information_handle[2];
+	char total_width[3];
+	char data_width[4];
+	char size[5];
+	char form_factor[6];
+	char device_set[7];
+	char device_locator[8];
+	char bank_locator[9];
+	char memory_type[10];
+	char type_detail[11];
+	char speed[12];
+	char manufacturer[13];
+	char serial_number[14];
+	char asset_tag[15];
+	char part_number[16];
+	char attributes[17];
+	char extended_size[18];
+	char configured_memory_speed[19];
+	char minimum_voltage[20];
+	char maximum_voltage[21];
+	char configured_voltage[22];
+	char memory_technology[23];
+	char memory_operating_mode_capability[24];
+	char firmware_version[25];
+	char module_manufacturer_id[26];
+	char module_product_id[27];
+	char memory_subsystem_controller_manufacturer_id[28];
+	char memory_subsystem_controller_product_id[29];
+	char non_volatile_size[30];
+	char volatile_size[31];
+	char cache_size[32];
+	char logical_size[33];
+	char extended_speed[34];
+	char extended_configured_memory_speed[35];
+	char pmic0_manufacturer_id[36];
+	char pmic0_revision_number[37];
+	char rcd_manufacturer_id[38];
+	char rcd_revision_number[39];
+} lazybiosType17FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 17 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(39)];
+	const lazybiosType17FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType17FieldStatus_t;
 
 /**
@@ -83,6 +89,7 @@ typedef struct {
  * @ingroup api_type17
  */
 typedef struct {
+	uint16_t handle;
 	uint16_t physical_memory_array_handle;
 	uint16_t memory_error_information_handle;
 	uint16_t total_width;
@@ -125,6 +132,38 @@ typedef struct {
 	lazybiosType17FieldStatus_t field_status;
 } lazybiosType17_t;
 
+/**
+ * @brief Selected Type 17 fields of many structures, one array per field.
+ *
+ * Row i of every column comes from the same structure. Bit i of a
+ * `*_present` bitmap (see @ref LAZYBIOS_COLUMN_PRESENT) is set when that
+ * field was @ref LAZYBIOS_FIELD_PRESENT; the value is zero otherwise.
+ * Zero-initialize the set before the first @ref lazybiosColumnsType17.
+ * @ingroup api_type17
+ */
+typedef struct {
+	size_t count;                     /**< Rows in every column. */
+	size_t capacity;                  /**< Rows allocated in every column. */
+	uint32_t* source;                 /**< Zero-based number of the append call that added the row. */
+	uint16_t* handle;
+	uint16_t* size;
+	uint32_t* extended_size;
+	uint16_t* speed;
+	uint16_t* configured_memory_speed;
+	uint8_t* memory_type;
+	uint32_t* manufacturer;           /**< Index into manufacturer_names. */
+	uint64_t* size_present;
+	uint64_t* extended_size_present;
+	uint64_t* speed_present;
+	uint64_t* configured_memory_speed_present;
+	uint64_t* memory_type_present;
+	uint64_t* manufacturer_present;
+	char** manufacturer_names;        /**< Distinct manufacturer strings, copied out of their tables. */
+	size_t manufacturer_name_count;
+	size_t manufacturer_name_capacity;
+	uint32_t appends;                 /**< Successful append calls so far. */
+} lazybiosType17Columns_t;
+
 /** @addtogroup api_type17
  * @{
  */
@@ -163,6 +202,17 @@ void lazybiosType17RCDManufacturerIDStr(uint16_t id, char* buf, size_t buf_len);
 void lazybiosType17RCDRevisionStr(uint16_t revision, char* buf, size_t buf_len);
 /** @brief Releases parsed Type 17 structures. */
 void lazybiosFreeType17(lazybiosType17_t* Type17, size_t type17_count);
+/**
+ * @brief Appends every Type 17 structure of a context to a column set.
+ *
+ * Records are decoded one at a time without building a Type 17 array, and
+ * the set owns all of its memory, so the context may be released afterwards.
+ * @return 0 on success, or -1 if ctx holds no table or allocation fails; the
+ *         set is unchanged on failure.
+ */
+int lazybiosColumnsType17(lazybiosType17Columns_t* columns, lazybiosCTX_t* ctx);
+/** @brief Releases the columns of a set and zeroes it; the struct itself stays with the caller. */
+void lazybiosFreeColumnsType17(lazybiosType17Columns_t* columns);
 
 /** @} */
 
@@ -35,14 +35,20 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 19 fields. */
+/** @brief Status positions for SMBIOS Type 19 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t starting_address;
-	lazybiosFieldStatus_t ending_address;
-	lazybiosFieldStatus_t memory_array_handle;
-	lazybiosFieldStatus_t partition_width;
-	lazybiosFieldStatus_t extended_starting_address;
-	lazybiosFieldStatus_t extended_ending_address;
+	char starting_address[1];
+	char ending_address[2];
+	char memory_array_handle[3];
+	char partition_width[4];
+	char extended_starting_address[5];
+	char extended_ending_address[6];
+} lazybiosType19FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 19 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(6)];
+	const lazybiosType19FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType19FieldStatus_t;
 
 /**
@@ -50,6 +56,7 @@ typedef struct {
  * @ingroup api_type19
  */
 typedef struct {
+	uint16_t handle;
 	uint32_t starting_address;
 	uint32_t ending_address;
 	uint16_t memory_array_handle;
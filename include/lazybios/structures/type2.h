@@ -35,19 +35,25 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 2 fields. */
+/** @brief Status positions for SMBIOS Type 2 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t product;
-	lazybiosFieldStatus_t version;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t asset_tag;
-	lazybiosFieldStatus_t feature_flags;
-	lazybiosFieldStatus_t location_in_chassis;
-	lazybiosFieldStatus_t chassis_handle;
-	lazybiosFieldStatus_t board_type;
-	lazybiosFieldStatus_t number_of_contained_object_handles;
-	lazybiosFieldStatus_t contained_object_handles;
+	char manufacturer[1];
+	char product[2];
+	char version[3];
+	char serial_number[4];
+	char asset_tag[5];
+	char feature_flags[6];
+	char location_in_chassis[7];
+	char chassis_handle[8];
+	char board_type[9];
+	char number_of_contained_object_handles[10];
+	char contained_object_handles[11];
+} lazybiosType2FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 2 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(11)];
+	const lazybiosType2FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType2FieldStatus_t;
 
 /**
@@ -55,6 +61,7 @@ typedef struct {
  * @ingroup api_type2
  */
 typedef struct {
+	uint16_t handle;
 	const char* manufacturer;
 	const char* product;
 	const char* version;
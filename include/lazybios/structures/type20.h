@@ -35,17 +35,23 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 20 fields. */
+/** @brief Status positions for SMBIOS Type 20 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t starting_address;
-	lazybiosFieldStatus_t ending_address;
-	lazybiosFieldStatus_t memory_device_handle;
-	lazybiosFieldStatus_t memory_array_mapped_address_handle;
-	lazybiosFieldStatus_t partition_row_position;
-	lazybiosFieldStatus_t interleave_position;
-	lazybiosFieldStatus_t interleaved_data_depth;
-	lazybiosFieldStatus_t extended_starting_address;
-	lazybiosFieldStatus_t extended_ending_address;
+	char starting_address[1];
+	char ending_address[2];
+	char memory_device_handle[3];
+	char memory_array_mapped_address_handle[4];
+	char partition_row_position[5];
+	char interleave_position[6];
+	char interleaved_data_depth[7];
+	char extended_starting_address[8];
+	char extended_ending_address[9];
+} lazybiosType20FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 20 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(9)];
+	const lazybiosType20FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType20FieldStatus_t;
 
 /**
@@ -53,6 +59,7 @@ typedef struct {
  * @ingroup api_type20
  */
 typedef struct {
+	uint16_t handle;
 	uint32_t starting_address;
 	uint32_t ending_address;
 	uint16_t memory_device_handle;
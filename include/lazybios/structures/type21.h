@@ -35,11 +35,17 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 21 fields. */
+/** @brief Status positions for SMBIOS Type 21 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t pointing_device_type;
-	lazybiosFieldStatus_t interface;
-	lazybiosFieldStatus_t number_of_buttons;
+	char pointing_device_type[1];
+	char interface[2];
+	char number_of_buttons[3];
+} lazybiosType21FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 21 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(3)];
+	const lazybiosType21FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType21FieldStatus_t;
 
 /**
@@ -47,6 +53,7 @@ typedef struct {
  * @ingroup api_type21
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t pointing_device_type;
 	uint8_t interface;
 	uint8_t number_of_buttons;
@@ -35,23 +35,29 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 22 fields. */
+/** @brief Status positions for SMBIOS Type 22 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t location;
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t manufacture_date;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t device_name;
-	lazybiosFieldStatus_t device_chemistry;
-	lazybiosFieldStatus_t design_capacity;
-	lazybiosFieldStatus_t design_voltage;
-	lazybiosFieldStatus_t sbds_version_number;
-	lazybiosFieldStatus_t maximum_error;
-	lazybiosFieldStatus_t sbds_serial_number;
-	lazybiosFieldStatus_t sbds_manufacture_date;
-	lazybiosFieldStatus_t sbds_device_chemistry;
-	lazybiosFieldStatus_t design_capacity_multiplier;
-	lazybiosFieldStatus_t oem_specific;
+	char location[1];
+	char manufacturer[2];
+	char manufacture_date[3];
+	char serial_number[4];
+	char device_name[5];
+	char device_chemistry[6];
+	char design_capacity[7];
+	char design_voltage[8];
+	char sbds_version_number[9];
+	char maximum_error[10];
+	char sbds_serial_number[11];
+	char sbds_manufacture_date[12];
+	char sbds_device_chemistry[13];
+	char design_capacity_multiplier[14];
+	char oem_specific[15];
+} lazybiosType22FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 22 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(15)];
+	const lazybiosType22FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType22FieldStatus_t;
 
 /**
@@ -59,6 +65,7 @@ typedef struct {
  * @ingroup api_type22
  */
 typedef struct {
+	uint16_t handle;
 	const char* location;
 	const char* manufacturer;
 	const char* manufacture_date;
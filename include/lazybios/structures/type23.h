@@ -35,13 +35,19 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 23 fields. */
+/** @brief Status positions for SMBIOS Type 23 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t capabilities;
-	lazybiosFieldStatus_t reset_count;
-	lazybiosFieldStatus_t reset_limit;
-	lazybiosFieldStatus_t timer_interval;
-	lazybiosFieldStatus_t timeout;
+	char capabilities[1];
+	char reset_count[2];
+	char reset_limit[3];
+	char timer_interval[4];
+	char timeout[5];
+} lazybiosType23FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 23 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(5)];
+	const lazybiosType23FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType23FieldStatus_t;
 
 /**
@@ -49,6 +55,7 @@ typedef struct {
  * @ingroup api_type23
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t capabilities;
 	uint16_t reset_count;
 	uint16_t reset_limit;
@@ -35,9 +35,15 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 24 fields. */
+/** @brief Status positions for SMBIOS Type 24 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t hardware_security_settings;
+	char hardware_security_settings[1];
+} lazybiosType24FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 24 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(1)];
+	const lazybiosType24FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType24FieldStatus_t;
 
 /**
@@ -45,6 +51,7 @@ typedef struct {
  * @ingroup api_type24
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t hardware_security_settings;
 	lazybiosType24FieldStatus_t field_status;
 } lazybiosType24_t;
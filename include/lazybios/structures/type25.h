@@ -35,13 +35,19 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 25 fields. */
+/** @brief Status positions for SMBIOS Type 25 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t next_scheduled_power_on_month;
-	lazybiosFieldStatus_t next_scheduled_power_on_day;
-	lazybiosFieldStatus_t next_scheduled_power_on_hour;
-	lazybiosFieldStatus_t next_scheduled_power_on_minute;
-	lazybiosFieldStatus_t next_scheduled_power_on_second;
+	char next_scheduled_power_on_month[1];
+	char next_scheduled_power_on_day[2];
+	char next_scheduled_power_on_hour[3];
+	char next_scheduled_power_on_minute[4];
+	char next_scheduled_power_on_second[5];
+} lazybiosType25FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 25 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(5)];
+	const lazybiosType25FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType25FieldStatus_t;
 
 /**
@@ -49,6 +55,7 @@ typedef struct {
  * @ingroup api_type25
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t next_scheduled_power_on_month;
 	uint8_t next_scheduled_power_on_day;
 	uint8_t next_scheduled_power_on_hour;
@@ -35,17 +35,23 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 26 fields. */
+/** @brief Status positions for SMBIOS Type 26 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t description;
-	lazybiosFieldStatus_t location_and_status;
-	lazybiosFieldStatus_t maximum_value;
-	lazybiosFieldStatus_t minimum_value;
-	lazybiosFieldStatus_t resolution;
-	lazybiosFieldStatus_t tolerance;
-	lazybiosFieldStatus_t accuracy;
-	lazybiosFieldStatus_t oem_defined;
-	lazybiosFieldStatus_t nominal_value;
+	char description[1];
+	char location_and_status[2];
+	char maximum_value[3];
+	char minimum_value[4];
+	char resolution[5];
+	char tolerance[6];
+	char accuracy[7];
+	char oem_defined[8];
+	char nominal_value[9];
+} lazybiosType26FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 26 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(9)];
+	const lazybiosType26FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType26FieldStatus_t;
 
 /**
@@ -53,6 +59,7 @@ typedef struct {
  * @ingroup api_type26
  */
 typedef struct {
+	uint16_t handle;
 	const char* description;
 	uint8_t location_and_status;
 	uint16_t maximum_value;
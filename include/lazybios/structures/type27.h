@@ -35,14 +35,20 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 27 fields. */
+/** @brief Status positions for SMBIOS Type 27 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t temperature_probe_handle;
-	lazybiosFieldStatus_t device_type_and_status;
-	lazybiosFieldStatus_t cooling_unit_group;
-	lazybiosFieldStatus_t oem_defined;
-	lazybiosFieldStatus_t nominal_speed;
-	lazybiosFieldStatus_t description;
+	char temperature_probe_handle[1];
+	char device_type_and_status[2];
+	char cooling_unit_group[3];
+	char oem_defined[4];
+	char nominal_speed[5];
+	char description[6];
+} lazybiosType27FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 27 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(6)];
+	const lazybiosType27FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType27FieldStatus_t;
 
 /**
@@ -50,6 +56,7 @@ typedef struct {
  * @ingroup api_type27
  */
 typedef struct {
+	uint16_t handle;
 	uint16_t temperature_probe_handle;
 	uint8_t device_type_and_status;
 	uint8_t cooling_unit_group;
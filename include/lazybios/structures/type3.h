@@ -35,26 +35,32 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 3 fields. */
+/** @brief Status positions for SMBIOS Type 3 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t type;
-	lazybiosFieldStatus_t version;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t asset_tag;
-	lazybiosFieldStatus_t boot_up_state;
-	lazybiosFieldStatus_t power_supply_state;
-	lazybiosFieldStatus_t thermal_state;
-	lazybiosFieldStatus_t security_status;
-	lazybiosFieldStatus_t oem_defined;
-	lazybiosFieldStatus_t height;
-	lazybiosFieldStatus_t number_of_power_cords;
-	lazybiosFieldStatus_t contained_element_count;
-	lazybiosFieldStatus_t contained_element_record_length;
-	lazybiosFieldStatus_t contained_elements;
-	lazybiosFieldStatus_t sku_number;
-	lazybiosFieldStatus_t rack_type;
-	lazybiosFieldStatus_t rack_height;
+	char manufacturer[1];
+	char type[2];
+	char version[3];
+	char serial_number[4];
+	char asset_tag[5];
+	char boot_up_state[6];
+	char power_supply_state[7];
+	char thermal_state[8];
+	char security_status[9];
+	char oem_defined[10];
+	char height[11];
+	char number_of_power_cords[12];
+	char contained_element_count[13];
+	char contained_element_record_length[14];
+	char contained_elements[15];
+	char sku_number[16];
+	char rack_type[17];
+	char rack_height[18];
+} lazybiosType3FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 3 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(18)];
+	const lazybiosType3FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType3FieldStatus_t;
 
 /**
@@ -62,6 +68,7 @@ typedef struct {
  * @ingroup api_type3
  */
 typedef struct {
+	uint16_t handle;
 	const char* manufacturer;
 	uint8_t type;
 	const char* version;
@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 30 fields. */
+/** @brief Status positions for SMBIOS Type 30 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t manufacturer_name;
-	lazybiosFieldStatus_t connections;
+	char manufacturer_name[1];
+	char connections[2];
+} lazybiosType30FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 30 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType30FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType30FieldStatus_t;
 
 /**
@@ -46,6 +52,7 @@ typedef struct {
  * @ingroup api_type30
  */
 typedef struct {
+	uint16_t handle;
 	const char* manufacturer_name;
 	uint8_t connections;
 	lazybiosType30FieldStatus_t field_status;
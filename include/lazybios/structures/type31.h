@@ -35,16 +35,22 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 31 fields. */
+/** @brief Status positions for SMBIOS Type 31 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t checksum;
-	lazybiosFieldStatus_t reserved_1;
-	lazybiosFieldStatus_t reserved_2;
-	lazybiosFieldStatus_t bis_entry_point_16;
-	lazybiosFieldStatus_t bis_entry_point_32;
-	lazybiosFieldStatus_t reserved_3;
-	lazybiosFieldStatus_t reserved_4;
-	lazybiosFieldStatus_t checksum_valid;
+	char checksum[1];
+	char reserved_1[2];
+	char reserved_2[3];
+	char bis_entry_point_16[4];
+	char bis_entry_point_32[5];
+	char reserved_3[6];
+	char reserved_4[7];
+	char checksum_valid[8];
+} lazybiosType31FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 31 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(8)];
+	const lazybiosType31FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType31FieldStatus_t;
 
 /**
@@ -52,6 +58,7 @@ typedef struct {
  * @ingroup api_type31
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t checksum;
 	uint8_t reserved_1;
 	uint16_t reserved_2;
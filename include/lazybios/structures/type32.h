@@ -35,12 +35,17 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 32 fields. */
+/** @brief Status positions for SMBIOS Type 32 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t reserved;
-	lazybiosFieldStatus_t boot_status;
-	lazybiosFieldStatus_t additional_data_size;
-	lazybiosFieldStatus_t additional_data;
+	char reserved[1];
+	char boot_status[2];
+	char additional_data[3];
+} lazybiosType32FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 32 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(3)];
+	const lazybiosType32FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType32FieldStatus_t;
 
 /**
@@ -48,10 +53,10 @@ typedef struct {
  * @ingroup api_type32
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t reserved[6];
 	uint8_t boot_status;
-	size_t additional_data_size;
-	uint8_t* additional_data;
+	lazybiosBytes_t additional_data;
 	lazybiosType32FieldStatus_t field_status;
 } lazybiosType32_t;
 
@@ -35,15 +35,21 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 33 fields. */
+/** @brief Status positions for SMBIOS Type 33 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t error_type;
-	lazybiosFieldStatus_t error_granularity;
-	lazybiosFieldStatus_t error_operation;
-	lazybiosFieldStatus_t vendor_syndrome;
-	lazybiosFieldStatus_t memory_array_error_address;
-	lazybiosFieldStatus_t device_error_address;
-	lazybiosFieldStatus_t error_resolution;
+	char error_type[1];
+	char error_granularity[2];
+	char error_operation[3];
+	char vendor_syndrome[4];
+	char memory_array_error_address[5];
+	char device_error_address[6];
+	char error_resolution[7];
+} lazybiosType33FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 33 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(7)];
+	const lazybiosType33FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType33FieldStatus_t;
 
 /**
@@ -51,6 +57,7 @@ typedef struct {
  * @ingroup api_type33
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t error_type;
 	uint8_t error_granularity;
 	uint8_t error_operation;
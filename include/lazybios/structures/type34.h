@@ -35,12 +35,18 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 34 fields. */
+/** @brief Status positions for SMBIOS Type 34 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t description;
-	lazybiosFieldStatus_t device_type;
-	lazybiosFieldStatus_t address;
-	lazybiosFieldStatus_t address_type;
+	char description[1];
+	char device_type[2];
+	char address[3];
+	char address_type[4];
+} lazybiosType34FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 34 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(4)];
+	const lazybiosType34FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType34FieldStatus_t;
 
 /**
@@ -48,6 +54,7 @@ typedef struct {
  * @ingroup api_type34
  */
 typedef struct {
+	uint16_t handle;
 	const char* description;
 	uint8_t device_type;
 	uint32_t address;
@@ -35,12 +35,18 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 35 fields. */
+/** @brief Status positions for SMBIOS Type 35 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t description;
-	lazybiosFieldStatus_t management_device_handle;
-	lazybiosFieldStatus_t component_handle;
-	lazybiosFieldStatus_t threshold_handle;
+	char description[1];
+	char management_device_handle[2];
+	char component_handle[3];
+	char threshold_handle[4];
+} lazybiosType35FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 35 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(4)];
+	const lazybiosType35FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType35FieldStatus_t;
 
 /**
@@ -48,6 +54,7 @@ typedef struct {
  * @ingroup api_type35
  */
 typedef struct {
+	uint16_t handle;
 	const char* description;
 	uint16_t management_device_handle;
 	uint16_t component_handle;
@@ -35,14 +35,20 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 36 fields. */
+/** @brief Status positions for SMBIOS Type 36 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t lower_threshold_non_critical;
-	lazybiosFieldStatus_t upper_threshold_non_critical;
-	lazybiosFieldStatus_t lower_threshold_critical;
-	lazybiosFieldStatus_t upper_threshold_critical;
-	lazybiosFieldStatus_t lower_threshold_non_recoverable;
-	lazybiosFieldStatus_t upper_threshold_non_recoverable;
+	char lower_threshold_non_critical[1];
+	char upper_threshold_non_critical[2];
+	char lower_threshold_critical[3];
+	char upper_threshold_critical[4];
+	char lower_threshold_non_recoverable[5];
+	char upper_threshold_non_recoverable[6];
+} lazybiosType36FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 36 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(6)];
+	const lazybiosType36FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType36FieldStatus_t;
 
 /**
@@ -50,6 +56,7 @@ typedef struct {
  * @ingroup api_type36
  */
 typedef struct {
+	uint16_t handle;
 	uint16_t lower_threshold_non_critical;
 	uint16_t upper_threshold_non_critical;
 	uint16_t lower_threshold_critical;
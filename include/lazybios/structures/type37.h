@@ -35,10 +35,16 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for a Type 37 memory-device entry. */
+/** @brief Status positions for a Type 37 memory-device entry; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t load;
-	lazybiosFieldStatus_t handle;
+	char load[1];
+	char handle[2];
+} lazybiosType37MemoryDeviceFieldIndex_t;
+
+/** @brief Availability metadata for a Type 37 memory-device entry, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType37MemoryDeviceFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType37MemoryDeviceFieldStatus_t;
 
 /**
@@ -51,12 +57,18 @@ typedef struct {
 	lazybiosType37MemoryDeviceFieldStatus_t field_status;
 } lazybiosType37MemoryDevice_t;
 
-/** @brief Availability metadata for SMBIOS Type 37 fields. */
+/** @brief Status positions for SMBIOS Type 37 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t channel_type;
-	lazybiosFieldStatus_t maximum_channel_load;
-	lazybiosFieldStatus_t memory_device_count;
-	lazybiosFieldStatus_t memory_devices;
+	char channel_type[1];
+	char maximum_channel_load[2];
+	char memory_device_count[3];
+	char memory_devices[4];
+} lazybiosType37FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 37 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(4)];
+	const lazybiosType37FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType37FieldStatus_t;
 
 /**
@@ -64,6 +76,7 @@ typedef struct {
  * @ingroup api_type37
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t channel_type;
 	uint8_t maximum_channel_load;
 	uint8_t memory_device_count;
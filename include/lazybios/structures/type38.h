@@ -35,15 +35,21 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 38 fields. */
+/** @brief Status positions for SMBIOS Type 38 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t interface_type;
-	lazybiosFieldStatus_t ipmi_specification_revision;
-	lazybiosFieldStatus_t i2c_target_address;
-	lazybiosFieldStatus_t nv_storage_device_address;
-	lazybiosFieldStatus_t base_address;
-	lazybiosFieldStatus_t base_address_modifier_interrupt_info;
-	lazybiosFieldStatus_t interrupt_number;
+	char interface_type[1];
+	char ipmi_specification_revision[2];
+	char i2c_target_address[3];
+	char nv_storage_device_address[4];
+	char base_address[5];
+	char base_address_modifier_interrupt_info[6];
+	char interrupt_number[7];
+} lazybiosType38FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 38 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(7)];
+	const lazybiosType38FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType38FieldStatus_t;
 
 /**
@@ -51,6 +57,7 @@ typedef struct {
  * @ingroup api_type38
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t interface_type;
 	uint8_t ipmi_specification_revision;
 	uint8_t i2c_target_address;
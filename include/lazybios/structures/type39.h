@@ -35,21 +35,27 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 39 fields. */
+/** @brief Status positions for SMBIOS Type 39 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t power_unit_group;
-	lazybiosFieldStatus_t location;
-	lazybiosFieldStatus_t device_name;
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t asset_tag_number;
-	lazybiosFieldStatus_t model_part_number;
-	lazybiosFieldStatus_t revision_level;
-	lazybiosFieldStatus_t max_power_capacity;
-	lazybiosFieldStatus_t power_supply_characteristics;
-	lazybiosFieldStatus_t input_voltage_probe_handle;
-	lazybiosFieldStatus_t cooling_device_handle;
-	lazybiosFieldStatus_t input_current_probe_handle;
+	char power_unit_group[1];
+	char location[2];
+	char device_name[3];
+	char manufacturer[4];
+	char serial_number[5];
+	char asset_tag_number[6];
+	char model_part_number[7];
+	char revision_level[8];
+	char max_power_capacity[9];
+	char power_supply_characteristics[10];
+	char input_voltage_probe_handle[11];
+	char cooling_device_handle[12];
+	char input_current_probe_handle[13];
+} lazybiosType39FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 39 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(13)];
+	const lazybiosType39FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType39FieldStatus_t;
 
 /**
@@ -57,6 +63,7 @@ typedef struct {
  * @ingroup api_type39
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t power_unit_group;
 	const char* location;
 	const char* device_name;
@@ -35,36 +35,42 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 4 fields. */
+/** @brief Status positions for SMBIOS Type 4 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t socket_designation;
-	lazybiosFieldStatus_t processor_type;
-	lazybiosFieldStatus_t processor_family;
-	lazybiosFieldStatus_t processor_manufacturer;
-	lazybiosFieldStatus_t processor_id;
-	lazybiosFieldStatus_t processor_version;
-	lazybiosFieldStatus_t voltage;
-	lazybiosFieldStatus_t external_clock;
-	lazybiosFieldStatus_t max_speed;
-	lazybiosFieldStatus_t current_speed;
-	lazybiosFieldStatus_t status;
-	lazybiosFieldStatus_t processor_upgrade;
-	lazybiosFieldStatus_t l1_cache_handle;
-	lazybiosFieldStatus_t l2_cache_handle;
-	lazybiosFieldStatus_t l3_cache_handle;
-	lazybiosFieldStatus_t serial_number;
-	lazybiosFieldStatus_t asset_tag;
-	lazybiosFieldStatus_t part_number;
-	lazybiosFieldStatus_t core_count;
-	lazybiosFieldStatus_t core_enabled;
-	lazybiosFieldStatus_t thread_count;
-	lazybiosFieldStatus_t processor_characteristics;
-	lazybiosFieldStatus_t processor_family_2;
-	lazybiosFieldStatus_t core_count_2;
-	lazybiosFieldStatus_t core_enabled_2;
-	lazybiosFieldStatus_t thread_count_2;
-	lazybiosFieldStatus_t thread_enabled;
-	lazybiosFieldStatus_t socket_type;
+	char socket_designation[1];
+	char processor_type[2];
+	char processor_family[3];
+	char processor_manufacturer[4];
+	char processor_id[5];
+	char processor_version[6];
+	char voltage[7];
+	char external_clock[8];
+	char max_speed[9];
+	char current_speed[10];
+	char status[11];
+	char processor_upgrade[12];
+	char l1_cache_handle[13];
+	char l2_cache_handle[14];
+	char l3_cache_handle[15];
+	char serial_number[16];
+	char asset_tag[17];
+	char part_number[18];
+	char core_count[19];
+	char core_enabled[20];
+	char thread_count[21];
+	char processor_characteristics[22];
+	char processor_family_2[23];
+	char core_count_2[24];
+	char core_enabled_2[25];
+	char thread_count_2[26];
+	char thread_enabled[27];
+	char socket_type[28];
+} lazybiosType4FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 4 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(28)];
+	const lazybiosType4FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType4FieldStatus_t;
 
 /**
@@ -72,6 +78,7 @@ typedef struct {
  * @ingroup api_type4
  */
 typedef struct {
+	uint16_t handle;
 	const char* socket_designation;
 	uint8_t processor_type;
 	uint8_t processor_family;
@@ -103,6 +110,36 @@ typedef struct {
 	lazybiosType4FieldStatus_t field_status;
 } lazybiosType4_t;
 
+/**
+ * @brief Type 4 core and thread counts of many structures, one array per field.
+ *
+ * Columns hold the raw fields, so a count above 255 is in the `_2` column
+ * while the 8-bit column reads 0xFF. Presence bitmaps and ownership work as
+ * for @ref lazybiosType17Columns_t.
+ * @ingroup api_type4
+ */
+typedef struct {
+	size_t count;                     /**< Rows in every column. */
+	size_t capacity;                  /**< Rows allocated in every column. */
+	uint32_t* source;                 /**< Zero-based number of the append call that added the row. */
+	uint16_t* handle;
+	uint8_t* core_count;
+	uint8_t* core_enabled;
+	uint8_t* thread_count;
+	uint16_t* core_count_2;
+	uint16_t* core_enabled_2;
+	uint16_t* thread_count_2;
+	uint16_t* thread_enabled;
+	uint64_t* core_count_present;
+	uint64_t* core_enabled_present;
+	uint64_t* thread_count_present;
+	uint64_t* core_count_2_present;
+	uint64_t* core_enabled_2_present;
+	uint64_t* thread_count_2_present;
+	uint64_t* thread_enabled_present;
+	uint32_t appends;                 /**< Successful append calls so far. */
+} lazybiosType4Columns_t;
+
 /** @addtogroup api_type4
  * @{
  */
@@ -168,6 +205,21 @@ void lazybiosType4VoltageStr(uint8_t voltage, char* buf, size_t buf_len);
  */
 void lazybiosFreeType4(lazybiosType4_t* Type4, size_t type4_count);
 
+/**
+ * @brief Appends every Type 4 structure of a context to a column set.
+ * @param columns Zero-initialized or previously filled column set.
+ * @param ctx Context holding a loaded DMI table; it may be released afterwards.
+ * @return 0 on success, or -1 if ctx holds no table or allocation fails; the
+ *         set is unchanged on failure.
+ */
+int lazybiosColumnsType4(lazybiosType4Columns_t* columns, lazybiosCTX_t* ctx);
+
+/**
+ * @brief Releases the columns of a set and zeroes it.
+ * @param columns Column set to release; the struct itself stays with the caller.
+ */
+void lazybiosFreeColumnsType4(lazybiosType4Columns_t* columns);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -35,13 +35,19 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for an SMBIOS Type 40 entry. */
+/** @brief Status positions for an SMBIOS Type 40 entry; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t entry_length;
-	lazybiosFieldStatus_t referenced_handle;
-	lazybiosFieldStatus_t referenced_offset;
-	lazybiosFieldStatus_t string;
-	lazybiosFieldStatus_t value;
+	char entry_length[1];
+	char referenced_handle[2];
+	char referenced_offset[3];
+	char string[4];
+	char value[5];
+} lazybiosType40EntryFieldIndex_t;
+
+/** @brief Availability metadata for an SMBIOS Type 40 entry, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(5)];
+	const lazybiosType40EntryFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType40EntryFieldStatus_t;
 
 /**
@@ -53,15 +59,20 @@ typedef struct {
 	uint16_t referenced_handle;
 	uint8_t referenced_offset;
 	const char* string;
-	size_t value_length;
-	uint8_t* value;
+	lazybiosBytes_t value;
 	lazybiosType40EntryFieldStatus_t field_status;
 } lazybiosType40Entry_t;
 
-/** @brief Availability metadata for SMBIOS Type 40 fields. */
+/** @brief Status positions for SMBIOS Type 40 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t additional_information_entry_count;
-	lazybiosFieldStatus_t additional_information_entries;
+	char additional_information_entry_count[1];
+	char additional_information_entries[2];
+} lazybiosType40FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 40 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(2)];
+	const lazybiosType40FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType40FieldStatus_t;
 
 /**
@@ -69,6 +80,7 @@ typedef struct {
  * @ingroup api_type40
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t additional_information_entry_count;
 	lazybiosType40Entry_t* additional_information_entries;
 	lazybiosType40FieldStatus_t field_status;
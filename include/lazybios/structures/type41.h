@@ -35,14 +35,20 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 41 fields. */
+/** @brief Status positions for SMBIOS Type 41 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t reference_designation;
-	lazybiosFieldStatus_t device_type_and_status;
-	lazybiosFieldStatus_t device_type_instance;
-	lazybiosFieldStatus_t segment_group_number;
-	lazybiosFieldStatus_t bus_number;
-	lazybiosFieldStatus_t device_function_number;
+	char reference_designation[1];
+	char device_type_and_status[2];
+	char device_type_instance[3];
+	char segment_group_number[4];
+	char bus_number[5];
+	char device_function_number[6];
+} lazybiosType41FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 41 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(6)];
+	const lazybiosType41FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType41FieldStatus_t;
 
 /**
@@ -50,6 +56,7 @@ typedef struct {
  * @ingroup api_type41
  */
 typedef struct {
+	uint16_t handle;
 	const char* reference_designation;
 	uint8_t device_type_and_status;
 	uint8_t device_type_instance;
@@ -35,11 +35,17 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for an SMBIOS Type 42 protocol record. */
+/** @brief Status positions for an SMBIOS Type 42 protocol record; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t protocol_type;
-	lazybiosFieldStatus_t protocol_type_specific_data_length;
-	lazybiosFieldStatus_t protocol_type_specific_data;
+	char protocol_type[1];
+	char protocol_type_specific_data_length[2];
+	char protocol_type_specific_data[3];
+} lazybiosType42ProtocolRecordFieldIndex_t;
+
+/** @brief Availability metadata for an SMBIOS Type 42 protocol record, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(3)];
+	const lazybiosType42ProtocolRecordFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType42ProtocolRecordFieldStatus_t;
 
 /**
@@ -49,17 +55,23 @@ typedef struct {
 typedef struct {
 	uint8_t protocol_type;
 	uint8_t protocol_type_specific_data_length;
-	uint8_t* protocol_type_specific_data;
+	lazybiosBytes_t protocol_type_specific_data;
 	lazybiosType42ProtocolRecordFieldStatus_t field_status;
 } lazybiosType42ProtocolRecord_t;
 
-/** @brief Availability metadata for SMBIOS Type 42 fields. */
+/** @brief Status positions for SMBIOS Type 42 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t interface_type;
-	lazybiosFieldStatus_t interface_type_specific_data_length;
-	lazybiosFieldStatus_t interface_type_specific_data;
-	lazybiosFieldStatus_t number_of_protocol_records;
-	lazybiosFieldStatus_t protocol_records;
+	char interface_type[1];
+	char interface_type_specific_data_length[2];
+	char interface_type_specific_data[3];
+	char number_of_protocol_records[4];
+	char protocol_records[5];
+} lazybiosType42FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 42 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(5)];
+	const lazybiosType42FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType42FieldStatus_t;
 
 /**
@@ -67,10 +79,10 @@ typedef struct {
  * @ingroup api_type42
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t interface_type;
 	uint8_t interface_type_specific_data_length;
-	size_t interface_type_specific_data_size;
-	uint8_t* interface_type_specific_data;
+	lazybiosBytes_t interface_type_specific_data;
 	uint8_t number_of_protocol_records;
 	lazybiosType42ProtocolRecord_t* protocol_records;
 	lazybiosType42FieldStatus_t field_status;
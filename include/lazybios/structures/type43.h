@@ -35,16 +35,22 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 43 fields. */
+/** @brief Status positions for SMBIOS Type 43 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t vendor_id;
-	lazybiosFieldStatus_t major_spec_version;
-	lazybiosFieldStatus_t minor_spec_version;
-	lazybiosFieldStatus_t firmware_version_1;
-	lazybiosFieldStatus_t firmware_version_2;
-	lazybiosFieldStatus_t description;
-	lazybiosFieldStatus_t characteristics;
-	lazybiosFieldStatus_t oem_defined;
+	char vendor_id[1];
+	char major_spec_version[2];
+	char minor_spec_version[3];
+	char firmware_version_1[4];
+	char firmware_version_2[5];
+	char description[6];
+	char characteristics[7];
+	char oem_defined[8];
+} lazybiosType43FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 43 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(8)];
+	const lazybiosType43FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType43FieldStatus_t;
 
 /**
@@ -52,6 +58,7 @@ typedef struct {
  * @ingroup api_type43
  */
 typedef struct {
+	uint16_t handle;
 	char vendor_id[5];
 	uint8_t major_spec_version;
 	uint8_t minor_spec_version;
@@ -35,12 +35,18 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 44 fields. */
+/** @brief Status positions for SMBIOS Type 44 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t referenced_handle;
-	lazybiosFieldStatus_t block_length;
-	lazybiosFieldStatus_t processor_type;
-	lazybiosFieldStatus_t processor_specific_data;
+	char referenced_handle[1];
+	char block_length[2];
+	char processor_type[3];
+	char processor_specific_data[4];
+} lazybiosType44FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 44 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(4)];
+	const lazybiosType44FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType44FieldStatus_t;
 
 /**
@@ -48,10 +54,11 @@ typedef struct {
  * @ingroup api_type44
  */
 typedef struct {
+	uint16_t handle;
 	uint16_t referenced_handle;
 	uint8_t block_length;
 	uint8_t processor_type;
-	uint8_t* processor_specific_data;
+	lazybiosBytes_t processor_specific_data;
 	lazybiosType44FieldStatus_t field_status;
 } lazybiosType44_t;
 
@@ -35,21 +35,27 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 45 fields. */
+/** @brief Status positions for SMBIOS Type 45 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t firmware_component_name;
-	lazybiosFieldStatus_t firmware_version;
-	lazybiosFieldStatus_t version_format;
-	lazybiosFieldStatus_t firmware_id;
-	lazybiosFieldStatus_t firmware_id_format;
-	lazybiosFieldStatus_t release_date;
-	lazybiosFieldStatus_t manufacturer;
-	lazybiosFieldStatus_t lowest_supported_firmware_version;
-	lazybiosFieldStatus_t image_size;
-	lazybiosFieldStatus_t characteristics;
-	lazybiosFieldStatus_t state;
-	lazybiosFieldStatus_t number_of_associated_components;
-	lazybiosFieldStatus_t associated_component_handles;
+	char firmware_component_name[1];
+	char firmware_version[2];
+	char version_format[3];
+	char firmware_id[4];
+	char firmware_id_format[5];
+	char release_date[6];
+	char manufacturer[7];
+	char lowest_supported_firmware_version[8];
+	char image_size[9];
+	char characteristics[10];
+	char state[11];
+	char number_of_associated_components[12];
+	char associated_component_handles[13];
+} lazybiosType45FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 45 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(13)];
+	const lazybiosType45FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType45FieldStatus_t;
 
 /**
@@ -57,6 +63,7 @@ typedef struct {
  * @ingroup api_type45
  */
 typedef struct {
+	uint16_t handle;
 	const char* firmware_component_name;
 	const char* firmware_version;
 	uint8_t version_format;
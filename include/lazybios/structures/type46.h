@@ -35,11 +35,17 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 46 fields. */
+/** @brief Status positions for SMBIOS Type 46 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t string_property_id;
-	lazybiosFieldStatus_t string_property_value;
-	lazybiosFieldStatus_t parent_handle;
+	char string_property_id[1];
+	char string_property_value[2];
+	char parent_handle[3];
+} lazybiosType46FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 46 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(3)];
+	const lazybiosType46FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType46FieldStatus_t;
 
 /**
@@ -47,6 +53,7 @@ typedef struct {
  * @ingroup api_type46
  */
 typedef struct {
+	uint16_t handle;
 	uint16_t string_property_id;
 	const char* string_property_value;
 	uint16_t parent_handle;
@@ -35,19 +35,25 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 5 fields. */
+/** @brief Status positions for SMBIOS Type 5 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t error_detecting_method;
-	lazybiosFieldStatus_t error_correcting_capability;
-	lazybiosFieldStatus_t supported_interleave;
-	lazybiosFieldStatus_t current_interleave;
-	lazybiosFieldStatus_t maximum_memory_module_size;
-	lazybiosFieldStatus_t supported_speeds;
-	lazybiosFieldStatus_t supported_memory_types;
-	lazybiosFieldStatus_t memory_module_voltage;
-	lazybiosFieldStatus_t number_of_associated_memory_slots;
-	lazybiosFieldStatus_t memory_module_configuration_handles;
-	lazybiosFieldStatus_t enabled_error_correcting_capabilities;
+	char error_detecting_method[1];
+	char error_correcting_capability[2];
+	char supported_interleave[3];
+	char current_interleave[4];
+	char maximum_memory_module_size[5];
+	char supported_speeds[6];
+	char supported_memory_types[7];
+	char memory_module_voltage[8];
+	char number_of_associated_memory_slots[9];
+	char memory_module_configuration_handles[10];
+	char enabled_error_correcting_capabilities[11];
+} lazybiosType5FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 5 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(11)];
+	const lazybiosType5FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType5FieldStatus_t;
 
 /**
@@ -55,6 +61,7 @@ typedef struct {
  * @ingroup api_type5
  */
 typedef struct {
+	uint16_t handle;
 	uint8_t error_detecting_method;
 	uint8_t error_correcting_capability;
 	uint8_t supported_interleave;
@@ -35,15 +35,21 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 6 fields. */
+/** @brief Status positions for SMBIOS Type 6 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t socket_designation;
-	lazybiosFieldStatus_t bank_connections;
-	lazybiosFieldStatus_t current_speed;
-	lazybiosFieldStatus_t current_memory_type;
-	lazybiosFieldStatus_t installed_size;
-	lazybiosFieldStatus_t enabled_size;
-	lazybiosFieldStatus_t error_status;
+	char socket_designation[1];
+	char bank_connections[2];
+	char current_speed[3];
+	char current_memory_type[4];
+	char installed_size[5];
+	char enabled_size[6];
+	char error_status[7];
+} lazybiosType6FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 6 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(7)];
+	const lazybiosType6FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType6FieldStatus_t;
 
 /**
@@ -51,6 +57,7 @@ typedef struct {
  * @ingroup api_type6
  */
 typedef struct {
+	uint16_t handle;
 	const char* socket_designation;
 	uint8_t bank_connections;
 	uint8_t current_speed;
@@ -35,20 +35,26 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 7 fields. */
+/** @brief Status positions for SMBIOS Type 7 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t socket_designation;
-	lazybiosFieldStatus_t cache_configuration;
-	lazybiosFieldStatus_t maximum_cache_size;
-	lazybiosFieldStatus_t installed_size;
-	lazybiosFieldStatus_t supported_sram_type;
-	lazybiosFieldStatus_t current_sram_type;
-	lazybiosFieldStatus_t cache_speed;
-	lazybiosFieldStatus_t error_correction_type;
-	lazybiosFieldStatus_t system_cache_type;
-	lazybiosFieldStatus_t associativity;
-	lazybiosFieldStatus_t maximum_cache_size_2;
-	lazybiosFieldStatus_t installed_cache_size_2;
+	char socket_designation[1];
+	char cache_configuration[2];
+	char maximum_cache_size[3];
+	char installed_size[4];
+	char supported_sram_type[5];
+	char current_sram_type[6];
+	char cache_speed[7];
+	char error_correction_type[8];
+	char system_cache_type[9];
+	char associativity[10];
+	char maximum_cache_size_2[11];
+	char installed_cache_size_2[12];
+} lazybiosType7FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 7 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(12)];
+	const lazybiosType7FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType7FieldStatus_t;
 
 /**
@@ -56,6 +62,7 @@ typedef struct {
  * @ingroup api_type7
  */
 typedef struct {
+	uint16_t handle;
 	const char* socket_designation;
 	uint16_t cache_configuration;
 	uint16_t maximum_cache_size;
@@ -35,13 +35,19 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for SMBIOS Type 8 fields. */
+/** @brief Status positions for SMBIOS Type 8 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t internal_reference_designator;
-	lazybiosFieldStatus_t internal_connector_type;
-	lazybiosFieldStatus_t external_reference_designator;
-	lazybiosFieldStatus_t external_connector_type;
-	lazybiosFieldStatus_t port_type;
+	char internal_reference_designator[1];
+	char internal_connector_type[2];
+	char external_reference_designator[3];
+	char external_connector_type[4];
+	char port_type[5];
+} lazybiosType8FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 8 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(5)];
+	const lazybiosType8FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType8FieldStatus_t;
 
 /**
@@ -49,6 +55,7 @@ typedef struct {
  * @ingroup api_type8
  */
 typedef struct {
+	uint16_t handle;
 	const char* internal_reference_designator;
 	uint8_t internal_connector_type;
 	const char* external_reference_designator;
@@ -35,12 +35,18 @@
 extern "C" {
 #endif
 
-/** @brief Availability metadata for a Type 9 peer group. */
+/** @brief Status positions for a Type 9 peer group; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t segment_group_number;
-	lazybiosFieldStatus_t bus_number;
-	lazybiosFieldStatus_t device_function_number;
-	lazybiosFieldStatus_t data_bus_width;
+	char segment_group_number[1];
+	char bus_number[2];
+	char device_function_number[3];
+	char data_bus_width[4];
+} lazybiosType9PeerGroupFieldIndex_t;
+
+/** @brief Availability metadata for a Type 9 peer group, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(4)];
+	const lazybiosType9PeerGroupFieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType9PeerGroupFieldStatus_t;
 
 /**
@@ -55,26 +61,32 @@ typedef struct {
 	lazybiosType9PeerGroupFieldStatus_t field_status;
 } lazybiosType9PeerGroup_t;
 
-/** @brief Availability metadata for SMBIOS Type 9 fields. */
+/** @brief Status positions for SMBIOS Type 9 fields; only their sizes are used. */
 typedef struct {
-	lazybiosFieldStatus_t slot_designation;
-	lazybiosFieldStatus_t slot_type;
-	lazybiosFieldStatus_t slot_data_bus_width;
-	lazybiosFieldStatus_t current_usage;
-	lazybiosFieldStatus_t slot_length;
-	lazybiosFieldStatus_t slot_id;
-	lazybiosFieldStatus_t slot_characteristics_1;
-	lazybiosFieldStatus_t slot_characteristics_2;
-	lazybiosFieldStatus_t segment_group_number;
-	lazybiosFieldStatus_t bus_number;
-	lazybiosFieldStatus_t device_function_number;
-	lazybiosFieldStatus_t data_bus_width;
-	lazybiosFieldStatus_t peer_grouping_count;
-	lazybiosFieldStatus_t peer_groups;
-	lazybiosFieldStatus_t slot_information;
-	lazybiosFieldStatus_t slot_physical_width;
-	lazybiosFieldStatus_t slot_pitch;
-	lazybiosFieldStatus_t slot_height;
+	char slot_designation[1];
+	char slot_type[2];
+	char slot_data_bus_width[3];
+	char current_usage[4];
+	char slot_length[5];
+	char slot_id[6];
+	char slot_characteristics_1[7];
+	char slot_characteristics_2[8];
+	char segment_group_number[9];
+	char bus_number[10];
+	char device_function_number[11];
+	char data_bus_width[12];
+	char peer_grouping_count[13];
+	char peer_groups[14];
+	char slot_information[15];
+	char slot_physical_width[16];
+	char slot_pitch[17];
+	char slot_height[18];
+} lazybiosType9FieldIndex_t;
+
+/** @brief Availability metadata for SMBIOS Type 9 fields, packed two bits per field. */
+typedef union {
+	uint64_t bits[LAZYBIOS_FIELD_STATUS_WORDS(18)];
+	const lazybiosType9FieldIndex_t* index; /**< Never set; names the field positions. */
 } lazybiosType9FieldStatus_t;
 
 /**
@@ -82,6 +94,7 @@ typedef struct {
  * @ingroup api_type9
  */
 typedef struct {
+	uint16_t handle;
 	const char* slot_designation;
 	uint8_t slot_type;
 	uint8_t slot_data_bus_width;
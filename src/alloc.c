@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file alloc.c
+ * @brief Routes lazybios and cJSON allocations through replaceable hooks.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include "lazybios/json/cJSON.h"
+#include <stdlib.h>
+#include <string.h>
+
+static void* stdlib_alloc(size_t size, void* user) {
+	(void)user;
+	return malloc(size);
+}
+
+static void stdlib_free(void* ptr, void* user) {
+	(void)user;
+	free(ptr);
+}
+
+static lazybiosAllocator_t global_allocator = { stdlib_alloc, stdlib_free, NULL };
+
+static const lazybiosAllocator_t* resolve(const lazybiosAllocator_t* allocator) {
+	return allocator && allocator->alloc ? allocator : &global_allocator;
+}
+
+// The default hooks keep calloc() and realloc(), which can skip the memset and copy.
+static int is_stdlib(const lazybiosAllocator_t* allocator) {
+	return allocator->alloc == stdlib_alloc;
+}
+
+void* lazybiosAllocatorMalloc(const lazybiosAllocator_t* allocator, size_t size) {
+	allocator = resolve(allocator);
+	return allocator->alloc(size, allocator->user);
+}
+
+void* lazybiosAllocatorCalloc(const lazybiosAllocator_t* allocator, size_t count, size_t size) {
+	allocator = resolve(allocator);
+	if (is_stdlib(allocator)) return calloc(count, size);
+	if (size && count > SIZE_MAX / size) return NULL;
+
+	void* ptr = allocator->alloc(count * size, allocator->user);
+	if (ptr) memset(ptr, 0, count * size);
+	return ptr;
+}
+
+void* lazybiosAllocatorRealloc(const lazybiosAllocator_t* allocator, void* ptr, size_t old_size, size_t new_size) {
+	allocator = resolve(allocator);
+	if (is_stdlib(allocator)) return realloc(ptr, new_size);
+
+	void* grown = allocator->alloc(new_size, allocator->user);
+	if (!grown) return NULL;
+	if (ptr) {
+		memcpy(grown, ptr, old_size < new_size ? old_size : new_size);
+		allocator->free(ptr, allocator->user);
+	}
+	return grown;
+}
+
+void lazybiosAllocatorFree(const lazybiosAllocator_t* allocator, void* ptr) {
+	if (!ptr) return;
+	allocator = resolve(allocator);
+	allocator->free(ptr, allocator->user);
+}
+
+int lazybiosAllocatorIsDefault(const lazybiosAllocator_t* allocator) {
+	return is_stdlib(resolve(allocator));
+}
+
+lazybiosAllocator_t lazybiosGlobalAllocator(void) {
+	return global_allocator;
+}
+
+// cJSON hooks carry no user pointer, so they read the global allocator on every call.
+static void* CJSON_CDECL cjson_alloc(size_t size) {
+	return lazybiosAllocatorMalloc(NULL, size);
+}
+
+static void CJSON_CDECL cjson_free(void* ptr) {
+	lazybiosAllocatorFree(NULL, ptr);
+}
+
+int lazybiosSetAllocator(lazybiosCTX_t* ctx, lazybiosAllocFn alloc, lazybiosFreeFn free_fn, void* user) {
+	if (!alloc != !free_fn) return -1;
+
+	lazybiosAllocator_t allocator = { stdlib_alloc, stdlib_free, NULL };
+	if (alloc) {
+		allocator.alloc = alloc;
+		allocator.free = free_fn;
+		allocator.user = user;
+	}
+
+	if (!ctx) {
+		global_allocator = allocator;
+		cJSON_Hooks hooks = { cjson_alloc, cjson_free };
+		cJSON_InitHooks(alloc ? &hooks : NULL);
+		return 0;
+	}
+
+	if (!ctx->DMIData) return -1;
+	if (ctx->DMIData->dmi_data || ctx->DMIData->entry_data || ctx->DMIData->index || ctx->arena) {
+		lb_log("The allocator must be set before the context loads a table");
+		return -1;
+	}
+	// Restoring the default for a context means the global hooks it would have been created with.
+	ctx->DMIData->allocator = alloc ? allocator : global_allocator;
+	return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file arena.c
+ * @brief Bump allocator backing the arrays a context parses for itself.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <string.h>
+
+// Parsed records run a few times larger than the structures they describe.
+#define ARENA_TABLE_FACTOR 4
+#define ARENA_MIN_CHUNK 4096
+
+typedef union {
+	long double ld;
+	uint64_t u64;
+	void* ptr;
+	void (*fn)(void);
+} arena_align;
+
+#define ARENA_ALIGN sizeof(arena_align)
+
+struct lazybiosArenaChunk {
+	struct lazybiosArenaChunk* next;
+	size_t size;
+	size_t used;
+	arena_align data[];
+};
+
+static struct lazybiosArenaChunk* chunk_new(const lazybiosArena_t* arena, size_t size) {
+	if (size > SIZE_MAX - sizeof(struct lazybiosArenaChunk)) return NULL;
+
+	// Chunks start zeroed, and bump allocation never reuses their memory.
+	struct lazybiosArenaChunk* chunk = lazybiosAllocatorCalloc(&arena->allocator, 1, sizeof(*chunk) + size);
+	if (!chunk) return NULL;
+	chunk->size = size;
+	return chunk;
+}
+
+lazybiosArena_t* lazybiosArenaNew(const lazybiosAllocator_t* allocator, size_t table_len) {
+	lazybiosArena_t* arena = lazybiosAllocatorCalloc(allocator, 1, sizeof(*arena));
+	if (!arena) return NULL;
+
+	if (allocator) arena->allocator = *allocator;
+	arena->chunk_size = ARENA_MIN_CHUNK;
+	if (table_len <= SIZE_MAX / ARENA_TABLE_FACTOR && table_len * ARENA_TABLE_FACTOR > arena->chunk_size)
+		arena->chunk_size = table_len * ARENA_TABLE_FACTOR;
+	return arena;
+}
+
+void* lazybiosArenaAlloc(lazybiosArena_t* arena, size_t count, size_t size) {
+	if (!arena || (size && count > SIZE_MAX / size)) return NULL;
+
+	size_t bytes = count * size;
+	if (bytes == 0) bytes = 1;
+	if (bytes > SIZE_MAX - ARENA_ALIGN) return NULL;
+	bytes = (bytes + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+
+	struct lazybiosArenaChunk* chunk = arena->chunks;
+	if (!chunk || chunk->size - chunk->used < bytes) {
+		// Oversized requests get a chunk of their own; the current one stays open.
+		if (bytes > arena->chunk_size / 2 && chunk) {
+			struct lazybiosArenaChunk* big = chunk_new(arena, bytes);
+			if (!big) return NULL;
+			big->used = bytes;
+			big->next = chunk->next;
+			chunk->next = big;
+			return big->data;
+		}
+
+		chunk = chunk_new(arena, bytes > arena->chunk_size ? bytes : arena->chunk_size);
+		if (!chunk) return NULL;
+		chunk->next = arena->chunks;
+		arena->chunks = chunk;
+	}
+
+	void* ptr = (uint8_t*)chunk->data + chunk->used;
+	chunk->used += bytes;
+	return ptr;
+}
+
+int lazybiosArenaOwns(const lazybiosArena_t* arena, const void* ptr) {
+	if (!arena || !ptr) return 0;
+
+	for (const struct lazybiosArenaChunk* chunk = arena->chunks; chunk; chunk = chunk->next) {
+		const uint8_t* begin = (const uint8_t*)chunk->data;
+		if ((const uint8_t*)ptr >= begin && (const uint8_t*)ptr < begin + chunk->size) return 1;
+	}
+	return 0;
+}
+
+void lazybiosArenaReset(lazybiosArena_t* arena) {
+	if (!arena || !arena->chunks) return;
+
+	// Allocation fills the head chunk, so it is the one worth keeping.
+	struct lazybiosArenaChunk* keep = arena->chunks;
+	struct lazybiosArenaChunk* chunk = keep->next;
+	while (chunk) {
+		struct lazybiosArenaChunk* next = chunk->next;
+		lazybiosAllocatorFree(&arena->allocator, chunk);
+		chunk = next;
+	}
+
+	// Allocations promise zeroed memory, so only the bytes handed out need clearing.
+	memset(keep->data, 0, keep->used);
+	keep->used = 0;
+	keep->next = NULL;
+	arena->chunks = keep;
+}
+
+void lazybiosArenaAdopt(lazybiosArena_t* arena, lazybiosArena_t* other) {
+	if (!arena || !other) return;
+
+	struct lazybiosArenaChunk* tail = other->chunks;
+	if (tail) {
+		while (tail->next) tail = tail->next;
+		// Adopted chunks go behind the head, which stays the one being filled.
+		if (arena->chunks) {
+			tail->next = arena->chunks->next;
+			arena->chunks->next = other->chunks;
+		} else {
+			arena->chunks = other->chunks;
+		}
+	}
+	lazybiosAllocatorFree(&other->allocator, other);
+}
+
+void lazybiosArenaFree(lazybiosArena_t* arena) {
+	if (!arena) return;
+
+	struct lazybiosArenaChunk* chunk = arena->chunks;
+	while (chunk) {
+		struct lazybiosArenaChunk* next = chunk->next;
+		lazybiosAllocatorFree(&arena->allocator, chunk);
+		chunk = next;
+	}
+	lazybiosAllocatorFree(&arena->allocator, arena);
+}
+
+static void* scratch_alloc(lazybiosScratch* scratch, size_t count, size_t size) {
+	if (size && count > SIZE_MAX / size) return NULL;
+
+	size_t bytes = count * size;
+	size_t start = (scratch->used + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+	if (start > scratch->size || scratch->size - start < bytes)
+		return lazybiosArenaAlloc(scratch->overflow ? lazybiosCTXArena(scratch->overflow) : NULL, count, size);
+
+	// The buffer is reused for every record, so it is cleared as it is handed out.
+	uint8_t* ptr = scratch->base + start;
+	memset(ptr, 0, bytes);
+	scratch->used = start + (bytes ? bytes : 1);
+	return ptr;
+}
+
+void* lazybiosStructCursorAlloc(const lazybiosStructCursor* cursor, size_t count, size_t size) {
+	if (cursor && cursor->scratch) return scratch_alloc(cursor->scratch, count, size);
+	if (cursor && cursor->arena) return lazybiosArenaAlloc(cursor->arena, count, size);
+	return lazybiosCalloc(count, size);
+}
@@ -30,21 +30,11 @@
 #include <limits.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/mman.h>
+#include <stdint.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
-#define SMBIOS_START 0xF0000
-#define SMBIOS_SIZE 0x10000
-
-static inline int uint64_to_off_t(uint64_t value, off_t *out) {
-	uint64_t off_t_max = ((uint64_t)1 << (sizeof(off_t) * CHAR_BIT - 1)) - 1;
-	if (value > off_t_max)
-		return -1;
-	*out = (off_t)value;
-	return 0;
-}
-
 static inline uint64_t LinuxEFIAddressParser(void) { // Not tested yet, but should work theoretically
     FILE *fp = fopen("/sys/firmware/efi/systab", "r");
     if (!fp) return 0;
@@ -69,157 +59,127 @@ static inline uint64_t LinuxEFIAddressParser(void) { // Not tested yet, but shou
 }
 
 
-static inline int lazybiosDevMem(lazybiosCTX_t *ctx, uint64_t addr) {
-	if (!ctx) return -1;
-
-	int fd = open(DEV_MEM, O_RDONLY);
-	if (fd == -1) {
-		lb_log("Failed to open /dev/mem");
-		lb_dbg("Error: %s", strerror(errno));
-		return -1;
-	}
+// Bytes reserved ahead of the table for the entry point, which sysfs caps well below this.
+#define SYSFS_ENTRY_RESERVE 64
 
-    off_t base_addr;
-    if (addr != 0) { // If we found a valid address, then we use that, if not then we use the old one
-        base_addr = addr;
-    } else {
-        base_addr = SMBIOS_START;
-    }
-
-	long page_size = sysconf(_SC_PAGESIZE);
-	if (page_size <= 0) {
-		lb_log("Failed to read system page size");
-		close(fd);
-		return -1;
-	}
+static int sysfs_open(const char *path) {
+	int fd;
+	do {
+		fd = open(path, O_RDONLY | O_CLOEXEC);
+	} while (fd < 0 && errno == EINTR);
+	return fd;
+}
 
-	off_t aligned_addr = (base_addr / page_size) * page_size;
-	off_t page_offset = base_addr - aligned_addr;
-	size_t page_size_unsigned = (size_t)page_size;
-	size_t page_offset_unsigned = (size_t)page_offset;
+static ssize_t sysfs_pread(int fd, uint8_t *buf, size_t len, off_t offset) {
+	ssize_t n;
+	do {
+		n = pread(fd, buf, len, offset);
+	} while (n < 0 && errno == EINTR);
+	return n;
+}
 
-	// Round map_size up to the nearest page to be safe
-	size_t map_size = SMBIOS_SIZE + page_offset_unsigned;
-	map_size = (map_size + page_size_unsigned - 1) & ~(page_size_unsigned - 1);
+/*
+ * sysfs sizes the DMI attribute to the table, so one fstat sizes a single
+ * buffer that holds the entry point and then the table, and each file takes
+ * one pread. Attributes without a size are left to lazybiosFile().
+ */
+int lazybiosLinuxSysfs(lazybiosCTX_t *ctx, const char *entry_path, const char *dmi_path) {
+	if (!ctx || !ctx->DMIData || !entry_path || !dmi_path) return -1;
 
-	void *mapped_data = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, aligned_addr);
-	if (mapped_data == MAP_FAILED) {
-		lb_log("Failed to mmap /dev/mem data");
-		lb_dbg("Error: %s", strerror(errno));
-		close(fd);
+	int dmi_fd = sysfs_open(dmi_path);
+	if (dmi_fd < 0) {
+		lb_dbg("Failed to open %s: %s", dmi_path, strerror(errno));
 		return -1;
 	}
 
-	unsigned char *smbios_data = (unsigned char *)mapped_data + page_offset;
-
-	size_t sig_offset = 0;
-	size_t entry_len = 0;
-	if (lazybiosFindSMBIOSEntryPoint(
-			smbios_data, SMBIOS_SIZE, &sig_offset, &entry_len) != 0) {
-		lb_log("SMBIOS/DMI signature not found in /dev/mem");
-		munmap(mapped_data, map_size);
-		close(fd);
+	struct stat st;
+	if (fstat(dmi_fd, &st) != 0 || st.st_size <= 0 ||
+		(uintmax_t)st.st_size > SIZE_MAX - SYSFS_ENTRY_RESERVE) {
+		lb_dbg("%s has no usable size", dmi_path);
+		close(dmi_fd);
 		return -1;
 	}
+	size_t table_len = (size_t)st.st_size;
 
-	unsigned char *entry = smbios_data + sig_offset;
-
-	ctx->DMIData->entry_len = entry_len;
-	ctx->DMIData->entry_data = malloc(entry_len);
-	if (!ctx->DMIData->entry_data) {
-		lb_log("Failed to allocate entry_data");
-		munmap(mapped_data, map_size);
-		close(fd);
+	int entry_fd = sysfs_open(entry_path);
+	if (entry_fd < 0) {
+		lb_dbg("Failed to open %s: %s", entry_path, strerror(errno));
+		close(dmi_fd);
 		return -1;
 	}
-	memcpy(ctx->DMIData->entry_data, entry, entry_len);
-
-	if (lazybiosParseEntry(ctx, ctx->DMIData->entry_data, ctx->DMIData->entry_len) != 0) {
-		lb_log("Failed to parse SMBIOS entry point");
-		free(ctx->DMIData->entry_data);
-		ctx->DMIData->entry_data = NULL;
-		munmap(mapped_data, map_size);
-		close(fd);
+
+	uint8_t *buf = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, SYSFS_ENTRY_RESERVE + table_len);
+	if (!buf) {
+		lb_log("Failed to allocate DMI buffer (%zu bytes)", table_len);
+		close(entry_fd);
+		close(dmi_fd);
 		return -1;
 	}
 
-	uint64_t table_addr = 0;
-	size_t table_len = 0;
+	ssize_t entry_len = sysfs_pread(entry_fd, buf, SYSFS_ENTRY_RESERVE, 0);
+	close(entry_fd);
 
-	if (ctx->DMIData->entry_tag == SMBIOS_VER_3X) {
-		table_addr = ctx->DMIData->entry_union.v3->structure_table_address;
-		table_len = ctx->DMIData->entry_union.v3->structure_table_max_size;
-	} else {
-		table_addr = ctx->DMIData->entry_union.v2->structure_table_address;
-		table_len = ctx->DMIData->entry_union.v2->structure_table_length;
+	size_t got = 0;
+	while (got < table_len) {
+		ssize_t n = sysfs_pread(dmi_fd, buf + SYSFS_ENTRY_RESERVE + got, table_len - got, (off_t)got);
+		if (n <= 0) break;
+		got += (size_t)n;
 	}
+	close(dmi_fd);
 
-	munmap(mapped_data, map_size);
-
-	// From this point on, this function was not made all by me
-	off_t table_addr_off = 0;
-	if (uint64_to_off_t(table_addr, &table_addr_off) != 0) {
-		lb_log("SMBIOS table address does not fit in off_t: 0x%016lx", (unsigned long)table_addr);
-		free(ctx->DMIData->entry_data);
-		ctx->DMIData->entry_data = NULL;
-		close(fd);
+	if (entry_len < 20 || got != table_len) {
+		lb_log("Short read from sysfs (entry %zd bytes, table %zu of %zu bytes)", entry_len, got, table_len);
+		lazybiosAllocatorFree(&ctx->DMIData->allocator, buf);
 		return -1;
 	}
 
-	off_t table_aligned = (table_addr_off / page_size) * page_size;
-	off_t table_offset_page = table_addr_off - table_aligned;
-	size_t table_offset_unsigned = (size_t)table_offset_page;
-
-	// We'll calculate map size by rounding up to the nearest page
-	if (table_len > SIZE_MAX - table_offset_unsigned) {
-		lb_log("SMBIOS table mapping size overflow");
-		free(ctx->DMIData->entry_data);
-		ctx->DMIData->entry_data = NULL;
-		close(fd);
-		return -1;
-	}
-	size_t table_map_size = table_len + table_offset_unsigned;
-	table_map_size = (table_map_size + page_size_unsigned - 1) & ~(page_size_unsigned - 1);
-
-	void *mapped_table = mmap(NULL, table_map_size, PROT_READ, MAP_SHARED, fd, table_aligned);
-	if (mapped_table == MAP_FAILED) {
-		lb_log("Failed to mmap DMI/SMBIOS table at 0x%016lx", (unsigned long)table_addr);
-		lb_dbg("Error: %s", strerror(errno));
-		free(ctx->DMIData->entry_data);
-		ctx->DMIData->entry_data = NULL;
-		close(fd);
+	// Both attributes were read into one buffer, the table after the reserved entry-point bytes.
+	if (lazybiosAdoptBuffers(ctx, buf, (size_t)entry_len, buf + SYSFS_ENTRY_RESERVE, table_len, 0) != 0) {
+		lazybiosAllocatorFree(&ctx->DMIData->allocator, buf);
 		return -1;
 	}
+	ctx->DMIData->table_in_entry_block = 1;
+	return 0;
+}
 
-	unsigned char *table_data = (unsigned char *)mapped_table + table_offset_page;
+/*
+ * The entry point is all that is read: it is a few dozen bytes, and sysfs
+ * serves it without touching the table.
+ */
+int lazybiosLinuxEntryChanged(const uint8_t fingerprint[LAZYBIOS_FINGERPRINT_SIZE], const char *entry_path) {
+	if (!fingerprint || !entry_path) return -1;
 
-	// Store table data in context
-	ctx->DMIData->dmi_len = table_len;
-	ctx->DMIData->dmi_data = malloc(table_len);
-	if (!ctx->DMIData->dmi_data) {
-		lb_log("Failed to allocate DMI buffer (%zu bytes)", table_len);
-		munmap(mapped_table, table_map_size);
-		free(ctx->DMIData->entry_data);
-		ctx->DMIData->entry_data = NULL;
-		close(fd);
+	int fd = sysfs_open(entry_path);
+	if (fd < 0) {
+		lb_dbg("Failed to open %s: %s", entry_path, strerror(errno));
 		return -1;
 	}
-	memcpy(ctx->DMIData->dmi_data, table_data, table_len);
 
-	munmap(mapped_table, table_map_size);
+	uint8_t entry[SYSFS_ENTRY_RESERVE];
+	ssize_t entry_len = sysfs_pread(fd, entry, sizeof(entry), 0);
 	close(fd);
+	if (entry_len < 20) return -1;
 
-	return 0;
+	uint8_t current[16];
+	lazybiosFingerprintEntry(entry, (size_t)entry_len, current);
+	return memcmp(current, fingerprint + 16, sizeof(current)) != 0;
 }
 
 int lazybiosLinux(lazybiosCTX_t *ctx) {
 	if (!ctx) return -1;
 
+	if (lazybiosLinuxSysfs(ctx, LINUX_SYSFS_SMBIOS_ENTRY, LINUX_SYSFS_DMI_TABLE) == 0) {
+		return 0;
+	}
+
     if (lazybiosFile(ctx, LINUX_SYSFS_SMBIOS_ENTRY, LINUX_SYSFS_DMI_TABLE) == 0) {
         return 0;
     }
 
-    return lazybiosDevMem(ctx, LinuxEFIAddressParser());
+    // Whatever a failed sysfs load left behind would make the scan refuse the context.
+    lazybiosCTXReset(ctx);
+    uint64_t addr = LinuxEFIAddressParser();
+    return lazybiosLoadPhysicalMemory(ctx, DEV_MEM, addr ? addr : LAZYBIOS_PHYS_SCAN_START);
 }
 
 #endif
@@ -118,19 +118,19 @@ static int load_entry_and_table(lazybiosCTX_t *ctx, int fd, const char *path, co
         return -1;
     }
 
-    table = malloc(table_len);
+    table = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, table_len);
     if (!table) {
         lb_dbg("Failed to allocate %zu bytes for the NetBSD SMBIOS table", table_len);
         return -1;
     }
 
     if (read_device_at(fd, path, table_address, table, table_len) != 0) {
-        free(table);
+        lazybiosAllocatorFree(&ctx->DMIData->allocator, table);
         return -1;
     }
 
     result = lazybiosLoadRawBuffers(ctx, entry, entry_len, table, table_len);
-    free(table);
+    lazybiosAllocatorFree(&ctx->DMIData->allocator, table);
     return result;
 }
 
@@ -169,7 +169,7 @@ static int load_legacy_x86_scan(lazybiosCTX_t *ctx) {
         return -1;
     }
 
-    window = malloc(SMBIOS_LEGACY_SIZE);
+    window = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, SMBIOS_LEGACY_SIZE);
     if (!window) {
         close(fd);
         return -1;
@@ -177,13 +177,13 @@ static int load_legacy_x86_scan(lazybiosCTX_t *ctx) {
 
     if (read_device_at(fd, DEV_MEM, SMBIOS_LEGACY_START, window, SMBIOS_LEGACY_SIZE) != 0 ||
         lazybiosFindSMBIOSEntryPoint(window, SMBIOS_LEGACY_SIZE, &entry_offset, &entry_len) != 0) {
-        free(window);
+        lazybiosAllocatorFree(&ctx->DMIData->allocator, window);
         close(fd);
         return -1;
     }
 
     result = load_entry_and_table(ctx, fd, DEV_MEM, window + entry_offset, entry_len);
-    free(window);
+    lazybiosAllocatorFree(&ctx->DMIData->allocator, window);
     close(fd);
     return result;
 }
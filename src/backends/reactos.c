@@ -40,19 +40,19 @@ int lazybiosReactOS(lazybiosCTX_t *ctx) { // This is how it's supposed to look l
         return -1;
     }
 
-    uint8_t *buf = malloc(size);
+    uint8_t *buf = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, size);
     if (!buf)
         return -1;
 
     DWORD got = GetSystemFirmwareTable(sig, 0, buf, size);
     if (got != size) {
         lb_log("SMBIOS read mismatch (%lu != %lu)", (unsigned long)got, (unsigned long)size);
-        free(buf);
+        lazybiosAllocatorFree(&ctx->DMIData->allocator, buf);
         return -1;
     }
 
     int result = lazybiosLoadWindowsRawSMBIOSData(ctx, buf, size);
-    free(buf);
+    lazybiosAllocatorFree(&ctx->DMIData->allocator, buf);
     return result;
 }
 
@@ -0,0 +1,206 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file batch.c
+ * @brief Loads directories of SMBIOS dumps on a pool of worker threads.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
+#	define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
+#endif
+#if !defined(S_ISDIR) && defined(S_IFMT) && defined(S_IFDIR)
+#	define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
+
+// Keeps the slices workers claim from on separate cache lines.
+#define BATCH_CACHE_LINE 64
+
+static int path_is(const char* path, int directory) {
+	struct stat st;
+	if (stat(path, &st) != 0) return 0;
+	return directory ? S_ISDIR(st.st_mode) : S_ISREG(st.st_mode);
+}
+
+int lazybiosDumpPath(char out[LAZYBIOS_DUMP_PATH_MAX], const char* dir, int file) {
+	if (file == LAZYBIOS_DUMP_ENTRY || file == LAZYBIOS_DUMP_DMI) {
+		int n = snprintf(out, LAZYBIOS_DUMP_PATH_MAX, "%s/%s", dir,
+			file == LAZYBIOS_DUMP_ENTRY ? "smbios_entry_point" : "DMI");
+		return n > 0 && n < LAZYBIOS_DUMP_PATH_MAX ? 0 : -1;
+	}
+
+	// The merged file is named after its directory, so trailing separators are skipped.
+	size_t end = strlen(dir);
+	while (end > 1 && (dir[end - 1] == '/' || dir[end - 1] == '\\')) end--;
+	size_t start = end;
+	while (start > 0 && dir[start - 1] != '/' && dir[start - 1] != '\\') start--;
+
+	int n = snprintf(out, LAZYBIOS_DUMP_PATH_MAX, "%s/%.*s.bin", dir, (int)(end - start), dir + start);
+	return n > 0 && n < LAZYBIOS_DUMP_PATH_MAX ? 0 : -1;
+}
+
+/*
+ * Dumps are laid out the way `lazybios_test --dump` writes them: a directory
+ * holding `smbios_entry_point` and `DMI`, a directory `test-N` holding a
+ * merged `test-N.bin`, or a merged file given directly.
+ */
+int lazybiosLoadDump(lazybiosCTX_t* ctx, const char* path) {
+	if (!ctx || !ctx->DMIData || !path) return -1;
+
+	if (path_is(path, 0)) return lazybiosSingleFileMapped(ctx, path);
+	if (!path_is(path, 1)) {
+		lb_log("No SMBIOS dump at %s", path);
+		return -1;
+	}
+
+	char entry_path[LAZYBIOS_DUMP_PATH_MAX];
+	char dmi_path[LAZYBIOS_DUMP_PATH_MAX];
+	if (lazybiosDumpPath(entry_path, path, LAZYBIOS_DUMP_ENTRY) == 0 &&
+		lazybiosDumpPath(dmi_path, path, LAZYBIOS_DUMP_DMI) == 0 &&
+		path_is(entry_path, 0) && path_is(dmi_path, 0))
+		return lazybiosFileMapped(ctx, entry_path, dmi_path);
+
+	char bin_path[LAZYBIOS_DUMP_PATH_MAX];
+	if (lazybiosDumpPath(bin_path, path, LAZYBIOS_DUMP_BIN) == 0 && path_is(bin_path, 0))
+		return lazybiosSingleFileMapped(ctx, bin_path);
+
+	lb_log("No smbios_entry_point and DMI pair or merged .bin file in %s", path);
+	return -1;
+}
+
+/*
+ * Each worker owns one contiguous slice of the path list and claims from its
+ * front. A worker whose slice runs dry claims from the other slices the same
+ * way, so uneven dumps even out without a shared counter every worker hits.
+ */
+typedef union {
+	struct {
+		volatile size_t next;
+		size_t end;
+	} range;
+	char pad[BATCH_CACHE_LINE];
+} batch_slice;
+
+typedef struct {
+	const char* const* paths;
+	lazybiosBatchFn callback;
+	void* user;
+	batch_slice* slices;
+	unsigned workers;
+	volatile size_t finished;
+	volatile size_t stop;
+} batch_job;
+
+typedef struct {
+	batch_job* job;
+	unsigned self;
+	lazybiosThread* thread;
+} batch_worker;
+
+static int batch_claim(batch_job* job, unsigned self, size_t* index) {
+	for (unsigned k = 0; k < job->workers; k++) {
+		batch_slice* slice = &job->slices[(self + k) % job->workers];
+		// Once a slice is exhausted, skip it without bumping its counter further.
+		if (lazybiosAtomicLoad(&slice->range.next) >= slice->range.end) continue;
+
+		size_t i = lazybiosAtomicFetchAdd(&slice->range.next, 1);
+		if (i < slice->range.end) {
+			*index = i;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void batch_run(batch_job* job, unsigned self) {
+	// One context per worker: resetting it keeps its parse arena between dumps.
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	if (!ctx) {
+		lb_log("Failed to allocate a context for batch worker %u", self);
+		return;
+	}
+
+	size_t index;
+	while (!lazybiosAtomicLoad(&job->stop) && batch_claim(job, self, &index)) {
+		int loaded = lazybiosLoadDump(ctx, job->paths[index]) == 0;
+		if (job->callback(loaded ? ctx : NULL, index, job->paths[index], job->user) != 0)
+			lazybiosAtomicStore(&job->stop, 1);
+		lazybiosAtomicFetchAdd(&job->finished, 1);
+		lazybiosCTXReset(ctx);
+	}
+	lazybiosCleanup(ctx);
+}
+
+static void batch_thread(void* arg) {
+	batch_worker* worker = arg;
+	batch_run(worker->job, worker->self);
+}
+
+int lazybiosBatchLoad(const char* const* paths, size_t n, unsigned threads, lazybiosBatchFn callback, void* user) {
+	if ((!paths && n) || !callback) return -1;
+	if (n == 0) return 0;
+
+	if (threads == 0) threads = lazybiosCPUCount();
+	if (threads > n) threads = (unsigned)n;
+	// Every worker creates and loads contexts through the global hooks, and custom ones need not be thread-safe.
+	if (threads > 1 && !lazybiosAllocatorIsDefault(NULL)) {
+		lb_dbg("Loading dumps on the calling thread because custom allocator hooks are installed");
+		threads = 1;
+	}
+
+	batch_job job;
+	memset(&job, 0, sizeof(job));
+	job.paths = paths;
+	job.callback = callback;
+	job.user = user;
+	job.workers = threads;
+	job.slices = lazybiosCalloc(threads, sizeof(*job.slices));
+	batch_worker* workers = lazybiosCalloc(threads, sizeof(*workers));
+	if (!job.slices || !workers) {
+		lazybiosFree(job.slices);
+		lazybiosFree(workers);
+		return -1;
+	}
+
+	for (unsigned w = 0; w < threads; w++) {
+		job.slices[w].range.next = n / threads * w + (w < n % threads ? w : n % threads);
+		job.slices[w].range.end = job.slices[w].range.next + n / threads + (w < n % threads);
+		workers[w].job = &job;
+		workers[w].self = w;
+	}
+
+	// The calling thread is worker 0; a worker that fails to start leaves its slice to the others.
+	for (unsigned w = 1; w < threads; w++) {
+		workers[w].thread = lazybiosThreadStart(batch_thread, &workers[w]);
+		if (!workers[w].thread) lb_dbg("Failed to start batch worker %u", w);
+	}
+	batch_run(&job, 0);
+	for (unsigned w = 1; w < threads; w++)
+		lazybiosThreadJoin(workers[w].thread);
+
+	// Only workers that could not allocate a context leave dumps unvisited.
+	int result = job.stop || job.finished == n ? 0 : -1;
+	lazybiosFree(job.slices);
+	lazybiosFree(workers);
+	return result;
+}
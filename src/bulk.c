@@ -0,0 +1,526 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file bulk.c
+ * @brief Ingests many dumps through io_uring, or through the batch thread pool.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+#if defined(OS_LINUX) && defined(LAZYBIOS_HAVE_IO_URING)
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Dumps in flight when the caller does not choose.
+#define BULK_DEFAULT_DEPTH 32
+// Largest entry point read from a smbios_entry_point file, as lazybiosFile() reads it.
+#define BULK_ENTRY_MAX 64
+// Largest file read in one request; SMBIOS 3 tables stop well short of it.
+#define BULK_FILE_MAX (UINT32_C(1) << 30)
+
+typedef struct {
+	int fd;
+	unsigned sq_entries;
+	unsigned sq_mask;
+	unsigned cq_mask;
+	unsigned* sq_head;
+	unsigned* sq_tail;
+	unsigned* sq_array;
+	unsigned* cq_head;
+	unsigned* cq_tail;
+	struct io_uring_sqe* sqes;
+	struct io_uring_cqe* cqes;
+	void* sq_ring;
+	size_t sq_ring_size;
+	void* cq_ring;
+	size_t cq_ring_size;
+	size_t sqes_size;
+	unsigned tail;      // SQEs filled in so far
+	unsigned submitted; // SQEs the kernel has taken
+	unsigned reaped;    // CQEs consumed
+} bulk_ring;
+
+static int ring_setup(bulk_ring* ring, unsigned entries) {
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	memset(ring, 0, sizeof(*ring));
+	ring->fd = -1;
+
+	// Every request a slot has in flight completes, so the CQ gets room for all of them twice over.
+	params.flags = IORING_SETUP_CQSIZE;
+	params.cq_entries = entries * 2;
+	int fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+	if (fd < 0) {
+		lb_dbg("io_uring unavailable: %s", strerror(errno));
+		return -1;
+	}
+	ring->fd = fd;
+
+	// Kernels that lack an operation the loader needs are treated like kernels without io_uring.
+	size_t probe_size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+	struct io_uring_probe* probe = lazybiosCalloc(1, probe_size);
+	int supported = probe && syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+	static const uint8_t needed[] = { IORING_OP_STATX, IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_CLOSE };
+	for (size_t i = 0; supported && i < sizeof(needed); i++)
+		supported = needed[i] <= probe->last_op && (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+	lazybiosFree(probe);
+	if (!supported) {
+		lb_dbg("io_uring lacks the operations the bulk loader needs");
+		close(fd);
+		ring->fd = -1;
+		return -1;
+	}
+
+	ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		if (ring->cq_ring_size > ring->sq_ring_size) ring->sq_ring_size = ring->cq_ring_size;
+		ring->cq_ring_size = ring->sq_ring_size;
+	}
+	ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	ring->cq_ring = ring->sq_ring;
+	if (ring->sq_ring != MAP_FAILED && !(params.features & IORING_FEAT_SINGLE_MMAP))
+		ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+	ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+	if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+		lb_dbg("Failed to map the io_uring rings: %s", strerror(errno));
+		if (ring->sqes != MAP_FAILED) munmap(ring->sqes, ring->sqes_size);
+		if (ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring) munmap(ring->cq_ring, ring->cq_ring_size);
+		if (ring->sq_ring != MAP_FAILED) munmap(ring->sq_ring, ring->sq_ring_size);
+		close(fd);
+		ring->fd = -1;
+		return -1;
+	}
+
+	uint8_t* sq = ring->sq_ring;
+	uint8_t* cq = ring->cq_ring;
+	ring->sq_entries = params.sq_entries;
+	ring->sq_mask = *(unsigned*)(sq + params.sq_off.ring_mask);
+	ring->sq_head = (unsigned*)(sq + params.sq_off.head);
+	ring->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+	ring->sq_array = (unsigned*)(sq + params.sq_off.array);
+	ring->cq_mask = *(unsigned*)(cq + params.cq_off.ring_mask);
+	ring->cq_head = (unsigned*)(cq + params.cq_off.head);
+	ring->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+	ring->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+	ring->tail = *ring->sq_tail;
+	ring->submitted = ring->tail;
+	return 0;
+}
+
+// Hands every filled SQE to the kernel and, with wait set, blocks for one completion.
+static int ring_enter(bulk_ring* ring, int wait) {
+	__atomic_store_n(ring->sq_tail, ring->tail, __ATOMIC_RELEASE);
+	for (;;) {
+		unsigned pending = ring->tail - ring->submitted;
+		long rc = syscall(__NR_io_uring_enter, ring->fd, pending, wait ? 1 : 0,
+			wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+		if (rc < 0 && errno == EINTR) continue;
+		// The kernel is short of resources until completions are reaped; the caller's loop does that.
+		if (rc < 0 && (errno == EAGAIN || errno == EBUSY)) return 0;
+		if (rc < 0) {
+			lb_log("io_uring_enter failed: %s", strerror(errno));
+			return -1;
+		}
+		ring->submitted += (unsigned)rc;
+		if (ring->submitted == ring->tail || rc == 0) return 0;
+		wait = 0;
+	}
+}
+
+// Takes the next completion; returns 0 when none is ready.
+static int ring_reap(bulk_ring* ring, uint64_t* tag, int32_t* res) {
+	unsigned head = *ring->cq_head;
+	if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) return 0;
+
+	const struct io_uring_cqe* cqe = &ring->cqes[head & ring->cq_mask];
+	*tag = cqe->user_data;
+	*res = cqe->res;
+	__atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+	ring->reaped++;
+	return 1;
+}
+
+static void ring_teardown(bulk_ring* ring) {
+	munmap(ring->sqes, ring->sqes_size);
+	if (ring->cq_ring != ring->sq_ring) munmap(ring->cq_ring, ring->cq_ring_size);
+	munmap(ring->sq_ring, ring->sq_ring_size);
+	close(ring->fd);
+}
+
+static int ring_full(bulk_ring* ring) {
+	return ring->tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) >= ring->sq_entries;
+}
+
+static struct io_uring_sqe* ring_sqe(bulk_ring* ring, uint64_t user_data) {
+	if (ring_full(ring) && (ring_enter(ring, 0) != 0 || ring_full(ring))) return NULL;
+
+	unsigned slot = ring->tail & ring->sq_mask;
+	struct io_uring_sqe* sqe = &ring->sqes[slot];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->user_data = user_data;
+	ring->sq_array[slot] = slot;
+	ring->tail++;
+	return sqe;
+}
+
+enum { OP_STAT, OP_OPEN, OP_READ, OP_CLOSE };
+enum { STAGE_STAT_PATH, STAGE_STAT_ENTRY, STAGE_STAT_DMI, STAGE_STAT_BIN, STAGE_OPEN, STAGE_READ };
+
+/*
+ * A slot carries one dump from statx to parse. Paths and the statx result
+ * live in the slot because the kernel reads and writes them after submission.
+ * The read buffer is reused for every dump the slot carries; the context
+ * borrows it and is reset before the slot moves on.
+ */
+typedef struct {
+	size_t index;
+	int busy;
+	int stage;
+	int merged;
+	int pending;
+	int failed;
+	int fds[2];
+	const char* open_paths[2];
+	uint32_t sizes[2];
+	uint32_t got[2];
+	struct statx stx;
+	char paths[2][LAZYBIOS_DUMP_PATH_MAX];
+	uint8_t* buf;
+	size_t capacity;
+} bulk_slot;
+
+typedef struct {
+	bulk_ring ring;
+	bulk_slot* slots;
+	unsigned depth;
+	const char* const* paths;
+	size_t n;
+	size_t next;
+	size_t in_flight;
+	int stop;
+	lazybiosCTX_t* ctx;
+	lazybiosBatchFn callback;
+	void* user;
+} bulk_job;
+
+static uint64_t bulk_tag(unsigned slot, int op, int which) {
+	return ((uint64_t)slot << 8) | ((uint64_t)op << 1) | (uint64_t)which;
+}
+
+// Waits out every submitted request, so the memory they name can be freed; files opened meanwhile are closed.
+static int bulk_drain(bulk_job* job) {
+	uint64_t tag;
+	int32_t res;
+	while (job->ring.submitted != job->ring.reaped) {
+		if (!ring_reap(&job->ring, &tag, &res)) {
+			if (ring_enter(&job->ring, 1) != 0) return -1;
+			continue;
+		}
+		if ((int)((tag >> 1) & 0x7F) == OP_OPEN && res >= 0) close(res);
+	}
+	return 0;
+}
+
+static int submit_statx(bulk_job* job, unsigned s, const char* path) {
+	struct io_uring_sqe* sqe = ring_sqe(&job->ring, bulk_tag(s, OP_STAT, 0));
+	if (!sqe) return -1;
+	sqe->opcode = IORING_OP_STATX;
+	sqe->fd = AT_FDCWD;
+	sqe->addr = (uint64_t)(uintptr_t)path;
+	sqe->len = STATX_TYPE | STATX_SIZE;
+	sqe->off = (uint64_t)(uintptr_t)&job->slots[s].stx;
+	job->slots[s].pending = 1;
+	return 0;
+}
+
+static int submit_close(bulk_job* job, unsigned s, int fd) {
+	struct io_uring_sqe* sqe = ring_sqe(&job->ring, bulk_tag(s, OP_CLOSE, 0));
+	if (!sqe) return -1;
+	sqe->opcode = IORING_OP_CLOSE;
+	sqe->fd = fd;
+	return 0;
+}
+
+static void close_fds(bulk_job* job, unsigned s) {
+	bulk_slot* slot = &job->slots[s];
+	for (int i = 0; i < 2; i++) {
+		if (slot->fds[i] < 0) continue;
+		// Closing is fire and forget; without room in the ring it happens here.
+		if (submit_close(job, s, slot->fds[i]) != 0) close(slot->fds[i]);
+		slot->fds[i] = -1;
+	}
+}
+
+static int start_slot(bulk_job* job, unsigned s);
+
+static int finish_slot(bulk_job* job, unsigned s, int loaded) {
+	bulk_slot* slot = &job->slots[s];
+	if (job->callback(loaded ? job->ctx : NULL, slot->index, job->paths[slot->index], job->user) != 0)
+		job->stop = 1;
+	lazybiosCTXReset(job->ctx);
+	slot->busy = 0;
+	job->in_flight--;
+	return start_slot(job, s);
+}
+
+static int start_slot(bulk_job* job, unsigned s) {
+	if (job->stop || job->next >= job->n) return 0;
+
+	bulk_slot* slot = &job->slots[s];
+	slot->index = job->next++;
+	slot->busy = 1;
+	slot->stage = STAGE_STAT_PATH;
+	slot->failed = 0;
+	slot->fds[0] = slot->fds[1] = -1;
+	job->in_flight++;
+	return submit_statx(job, s, job->paths[slot->index]);
+}
+
+static int open_files(bulk_job* job, unsigned s) {
+	bulk_slot* slot = &job->slots[s];
+	size_t need = slot->merged ? slot->sizes[0] : (size_t)BULK_ENTRY_MAX + slot->sizes[1];
+	if (need > slot->capacity) {
+		uint8_t* grown = lazybiosAllocatorMalloc(NULL, need);
+		if (!grown) return finish_slot(job, s, 0);
+		lazybiosFree(slot->buf);
+		slot->buf = grown;
+		slot->capacity = need;
+	}
+
+	int files = slot->merged ? 1 : 2;
+	for (int i = 0; i < files; i++) {
+		struct io_uring_sqe* sqe = ring_sqe(&job->ring, bulk_tag(s, OP_OPEN, i));
+		if (!sqe) return -1;
+		sqe->opcode = IORING_OP_OPENAT;
+		sqe->fd = AT_FDCWD;
+		sqe->addr = (uint64_t)(uintptr_t)slot->open_paths[i];
+		sqe->open_flags = O_RDONLY | O_CLOEXEC;
+	}
+	slot->stage = STAGE_OPEN;
+	slot->pending = files;
+	return 0;
+}
+
+// Reads whatever of file i is still missing; a short read resubmits the rest.
+static int submit_read(bulk_job* job, unsigned s, int i) {
+	bulk_slot* slot = &job->slots[s];
+	struct io_uring_sqe* sqe = ring_sqe(&job->ring, bulk_tag(s, OP_READ, i));
+	if (!sqe) return -1;
+	sqe->opcode = IORING_OP_READ;
+	sqe->fd = slot->fds[i];
+	sqe->addr = (uint64_t)(uintptr_t)(slot->buf + (i ? BULK_ENTRY_MAX : 0) + slot->got[i]);
+	sqe->len = slot->sizes[i] - slot->got[i];
+	sqe->off = slot->got[i];
+	return 0;
+}
+
+static int read_files(bulk_job* job, unsigned s) {
+	bulk_slot* slot = &job->slots[s];
+	int files = slot->merged ? 1 : 2;
+	for (int i = 0; i < files; i++) {
+		slot->got[i] = 0;
+		if (submit_read(job, s, i) != 0) return -1;
+	}
+	slot->stage = STAGE_READ;
+	slot->pending = files;
+	return 0;
+}
+
+static int stat_bin(bulk_job* job, unsigned s) {
+	bulk_slot* slot = &job->slots[s];
+	if (lazybiosDumpPath(slot->paths[0], job->paths[slot->index], LAZYBIOS_DUMP_BIN) != 0)
+		return finish_slot(job, s, 0);
+	slot->stage = STAGE_STAT_BIN;
+	return submit_statx(job, s, slot->paths[0]);
+}
+
+/*
+ * The layouts are those lazybiosLoadDump() accepts, probed in the same order
+ * and through the same lazybiosDumpPath(): the pair is only taken when both
+ * of its files exist, and otherwise the merged file is tried.
+ */
+static int on_stat(bulk_job* job, unsigned s, int32_t res) {
+	bulk_slot* slot = &job->slots[s];
+	const char* path = job->paths[slot->index];
+	int exists = res == 0 && S_ISREG(slot->stx.stx_mode);
+	int regular = exists && slot->stx.stx_size > 0 && slot->stx.stx_size <= BULK_FILE_MAX;
+
+	switch (slot->stage) {
+	case STAGE_STAT_PATH:
+		if (regular) {
+			slot->open_paths[0] = path;
+			slot->merged = 1;
+			slot->sizes[0] = (uint32_t)slot->stx.stx_size;
+			return open_files(job, s);
+		}
+		if (res != 0 || !S_ISDIR(slot->stx.stx_mode)) {
+			lb_log("No SMBIOS dump at %s", path);
+			return finish_slot(job, s, 0);
+		}
+		if (lazybiosDumpPath(slot->paths[0], path, LAZYBIOS_DUMP_ENTRY) != 0 ||
+			lazybiosDumpPath(slot->paths[1], path, LAZYBIOS_DUMP_DMI) != 0)
+			return stat_bin(job, s);
+		slot->stage = STAGE_STAT_ENTRY;
+		return submit_statx(job, s, slot->paths[0]);
+
+	case STAGE_STAT_ENTRY:
+		if (!exists) return stat_bin(job, s);
+		slot->stage = STAGE_STAT_DMI;
+		return submit_statx(job, s, slot->paths[1]);
+
+	case STAGE_STAT_DMI:
+		if (!exists) return stat_bin(job, s);
+		// Like lazybiosFileMapped(), an empty or oversized table fails the dump rather than falling back.
+		if (!regular) return finish_slot(job, s, 0);
+		slot->open_paths[0] = slot->paths[0];
+		slot->open_paths[1] = slot->paths[1];
+		slot->merged = 0;
+		slot->sizes[0] = BULK_ENTRY_MAX;
+		slot->sizes[1] = (uint32_t)slot->stx.stx_size;
+		return open_files(job, s);
+
+	default:
+		if (!regular) {
+			lb_log("No smbios_entry_point and DMI pair or merged .bin file in %s", path);
+			return finish_slot(job, s, 0);
+		}
+		slot->open_paths[0] = slot->paths[0];
+		slot->merged = 1;
+		slot->sizes[0] = (uint32_t)slot->stx.stx_size;
+		return open_files(job, s);
+	}
+}
+
+static int on_read_done(bulk_job* job, unsigned s) {
+	bulk_slot* slot = &job->slots[s];
+	close_fds(job, s);
+	if (slot->failed) return finish_slot(job, s, 0);
+
+	// The completed buffer goes straight to the borrowed-table path; nothing is copied but the entry point.
+	int rc = slot->merged
+		? lazybiosLoadMergedBorrowed(job->ctx, slot->buf, (size_t)slot->got[0])
+		: lazybiosLoadBorrowed(job->ctx, slot->buf, (size_t)slot->got[0],
+			slot->buf + BULK_ENTRY_MAX, (size_t)slot->got[1], 0, NULL, NULL);
+	return finish_slot(job, s, rc == 0);
+}
+
+static int on_complete(bulk_job* job, uint64_t tag, int32_t res) {
+	unsigned s = (unsigned)(tag >> 8);
+	int op = (int)((tag >> 1) & 0x7F);
+	int which = (int)(tag & 1);
+	bulk_slot* slot = &job->slots[s];
+	if (op == OP_CLOSE) return 0;
+	if (op == OP_STAT) return on_stat(job, s, res);
+
+	if (op == OP_OPEN) {
+		if (res < 0) slot->failed = 1;
+		else slot->fds[which] = res;
+		if (--slot->pending) return 0;
+		if (!slot->failed) return read_files(job, s);
+		close_fds(job, s);
+		return finish_slot(job, s, 0);
+	}
+
+	/*
+	 * Reads may come back short, so the rest is asked for again. The entry
+	 * point is read up to a cap and may end early; a merged file or table
+	 * that ends before the size statx reported was truncated under us.
+	 */
+	if (res < 0) {
+		slot->failed = 1;
+	} else if (res > 0) {
+		slot->got[which] += (uint32_t)res;
+		if (slot->got[which] < slot->sizes[which]) return submit_read(job, s, which);
+	} else if (slot->merged || which == 1) {
+		slot->failed = 1;
+	}
+	if (--slot->pending) return 0;
+	return on_read_done(job, s);
+}
+
+int lazybiosBulkLoadUring(const char* const* paths, size_t n, unsigned depth, lazybiosBatchFn callback, void* user) {
+	if ((!paths && n) || !callback) return -1;
+	if (n == 0) return 0;
+	if (depth == 0) depth = BULK_DEFAULT_DEPTH;
+	if (depth > n) depth = (unsigned)n;
+	if (depth > 4096) depth = 4096;
+
+	bulk_job job;
+	memset(&job, 0, sizeof(job));
+	job.paths = paths;
+	job.n = n;
+	job.depth = depth;
+	job.callback = callback;
+	job.user = user;
+
+	// A slot has at most two requests of its own and two closes of its last dump outstanding.
+	unsigned entries = 1;
+	while (entries < depth * 4) entries <<= 1;
+	if (ring_setup(&job.ring, entries) != 0) return 1;
+
+	job.ctx = lazybiosCTXNew();
+	job.slots = lazybiosCalloc(depth, sizeof(*job.slots));
+	int result = job.ctx && job.slots ? 0 : -1;
+	for (unsigned s = 0; result == 0 && s < depth; s++)
+		if (start_slot(&job, s) != 0) result = -1;
+
+	uint64_t tag;
+	int32_t res;
+	while (result == 0 && job.in_flight > 0) {
+		if (ring_enter(&job.ring, 1) != 0) result = -1;
+		while (result == 0 && ring_reap(&job.ring, &tag, &res))
+			if (on_complete(&job, tag, res) != 0) result = -1;
+	}
+
+	// Closes may still be outstanding, and after a failure reads too, which write into the slots.
+	int drained = bulk_drain(&job) == 0;
+	ring_teardown(&job.ring);
+	if (!drained) {
+		lb_log("Leaking bulk load buffers the kernel may still write");
+	} else if (job.slots) {
+		for (unsigned s = 0; s < depth; s++) {
+			for (int i = 0; i < 2; i++)
+				if (job.slots[s].busy && job.slots[s].fds[i] >= 0) close(job.slots[s].fds[i]);
+			lazybiosFree(job.slots[s].buf);
+		}
+	}
+	lazybiosFree(job.slots);
+	lazybiosCleanup(job.ctx);
+	return result;
+}
+#endif
+
+int lazybiosBulkLoad(const char* const* paths, size_t n, unsigned depth, lazybiosBatchFn callback, void* user) {
+#if defined(OS_LINUX) && defined(LAZYBIOS_HAVE_IO_URING)
+	int rc = lazybiosBulkLoadUring(paths, n, depth, callback, user);
+	if (rc != 1) return rc;
+	lb_dbg("Loading dumps on the batch thread pool instead of io_uring");
+#else
+	(void)depth;
+#endif
+	return lazybiosBatchLoad(paths, n, 0, callback, user);
+}
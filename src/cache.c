@@ -0,0 +1,367 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file cache.c
+ * @brief Stores a loaded table with its structure index, and maps it back in.
+ * @author LazySeldi
+ */
+#if defined(LAZYBIOS_HAVE_MKOSTEMP) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "lazybios_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#	include <fcntl.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#define CACHE_MAGIC "LBCACHE"
+#define CACHE_BYTE_ORDER UINT32_C(0x01020304)
+#define CACHE_ALIGN 8
+
+/*
+ * The file is the header, the entry point, the table and then the index
+ * arrays, each section starting on an eight-byte boundary. The arrays are
+ * written in host layout, which byte_order and index_entry_size pin down.
+ */
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t header_size;
+	uint32_t index_entry_size;
+	uint64_t key;
+	uint64_t file_len;
+	uint32_t entry_offset;
+	uint32_t entry_len;
+	uint32_t dmi_offset;
+	uint32_t dmi_len;
+	uint32_t entries_offset;
+	uint32_t entry_count;
+	uint32_t by_type_offset;
+	uint32_t strings_offset;
+	uint32_t string_count;
+	uint32_t handles_offset;
+	uint32_t handle_slots;
+	uint32_t handles_hashed;
+	uint32_t type_start[257];
+	uint32_t reserved;
+} cache_header;
+
+/*
+ * The key only guards against stale or torn files, not against someone who
+ * can already write the cache, so the fast table hash is enough.
+ */
+static uint64_t cache_key(const uint8_t* entry, size_t entry_len, const uint8_t* dmi, size_t dmi_len) {
+	return lazybiosHash64(lazybiosHash64(0, entry, entry_len), dmi, dmi_len);
+}
+
+static uint64_t cache_align(uint64_t offset) {
+	return (offset + CACHE_ALIGN - 1) & ~(uint64_t)(CACHE_ALIGN - 1);
+}
+
+// A section is usable when it lies inside the file and is aligned for its elements.
+static int cache_section(const cache_header* header, uint32_t offset, uint64_t count, size_t size) {
+	if (count == 0) return 1;
+	return offset % CACHE_ALIGN == 0 && offset >= header->header_size &&
+		offset <= header->file_len && count <= (header->file_len - offset) / size;
+}
+
+/*
+ * The cursors, handle lookups and string reads trust the index, so a cache
+ * that does not describe its own table exactly is rejected rather than used.
+ */
+static int cache_index_valid(const cache_header* header, const uint8_t* dmi,
+	const lazybiosIndexEntry* entries, const uint32_t* by_type, const uint32_t* strings, const uint32_t* handles) {
+	uint32_t count = header->entry_count;
+	uint32_t expected = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const lazybiosIndexEntry* entry = &entries[i];
+		// Malformed lengths are indexed as found, but every header lies inside the table.
+		if (entry->offset != expected || entry->next <= entry->offset || entry->next > header->dmi_len ||
+			header->dmi_len - entry->offset <= SMBIOS_HEADER_SIZE || entry->length > entry->next - entry->offset ||
+			entry->type != dmi[entry->offset] || entry->type == SMBIOS_TYPE_END ||
+			entry->handle != (uint16_t)(dmi[entry->offset + 2] | (dmi[entry->offset + 3] << 8)))
+			return 0;
+		if (entry->string_count > 0) {
+			if (entry->first_string > header->string_count ||
+				entry->string_count > header->string_count - entry->first_string ||
+				entry->next - entry->offset < (uint32_t)entry->length + 2 ||
+				dmi[entry->next - 1] != 0 || dmi[entry->next - 2] != 0)
+				return 0;
+			for (uint32_t s = 0; s < entry->string_count; s++) {
+				uint32_t string = strings[entry->first_string + s];
+				if (string < entry->offset + entry->length || string >= entry->next - 1) return 0;
+			}
+		}
+		expected = entry->next;
+	}
+
+	if (header->type_start[0] != 0 || header->type_start[256] != count) return 0;
+	for (uint32_t t = 0; t < 256; t++) {
+		if (header->type_start[t + 1] < header->type_start[t]) return 0;
+		for (uint32_t slot = header->type_start[t]; slot < header->type_start[t + 1]; slot++) {
+			if (by_type[slot] >= count || entries[by_type[slot]].type != t ||
+				entries[by_type[slot]].ordinal != slot - header->type_start[t])
+				return 0;
+		}
+	}
+
+	// A hashed table is probed until an empty slot, so it must keep one.
+	uint32_t empty = 0;
+	for (uint32_t slot = 0; slot < header->handle_slots; slot++) {
+		if (handles[slot] > count) return 0;
+		if (handles[slot] == 0) empty++;
+	}
+	if (header->handles_hashed)
+		return (header->handle_slots & (header->handle_slots - 1)) == 0 && empty > 0;
+	return header->handle_slots <= UINT16_MAX + 1u;
+}
+
+int lazybiosCacheLoad(lazybiosCTX_t* ctx, const char* path) {
+	if (!ctx || !ctx->DMIData || !path) return -1;
+	if (ctx->DMIData->entry_data || ctx->DMIData->dmi_data) return -1;
+
+	void* base;
+	size_t file_len;
+	if (lazybiosMapFile(path, &base, &file_len) != 0) {
+		lb_dbg("No SMBIOS cache at %s", path);
+		return -1;
+	}
+
+	const uint8_t* file = base;
+	cache_header header;
+	if (file_len < sizeof(header)) goto invalid;
+	memcpy(&header, file, sizeof(header));
+	if (memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+		header.version != LAZYBIOS_CACHE_VERSION || header.byte_order != CACHE_BYTE_ORDER ||
+		header.header_size != sizeof(header) || header.index_entry_size != sizeof(lazybiosIndexEntry) ||
+		header.file_len != file_len || header.entry_len == 0 || header.dmi_len == 0 ||
+		!cache_section(&header, header.entry_offset, header.entry_len, 1) ||
+		!cache_section(&header, header.dmi_offset, header.dmi_len, 1) ||
+		!cache_section(&header, header.entries_offset, header.entry_count, sizeof(lazybiosIndexEntry)) ||
+		!cache_section(&header, header.by_type_offset, header.entry_count, sizeof(uint32_t)) ||
+		!cache_section(&header, header.strings_offset, header.string_count, sizeof(uint32_t)) ||
+		!cache_section(&header, header.handles_offset, header.handle_slots, sizeof(uint32_t)))
+		goto invalid;
+
+	const uint8_t* entry = file + header.entry_offset;
+	uint8_t* dmi = (uint8_t*)base + header.dmi_offset;
+	const lazybiosIndexEntry* entries = (const lazybiosIndexEntry*)(file + header.entries_offset);
+	const uint32_t* by_type = (const uint32_t*)(file + header.by_type_offset);
+	const uint32_t* strings = (const uint32_t*)(file + header.strings_offset);
+	const uint32_t* handles = (const uint32_t*)(file + header.handles_offset);
+	if (cache_key(entry, header.entry_len, dmi, header.dmi_len) != header.key ||
+		!cache_index_valid(&header, dmi, entries, by_type, strings, handles))
+		goto invalid;
+
+	const lazybiosAllocator_t* allocator = &ctx->DMIData->allocator;
+	uint8_t* entry_copy = lazybiosAllocatorMalloc(allocator, header.entry_len);
+	if (entry_copy) memcpy(entry_copy, entry, header.entry_len);
+	if (!entry_copy || lazybiosAdoptBuffers(ctx, entry_copy, header.entry_len,
+			dmi, header.dmi_len, LAZYBIOS_LOAD_NO_INDEX) != 0) {
+		lazybiosAllocatorFree(allocator, entry_copy);
+		lazybiosUnmapFile(base, file_len);
+		return -1;
+	}
+	ctx->DMIData->mapping = base;
+	ctx->DMIData->mapping_len = file_len;
+
+	// Without room for the index header the table is still usable; parsers walk it.
+	lazybiosDMIIndex_t* index = lazybiosAllocatorCalloc(allocator, 1, sizeof(*index));
+	if (index) {
+		index->entries = header.entry_count ? (lazybiosIndexEntry*)entries : NULL;
+		index->count = header.entry_count;
+		index->by_type = header.entry_count ? (uint32_t*)by_type : NULL;
+		memcpy(index->type_start, header.type_start, sizeof(index->type_start));
+		index->strings = header.string_count ? (uint32_t*)strings : NULL;
+		index->string_count = header.string_count;
+		index->handles = header.handle_slots ? (uint32_t*)handles : NULL;
+		index->handle_slots = header.handle_slots;
+		index->handles_hashed = (int)header.handles_hashed;
+		index->borrowed = 1;
+		ctx->DMIData->index = index;
+	}
+	return 0;
+
+invalid:
+	lb_log("Ignoring invalid or stale SMBIOS cache %s", path);
+	lazybiosUnmapFile(base, file_len);
+	return -1;
+}
+
+static int cache_write(FILE* out, const void* data, size_t len, uint64_t* written) {
+	static const uint8_t padding[CACHE_ALIGN] = {0};
+	if (len > 0 && fwrite(data, 1, len, out) != len) return -1;
+	*written += len;
+
+	size_t pad = (size_t)(cache_align(*written) - *written);
+	if (pad > 0 && fwrite(padding, 1, pad, out) != pad) return -1;
+	*written += pad;
+	return 0;
+}
+
+static int cache_write_file(FILE* out, const cache_header* header, const lazybiosDMI_t* DMIData, const lazybiosDMIIndex_t* index) {
+	uint64_t written = 0;
+	return cache_write(out, header, sizeof(*header), &written) != 0 ||
+		cache_write(out, DMIData->entry_data, DMIData->entry_len, &written) != 0 ||
+		cache_write(out, DMIData->dmi_data, DMIData->dmi_len, &written) != 0 ||
+		cache_write(out, index->entries, index->count * sizeof(*index->entries), &written) != 0 ||
+		cache_write(out, index->by_type, index->count * sizeof(*index->by_type), &written) != 0 ||
+		cache_write(out, index->strings, index->string_count * sizeof(*index->strings), &written) != 0 ||
+		cache_write(out, index->handles, index->handle_slots * sizeof(*index->handles), &written) != 0 ||
+		written != header->file_len ? -1 : 0;
+}
+
+int lazybiosCacheStore(const lazybiosCTX_t* ctx, const char* path) {
+	if (!ctx || !ctx->DMIData || !path) return -1;
+
+	const lazybiosDMI_t* DMIData = ctx->DMIData;
+	if (!DMIData->entry_data || !DMIData->dmi_data || DMIData->entry_len > UINT32_MAX ||
+		DMIData->dmi_len > UINT32_MAX)
+		return -1;
+
+	// A context loaded without an index gets a temporary one for the file.
+	lazybiosDMI_t indexed = *DMIData;
+	if (!indexed.index) {
+		if (lazybiosBuildIndex(&indexed) != 0) return -1;
+	}
+	const lazybiosDMIIndex_t* index = indexed.index;
+
+	cache_header header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+	header.version = LAZYBIOS_CACHE_VERSION;
+	header.byte_order = CACHE_BYTE_ORDER;
+	header.header_size = sizeof(header);
+	header.index_entry_size = sizeof(lazybiosIndexEntry);
+	header.key = cache_key(DMIData->entry_data, DMIData->entry_len, DMIData->dmi_data, DMIData->dmi_len);
+	header.entry_len = (uint32_t)DMIData->entry_len;
+	header.dmi_len = (uint32_t)DMIData->dmi_len;
+	header.entry_count = (uint32_t)index->count;
+	header.string_count = (uint32_t)index->string_count;
+	header.handle_slots = (uint32_t)index->handle_slots;
+	header.handles_hashed = (uint32_t)index->handles_hashed;
+	memcpy(header.type_start, index->type_start, sizeof(header.type_start));
+
+	uint64_t offset = cache_align(sizeof(header));
+	header.entry_offset = (uint32_t)offset;
+	offset = cache_align(offset + DMIData->entry_len);
+	header.dmi_offset = (uint32_t)offset;
+	offset = cache_align(offset + DMIData->dmi_len);
+	header.entries_offset = (uint32_t)offset;
+	offset = cache_align(offset + (uint64_t)index->count * sizeof(*index->entries));
+	header.by_type_offset = (uint32_t)offset;
+	offset = cache_align(offset + (uint64_t)index->count * sizeof(*index->by_type));
+	header.strings_offset = (uint32_t)offset;
+	offset = cache_align(offset + (uint64_t)index->string_count * sizeof(*index->strings));
+	header.handles_offset = (uint32_t)offset;
+	offset = cache_align(offset + (uint64_t)index->handle_slots * sizeof(*index->handles));
+	header.file_len = offset;
+
+	int result = -1;
+	if (offset > UINT32_MAX) goto done;
+
+	/*
+	 * Readers map whatever file the path names, so the cache is written
+	 * beside it and renamed into place only once it is complete.
+	 */
+	size_t path_len = strlen(path);
+	size_t temp_size = path_len + sizeof(".XXXXXX");
+	char* temp_path = lazybiosAllocatorMalloc(&DMIData->allocator, temp_size);
+	if (!temp_path) goto done;
+	memcpy(temp_path, path, path_len);
+
+#if defined(_WIN32)
+	memcpy(temp_path + path_len, ".tmp", sizeof(".tmp"));
+	FILE* out = fopen(temp_path, "wb");
+#else
+	memcpy(temp_path + path_len, ".XXXXXX", sizeof(".XXXXXX"));
+	// The descriptor must not leak into a child the host forks and execs meanwhile.
+#	if defined(LAZYBIOS_HAVE_MKOSTEMP)
+	int fd = mkostemp(temp_path, O_CLOEXEC);
+#	else
+	int fd = mkstemp(temp_path);
+	if (fd >= 0) (void)fcntl(fd, F_SETFD, FD_CLOEXEC);
+#	endif
+	FILE* out = NULL;
+	if (fd >= 0) {
+		// Agents without write access still read the cache a privileged one refreshed.
+		if (fchmod(fd, 0644) != 0 || !(out = fdopen(fd, "wb"))) close(fd);
+	}
+#endif
+	if (!out) {
+		lb_dbg("Cannot create a temporary SMBIOS cache beside %s", path);
+		lazybiosAllocatorFree(&DMIData->allocator, temp_path);
+		goto done;
+	}
+
+	int failed = cache_write_file(out, &header, DMIData, index);
+	if (fclose(out) != 0) failed = 1;
+#if defined(_WIN32)
+	if (!failed) remove(path);
+#endif
+	if (failed || rename(temp_path, path) != 0) {
+		lb_dbg("Failed to write the SMBIOS cache %s", path);
+		remove(temp_path);
+	} else {
+		result = 0;
+	}
+	lazybiosAllocatorFree(&DMIData->allocator, temp_path);
+
+done:
+	if (!DMIData->index) lazybiosFreeIndex(&indexed);
+	return result;
+}
+
+int lazybiosInitFlags(lazybiosCTX_t* ctx, unsigned flags) {
+	if (!ctx) return -1;
+	if (!(flags & LAZYBIOS_INIT_CACHE)) return lazybiosInit(ctx);
+
+	/*
+	 * The cache's own hash only catches torn or corrupt files. One baked into
+	 * an image, shared between hosts or left over from a firmware update is
+	 * caught by comparing its entry point with the one the firmware serves now.
+	 * Where that cannot be read the cache is trusted, which relies on /run
+	 * being a tmpfs that does not outlive the boot.
+	 */
+	if (lazybiosCacheLoad(ctx, LAZYBIOS_CACHE_PATH) == 0) {
+		// Only the entry-point half of the fingerprint is compared, so the table is not hashed again.
+		uint8_t fingerprint[LAZYBIOS_FINGERPRINT_SIZE] = {0};
+		lazybiosFingerprintEntry(ctx->DMIData->entry_data, ctx->DMIData->entry_len, fingerprint + 16);
+		if (lazybiosFingerprintChanged(fingerprint) != 1) return 0;
+		lb_log("Ignoring SMBIOS cache %s, which does not match the firmware", LAZYBIOS_CACHE_PATH);
+		lazybiosCTXReset(ctx);
+	}
+	if (lazybiosInit(ctx) != 0) return -1;
+
+#if !defined(_WIN32)
+	// Usually only a privileged process may create the directory; the rest keep loading directly.
+	(void)mkdir(LAZYBIOS_CACHE_DIR, 0755);
+#endif
+	if (lazybiosCacheStore(ctx, LAZYBIOS_CACHE_PATH) != 0)
+		lb_dbg("SMBIOS cache %s was not refreshed", LAZYBIOS_CACHE_PATH);
+	return 0;
+}
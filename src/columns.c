@@ -0,0 +1,257 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file columns.c
+ * @brief Copies selected fields of many structures into per-field arrays.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <string.h>
+
+// Presence bitmaps are sized in whole words, so capacities stay multiples of 64.
+#define COLUMN_MIN_CAPACITY 64
+
+typedef struct {
+	size_t offset; // Offset of the column pointer in its set.
+	size_t width;  // Element size, or 0 for a presence bitmap.
+} column_desc;
+
+#define COLUMN(set, member) { offsetof(set, member), sizeof(*((set*)0)->member) }
+#define BITMAP(set, member) { offsetof(set, member), 0 }
+
+static const column_desc type17_columns[] = {
+	COLUMN(lazybiosType17Columns_t, source),
+	COLUMN(lazybiosType17Columns_t, handle),
+	COLUMN(lazybiosType17Columns_t, size),
+	COLUMN(lazybiosType17Columns_t, extended_size),
+	COLUMN(lazybiosType17Columns_t, speed),
+	COLUMN(lazybiosType17Columns_t, configured_memory_speed),
+	COLUMN(lazybiosType17Columns_t, memory_type),
+	COLUMN(lazybiosType17Columns_t, manufacturer),
+	BITMAP(lazybiosType17Columns_t, size_present),
+	BITMAP(lazybiosType17Columns_t, extended_size_present),
+	BITMAP(lazybiosType17Columns_t, speed_present),
+	BITMAP(lazybiosType17Columns_t, configured_memory_speed_present),
+	BITMAP(lazybiosType17Columns_t, memory_type_present),
+	BITMAP(lazybiosType17Columns_t, manufacturer_present),
+};
+
+static const column_desc type4_columns[] = {
+	COLUMN(lazybiosType4Columns_t, source),
+	COLUMN(lazybiosType4Columns_t, handle),
+	COLUMN(lazybiosType4Columns_t, core_count),
+	COLUMN(lazybiosType4Columns_t, core_enabled),
+	COLUMN(lazybiosType4Columns_t, thread_count),
+	COLUMN(lazybiosType4Columns_t, core_count_2),
+	COLUMN(lazybiosType4Columns_t, core_enabled_2),
+	COLUMN(lazybiosType4Columns_t, thread_count_2),
+	COLUMN(lazybiosType4Columns_t, thread_enabled),
+	BITMAP(lazybiosType4Columns_t, core_count_present),
+	BITMAP(lazybiosType4Columns_t, core_enabled_present),
+	BITMAP(lazybiosType4Columns_t, thread_count_present),
+	BITMAP(lazybiosType4Columns_t, core_count_2_present),
+	BITMAP(lazybiosType4Columns_t, core_enabled_2_present),
+	BITMAP(lazybiosType4Columns_t, thread_count_2_present),
+	BITMAP(lazybiosType4Columns_t, thread_enabled_present),
+};
+
+#define COLUMN_COUNT(descs) (sizeof(descs) / sizeof((descs)[0]))
+
+static size_t column_bytes(const column_desc* desc, size_t rows) {
+	return desc->width ? rows * desc->width : rows / 64 * sizeof(uint64_t);
+}
+
+// Column pointers have different types, so they are reached through memcpy.
+static void* column_get(const void* set, const column_desc* desc) {
+	void* ptr;
+	memcpy(&ptr, (const uint8_t*)set + desc->offset, sizeof(ptr));
+	return ptr;
+}
+
+static void column_put(void* set, const column_desc* desc, void* ptr) {
+	memcpy((uint8_t*)set + desc->offset, &ptr, sizeof(ptr));
+}
+
+// Grows every column to hold at least rows entries; on failure the capacity is unchanged.
+static int columns_reserve(void* set, const column_desc* descs, size_t n, size_t* capacity, size_t rows) {
+	if (rows <= *capacity) return 0;
+
+	size_t grown = *capacity ? *capacity : COLUMN_MIN_CAPACITY;
+	while (grown < rows) {
+		if (grown > SIZE_MAX / 2 / sizeof(uint64_t)) return -1;
+		grown *= 2;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		size_t old_bytes = column_bytes(&descs[i], *capacity);
+		size_t new_bytes = column_bytes(&descs[i], grown);
+		uint8_t* ptr = lazybiosAllocatorRealloc(NULL, column_get(set, &descs[i]), old_bytes, new_bytes);
+		if (!ptr) {
+			lb_log("Failed to grow column set to %zu rows", grown);
+			return -1;
+		}
+		memset(ptr + old_bytes, 0, new_bytes - old_bytes);
+		column_put(set, &descs[i], ptr);
+	}
+
+	*capacity = grown;
+	return 0;
+}
+
+// Clears presence bits of rows [count, end), which a failed append may have left set.
+static void columns_clear_rows(void* set, const column_desc* descs, size_t n, size_t count, size_t end) {
+	if (count == end) return;
+	for (size_t i = 0; i < n; i++) {
+		if (descs[i].width) continue;
+		uint64_t* bitmap = column_get(set, &descs[i]);
+		if (count % 64) bitmap[count / 64] &= ~UINT64_C(0) >> (64 - count % 64);
+		for (size_t word = (count + 63) / 64; word < (end + 63) / 64; word++)
+			bitmap[word] = 0;
+	}
+}
+
+static void columns_free(void* set, const column_desc* descs, size_t n) {
+	for (size_t i = 0; i < n; i++)
+		lazybiosFree(column_get(set, &descs[i]));
+}
+
+#define COLUMN_STORE(set, row, record, field) do { \
+	(set)->field[row] = (record)->field; \
+	if (LAZYBIOS_FIELD_STATUS(record, field) == LAZYBIOS_FIELD_PRESENT) \
+		(set)->field##_present[(row) / 64] |= UINT64_C(1) << ((row) % 64); \
+} while (0)
+
+// Finds a manufacturer in the set's dictionary, copying it in on first sight.
+static int type17_intern(lazybiosType17Columns_t* columns, const char* name, uint32_t* id) {
+	for (size_t i = 0; i < columns->manufacturer_name_count; i++) {
+		if (strcmp(columns->manufacturer_names[i], name) == 0) {
+			*id = (uint32_t)i;
+			return 0;
+		}
+	}
+
+	if (columns->manufacturer_name_count >= UINT32_MAX) return -1;
+	if (columns->manufacturer_name_count == columns->manufacturer_name_capacity) {
+		size_t grown = columns->manufacturer_name_capacity ? columns->manufacturer_name_capacity * 2 : 8;
+		char** names = lazybiosAllocatorRealloc(NULL, columns->manufacturer_names,
+			columns->manufacturer_name_capacity * sizeof(char*), grown * sizeof(char*));
+		if (!names) return -1;
+		columns->manufacturer_names = names;
+		columns->manufacturer_name_capacity = grown;
+	}
+
+	size_t len = strlen(name);
+	char* copy = lazybiosCalloc(len + 1, 1);
+	if (!copy) return -1;
+	memcpy(copy, name, len);
+
+	*id = (uint32_t)columns->manufacturer_name_count;
+	columns->manufacturer_names[columns->manufacturer_name_count++] = copy;
+	return 0;
+}
+
+int lazybiosColumnsType17(lazybiosType17Columns_t* columns, lazybiosCTX_t* ctx) {
+	lazybiosIter_t it;
+	if (!columns || lazybiosIterBegin(&it, ctx, 17) != 0) return -1;
+
+	size_t added = lazybiosCountStructsByType(ctx->DMIData, 17);
+	if (added > SIZE_MAX - columns->count ||
+		columns_reserve(columns, type17_columns, COLUMN_COUNT(type17_columns), &columns->capacity, columns->count + added) != 0)
+		return -1;
+	columns_clear_rows(columns, type17_columns, COLUMN_COUNT(type17_columns), columns->count, columns->count + added);
+
+	// Rows are written past count and only published once every row succeeded.
+	size_t row = columns->count;
+	while (row < columns->count + added && lazybiosIterNext(&it)) {
+		const lazybiosType17_t* record = lazybiosIterRecord(&it);
+		if (!record) continue;
+
+		uint32_t id = 0;
+		if (LAZYBIOS_FIELD_STATUS(record, manufacturer) == LAZYBIOS_FIELD_PRESENT &&
+			type17_intern(columns, record->manufacturer, &id) != 0) {
+			lb_log("Failed to store Type 17 manufacturer");
+			return -1;
+		}
+
+		columns->source[row] = columns->appends;
+		columns->handle[row] = record->handle;
+		COLUMN_STORE(columns, row, record, size);
+		COLUMN_STORE(columns, row, record, extended_size);
+		COLUMN_STORE(columns, row, record, speed);
+		COLUMN_STORE(columns, row, record, configured_memory_speed);
+		COLUMN_STORE(columns, row, record, memory_type);
+		columns->manufacturer[row] = id;
+		if (LAZYBIOS_FIELD_STATUS(record, manufacturer) == LAZYBIOS_FIELD_PRESENT)
+			columns->manufacturer_present[row / 64] |= UINT64_C(1) << (row % 64);
+		row++;
+	}
+
+	columns->count = row;
+	columns->appends++;
+	return 0;
+}
+
+void lazybiosFreeColumnsType17(lazybiosType17Columns_t* columns) {
+	if (!columns) return;
+
+	columns_free(columns, type17_columns, COLUMN_COUNT(type17_columns));
+	for (size_t i = 0; i < columns->manufacturer_name_count; i++)
+		lazybiosFree(columns->manufacturer_names[i]);
+	lazybiosFree(columns->manufacturer_names);
+	memset(columns, 0, sizeof(*columns));
+}
+
+int lazybiosColumnsType4(lazybiosType4Columns_t* columns, lazybiosCTX_t* ctx) {
+	lazybiosIter_t it;
+	if (!columns || lazybiosIterBegin(&it, ctx, 4) != 0) return -1;
+
+	size_t added = lazybiosCountStructsByType(ctx->DMIData, 4);
+	if (added > SIZE_MAX - columns->count ||
+		columns_reserve(columns, type4_columns, COLUMN_COUNT(type4_columns), &columns->capacity, columns->count + added) != 0)
+		return -1;
+	columns_clear_rows(columns, type4_columns, COLUMN_COUNT(type4_columns), columns->count, columns->count + added);
+
+	size_t row = columns->count;
+	while (row < columns->count + added && lazybiosIterNext(&it)) {
+		const lazybiosType4_t* record = lazybiosIterRecord(&it);
+		if (!record) continue;
+
+		columns->source[row] = columns->appends;
+		columns->handle[row] = record->handle;
+		COLUMN_STORE(columns, row, record, core_count);
+		COLUMN_STORE(columns, row, record, core_enabled);
+		COLUMN_STORE(columns, row, record, thread_count);
+		COLUMN_STORE(columns, row, record, core_count_2);
+		COLUMN_STORE(columns, row, record, core_enabled_2);
+		COLUMN_STORE(columns, row, record, thread_count_2);
+		COLUMN_STORE(columns, row, record, thread_enabled);
+		row++;
+	}
+
+	columns->count = row;
+	columns->appends++;
+	return 0;
+}
+
+void lazybiosFreeColumnsType4(lazybiosType4Columns_t* columns) {
+	if (!columns) return;
+
+	columns_free(columns, type4_columns, COLUMN_COUNT(type4_columns));
+	memset(columns, 0, sizeof(*columns));
+}
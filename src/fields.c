@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file fields.c
+ * @brief Decodes fixed-offset structure fields from per-type descriptor tables.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+static uint64_t load_le(const uint8_t* bytes, uint8_t width) {
+	uint64_t value = 0;
+	for (uint8_t i = 0; i < width; i++)
+		value |= (uint64_t)bytes[i] << (8 * i);
+	return value;
+}
+
+static void store_integer(uint8_t* member, uint8_t size, uint64_t value) {
+	switch (size) {
+		case 1: { uint8_t v = (uint8_t)value; memcpy(member, &v, 1); break; }
+		case 2: { uint16_t v = (uint16_t)value; memcpy(member, &v, 2); break; }
+		case 4: { uint32_t v = (uint32_t)value; memcpy(member, &v, 4); break; }
+		default: memcpy(member, &value, 8); break;
+	}
+}
+
+static void set_status(uint8_t* record, const lazybiosFieldDesc* field, lazybiosFieldStatus_t status) {
+	lazybiosFieldStatusSet((uint64_t*)(void*)(record + field->status), field->index, status);
+}
+
+void lazybiosDecodeFields(void* record, const lazybiosFieldDesc* fields, const lazybiosStructCursor* cursor) {
+	uint8_t* base = record;
+	const uint8_t* p = cursor->p;
+	const size_t len = cursor->length;
+	const uint16_t version = lazybiosSMBIOSVersion(cursor->DMIData);
+
+	for (const lazybiosFieldDesc* field = fields; field->name; field++) {
+		uint8_t* member = base + field->record;
+
+		if (version < (uint16_t)(field->major << 8 | field->minor)) {
+			memset(member, 0, field->size);
+			set_status(base, field, (field->flags & LAZYBIOS_FIELD_GATED) ?
+				LAZYBIOS_FIELD_UNREACHABLE : LAZYBIOS_FIELD_ABSENT);
+		} else if (len < (size_t)field->offset + field->width) {
+			memset(member, 0, field->size);
+			set_status(base, field, LAZYBIOS_FIELD_ABSENT);
+		} else if (field->kind == LAZYBIOS_FIELD_STRING) {
+			const char* string = lazybiosStructCursorString(cursor, p[field->offset]);
+			memcpy(member, &string, sizeof(string));
+			set_status(base, field, string ? LAZYBIOS_FIELD_PRESENT : LAZYBIOS_FIELD_ABSENT);
+		} else {
+			store_integer(member, field->size, load_le(p + field->offset, field->width));
+			set_status(base, field, LAZYBIOS_FIELD_PRESENT);
+		}
+	}
+}
+
+uint64_t lazybiosFieldInteger(const void* record, const lazybiosFieldDesc* field) {
+	const uint8_t* member = (const uint8_t*)record + field->record;
+	switch (field->size) {
+		case 1: return *member;
+		case 2: { uint16_t v; memcpy(&v, member, 2); return v; }
+		case 4: { uint32_t v; memcpy(&v, member, 4); return v; }
+		default: { uint64_t v; memcpy(&v, member, 8); return v; }
+	}
+}
+
+const char* lazybiosFieldString(const void* record, const lazybiosFieldDesc* field) {
+	const char* string;
+	memcpy(&string, (const uint8_t*)record + field->record, sizeof(string));
+	return string;
+}
+
+lazybiosFieldStatus_t lazybiosFieldGetStatus(const void* record, const lazybiosFieldDesc* field) {
+	return lazybiosFieldStatusGet((const uint64_t*)(const void*)((const uint8_t*)record + field->status), field->index);
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file hash.c
+ * @brief Hashes tables for cache keys and change detection.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+static uint64_t hash_mix(uint64_t hash, uint64_t word) {
+	hash = (hash ^ word) * UINT64_C(0x9E3779B97F4A7C15);
+	return hash ^ (hash >> 29);
+}
+
+/*
+ * Eight bytes at a time in four independent lanes, so the multiplies overlap
+ * instead of forming one long dependency chain. The lanes are kept in scalars:
+ * as an array, compilers vectorize them with SSE2, which has no 64-bit
+ * multiply and ends up several times slower. The lanes are then folded in
+ * both directions to give two words.
+ */
+void lazybiosHash128(uint64_t seed, const uint8_t* data, size_t len, uint64_t out[2]) {
+	uint64_t l0 = seed, l1 = seed + 1, l2 = seed + 2, l3 = seed + 3;
+	size_t i = 0;
+	for (; len - i >= 32; i += 32) {
+		uint64_t words[4];
+		memcpy(words, data + i, sizeof(words));
+		l0 = hash_mix(l0, words[0]);
+		l1 = hash_mix(l1, words[1]);
+		l2 = hash_mix(l2, words[2]);
+		l3 = hash_mix(l3, words[3]);
+	}
+
+	uint64_t tail[4] = {0};
+	if (len > i) memcpy(tail, data + i, len - i);
+	l0 ^= tail[0];
+	l1 ^= tail[1];
+	l2 ^= tail[2];
+	l3 ^= tail[3];
+	out[0] = hash_mix(hash_mix(hash_mix(hash_mix(hash_mix(seed, len), l0), l1), l2), l3);
+	out[1] = hash_mix(hash_mix(hash_mix(hash_mix(hash_mix(~seed, len), l3), l2), l1), l0);
+}
+
+uint64_t lazybiosHash64(uint64_t seed, const uint8_t* data, size_t len) {
+	uint64_t out[2];
+	lazybiosHash128(seed, data, len, out);
+	return out[0];
+}
+
+void lazybiosFingerprintEntry(const uint8_t* entry_data, size_t entry_len, uint8_t out[16]) {
+	uint64_t words[2];
+	lazybiosHash128(0, entry_data, entry_len, words);
+	memcpy(out, words, sizeof(words));
+}
+
+int lazybiosFingerprint(const lazybiosCTX_t* ctx, uint8_t out[LAZYBIOS_FINGERPRINT_SIZE]) {
+	if (!ctx || !ctx->DMIData || !out || !ctx->DMIData->entry_data || !ctx->DMIData->dmi_data) return -1;
+
+	const lazybiosDMI_t* DMIData = ctx->DMIData;
+	uint64_t words[2];
+	lazybiosHash128(lazybiosHash64(0, DMIData->entry_data, DMIData->entry_len),
+		DMIData->dmi_data, DMIData->dmi_len, words);
+	memcpy(out, words, sizeof(words));
+	lazybiosFingerprintEntry(DMIData->entry_data, DMIData->entry_len, out + 16);
+	return 0;
+}
+
+int lazybiosFingerprintChanged(const uint8_t fingerprint[LAZYBIOS_FINGERPRINT_SIZE]) {
+	if (!fingerprint) return -1;
+	#if defined(OS_LINUX)
+	return lazybiosLinuxEntryChanged(fingerprint, LINUX_SYSFS_SMBIOS_ENTRY);
+	#else
+	return -1;
+	#endif
+}
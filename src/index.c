@@ -0,0 +1,334 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file index.c
+ * @brief Builds the per-table structure index and the cursors that read it.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <string.h>
+
+#define INDEX_INITIAL_CAPACITY 64
+#define INDEX_MAX_STRINGS UINT8_MAX
+// A direct handle table may hold at most this many slots per structure.
+#define INDEX_DIRECT_HANDLE_RATIO 4
+
+static size_t handle_hash(uint16_t handle, size_t slots) {
+	return (size_t)((uint32_t)handle * 0x9E3779B1u >> 16) & (slots - 1);
+}
+
+/*
+ * Records the start of every string DMIString() would return for the
+ * structure at p, whose string-set ends at next. DMIString() gives up on the
+ * whole set when the first string is empty or no terminator lies inside the
+ * table, and string numbers are one byte wide; the slots follow the same rules.
+ */
+static int index_strings(const lazybiosAllocator_t* allocator, lazybiosDMIIndex_t* index,
+	lazybiosIndexEntry* entry, const uint8_t* start, const uint8_t* p, const uint8_t* next, size_t* capacity) {
+	entry->first_string = (uint32_t)index->string_count;
+	entry->string_count = 0;
+
+	if (entry->length < SMBIOS_HEADER_SIZE || p[1] != entry->length ||
+		(size_t)(next - p) < (size_t)entry->length + 2 || next[-2] != 0 || next[-1] != 0)
+		return 0;
+
+	const uint8_t* str = p + entry->length;
+	const uint8_t* strings_end = next - 2;
+	while (str < strings_end && *str != 0 && entry->string_count < INDEX_MAX_STRINGS) {
+		if (index->string_count == *capacity) {
+			size_t grown = *capacity ? *capacity * 2 : INDEX_INITIAL_CAPACITY;
+			uint32_t* strings = lazybiosAllocatorRealloc(allocator, index->strings,
+				*capacity * sizeof(*strings), grown * sizeof(*strings));
+			if (!strings) return -1;
+			index->strings = strings;
+			*capacity = grown;
+		}
+		index->strings[index->string_count++] = (uint32_t)(str - start);
+		entry->string_count++;
+
+		const uint8_t* nul = memchr(str, 0, (size_t)(strings_end - str));
+		if (!nul) break;
+		str = nul + 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Firmware usually numbers handles from zero upwards, so a table indexed by
+ * the handle is only a few times larger than the structure count. Tables with
+ * sparse handles get an open-addressed table at most twice their count instead.
+ */
+static int index_handles(const lazybiosAllocator_t* allocator, lazybiosDMIIndex_t* index) {
+	uint16_t max_handle = 0;
+	for (size_t i = 0; i < index->count; i++)
+		if (index->entries[i].handle > max_handle) max_handle = index->entries[i].handle;
+
+	size_t direct_slots = (size_t)max_handle + 1;
+	if (direct_slots <= index->count * INDEX_DIRECT_HANDLE_RATIO || direct_slots <= INDEX_INITIAL_CAPACITY) {
+		index->handles = lazybiosAllocatorCalloc(allocator, direct_slots, sizeof(*index->handles));
+		if (!index->handles) return -1;
+		index->handle_slots = direct_slots;
+		index->handles_hashed = 0;
+
+		for (size_t i = 0; i < index->count; i++) {
+			uint32_t* slot = &index->handles[index->entries[i].handle];
+			if (*slot == 0) *slot = (uint32_t)i + 1;
+		}
+		return 0;
+	}
+
+	size_t slots = INDEX_INITIAL_CAPACITY;
+	while (slots < index->count * 2) slots *= 2;
+	index->handles = lazybiosAllocatorCalloc(allocator, slots, sizeof(*index->handles));
+	if (!index->handles) return -1;
+	index->handle_slots = slots;
+	index->handles_hashed = 1;
+
+	for (size_t i = 0; i < index->count; i++) {
+		uint16_t handle = index->entries[i].handle;
+		size_t slot = handle_hash(handle, slots);
+		while (index->handles[slot] != 0 && index->entries[index->handles[slot] - 1].handle != handle)
+			slot = (slot + 1) & (slots - 1);
+		if (index->handles[slot] == 0) index->handles[slot] = (uint32_t)i + 1;
+	}
+	return 0;
+}
+
+int lazybiosBuildIndex(lazybiosDMI_t* DMIData) {
+	if (!DMIData) return -1;
+
+	lazybiosFreeIndex(DMIData);
+	if (!DMIData->dmi_data || DMIData->dmi_len > UINT32_MAX) return -1;
+
+	const lazybiosAllocator_t* allocator = &DMIData->allocator;
+	lazybiosDMIIndex_t* index = lazybiosAllocatorCalloc(allocator, 1, sizeof(*index));
+	if (!index) return -1;
+
+	const uint8_t* start = DMIData->dmi_data;
+	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
+	const uint8_t* p = start;
+	size_t capacity = 0;
+	size_t strings_capacity = 0;
+
+	// Same bounds as the original counting walk: stop at the end-of-table marker.
+	while (p + SMBIOS_HEADER_SIZE < end) {
+		if (p[0] == SMBIOS_TYPE_END) break;
+
+		if (index->count == capacity) {
+			size_t grown = capacity ? capacity * 2 : INDEX_INITIAL_CAPACITY;
+			lazybiosIndexEntry* entries = lazybiosAllocatorRealloc(allocator, index->entries,
+				capacity * sizeof(*entries), grown * sizeof(*entries));
+			if (!entries) goto fail;
+			index->entries = entries;
+			capacity = grown;
+		}
+
+		uint8_t len = p[1];
+		LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
+		const uint8_t* next = DMINext(p, end);
+
+		lazybiosIndexEntry* entry = &index->entries[index->count++];
+		entry->offset = (uint32_t)(p - start);
+		entry->next = (uint32_t)(next - start);
+		entry->handle = (uint16_t)(p[2] | (p[3] << 8));
+		entry->type = p[0];
+		entry->length = len;
+		if (index_strings(allocator, index, entry, start, p, next, &strings_capacity) != 0) goto fail;
+
+		p = next;
+	}
+
+	// Counting sort by type keeps table order within each type.
+	for (size_t i = 0; i < index->count; i++)
+		index->type_start[index->entries[i].type + 1]++;
+	for (size_t t = 1; t < 257; t++)
+		index->type_start[t] += index->type_start[t - 1];
+
+	if (index->count > 0) {
+		uint32_t fill[256];
+		memcpy(fill, index->type_start, sizeof(fill));
+
+		index->by_type = lazybiosAllocatorMalloc(allocator, index->count * sizeof(*index->by_type));
+		if (!index->by_type) goto fail;
+		for (size_t i = 0; i < index->count; i++) {
+			lazybiosIndexEntry* entry = &index->entries[i];
+			entry->ordinal = fill[entry->type] - index->type_start[entry->type];
+			index->by_type[fill[entry->type]++] = (uint32_t)i;
+		}
+	}
+
+	if (index_handles(allocator, index) != 0) goto fail;
+
+	DMIData->index = index;
+	return 0;
+
+fail:
+	lazybiosAllocatorFree(allocator, index->entries);
+	lazybiosAllocatorFree(allocator, index->by_type);
+	lazybiosAllocatorFree(allocator, index->strings);
+	lazybiosAllocatorFree(allocator, index);
+	return -1;
+}
+
+void lazybiosFreeIndex(lazybiosDMI_t* DMIData) {
+	if (!DMIData || !DMIData->index) return;
+
+	const lazybiosAllocator_t* allocator = &DMIData->allocator;
+	if (!DMIData->index->borrowed) {
+		lazybiosAllocatorFree(allocator, DMIData->index->entries);
+		lazybiosAllocatorFree(allocator, DMIData->index->by_type);
+		lazybiosAllocatorFree(allocator, DMIData->index->strings);
+		lazybiosAllocatorFree(allocator, DMIData->index->handles);
+	}
+	lazybiosAllocatorFree(allocator, DMIData->index);
+	DMIData->index = NULL;
+}
+
+const lazybiosIndexEntry* lazybiosIndexFindHandle(const lazybiosDMIIndex_t* index, uint16_t handle) {
+	if (!index || !index->handles) return NULL;
+
+	if (!index->handles_hashed) {
+		if (handle >= index->handle_slots || index->handles[handle] == 0) return NULL;
+		return &index->entries[index->handles[handle] - 1];
+	}
+
+	size_t slot = handle_hash(handle, index->handle_slots);
+	while (index->handles[slot] != 0) {
+		const lazybiosIndexEntry* entry = &index->entries[index->handles[slot] - 1];
+		if (entry->handle == handle) return entry;
+		slot = (slot + 1) & (index->handle_slots - 1);
+	}
+	return NULL;
+}
+
+void lazybiosStructCursorInit(lazybiosStructCursor* cursor, const lazybiosDMI_t* DMIData, uint8_t type) {
+	memset(cursor, 0, sizeof(*cursor));
+	cursor->DMIData = DMIData;
+	cursor->type = type;
+
+	if (DMIData && DMIData->dmi_data) {
+		cursor->walk = DMIData->dmi_data;
+		cursor->end = DMIData->dmi_data + DMIData->dmi_len;
+	}
+}
+
+void lazybiosStructCursorInitAll(lazybiosStructCursor* cursor, const lazybiosDMI_t* DMIData) {
+	lazybiosStructCursorInit(cursor, DMIData, 0);
+	cursor->all_types = 1;
+}
+
+int lazybiosStructCursorNext(lazybiosStructCursor* cursor) {
+	if (!cursor->walk) return 0;
+
+	const lazybiosDMIIndex_t* index = cursor->DMIData->index;
+	if (index) {
+		const lazybiosIndexEntry* entry;
+		if (cursor->all_types) {
+			if (cursor->position >= index->count) return 0;
+			entry = &index->entries[cursor->position++];
+		} else {
+			size_t slot = index->type_start[cursor->type] + cursor->position;
+			if (slot >= index->type_start[cursor->type + 1]) return 0;
+			cursor->position++;
+			entry = &index->entries[index->by_type[slot]];
+		}
+
+		cursor->p = cursor->DMIData->dmi_data + entry->offset;
+		cursor->structure_end = cursor->DMIData->dmi_data + entry->next;
+		cursor->entry = entry;
+		cursor->handle = entry->handle;
+		cursor->length = entry->length;
+		return 1;
+	}
+
+	while (cursor->walk + SMBIOS_HEADER_SIZE <= cursor->end) {
+		const uint8_t* p = cursor->walk;
+		// Walking every type stops where the index and the structure counts do.
+		if (cursor->all_types && (p + SMBIOS_HEADER_SIZE == cursor->end || p[0] == SMBIOS_TYPE_END))
+			return 0;
+		cursor->walk = DMINext(p, cursor->end);
+		if (!cursor->all_types && p[0] != cursor->type) continue;
+
+		uint8_t len = p[1];
+		LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, cursor->end);
+		cursor->p = p;
+		cursor->structure_end = cursor->walk;
+		cursor->handle = (uint16_t)(p[2] | (p[3] << 8));
+		cursor->length = len;
+		return 1;
+	}
+
+	return 0;
+}
+
+// Every parsed record starts with the handle of the structure it came from.
+static const void* handle_record(const lazybiosCTX_t* ctx, uint8_t type, size_t ordinal, uint16_t handle) {
+	const lazybiosTypeInfo* slot = &lazybiosTypeTable[type];
+	if (!slot->decode) return NULL;
+
+	const uint8_t* records = *(const uint8_t* const*)((const uint8_t*)ctx + slot->records);
+	size_t count = *(const size_t*)((const uint8_t*)ctx + slot->count);
+	if (!records || ordinal >= count) return NULL;
+
+	const uint8_t* record = records + ordinal * slot->size;
+	uint16_t record_handle;
+	memcpy(&record_handle, record, sizeof(record_handle));
+	return record_handle == handle ? record : NULL;
+}
+
+int lazybiosFindByHandle(const lazybiosCTX_t* ctx, uint16_t handle, lazybiosHandleRef_t* ref) {
+	if (!ctx || !ctx->DMIData || !ctx->DMIData->dmi_data || !ref) return -1;
+
+	const lazybiosDMI_t* DMIData = ctx->DMIData;
+	const uint8_t* p = NULL;
+	uint8_t len = 0;
+	size_t ordinal = 0;
+
+	if (DMIData->index) {
+		const lazybiosIndexEntry* entry = lazybiosIndexFindHandle(DMIData->index, handle);
+		if (!entry) return -1;
+		p = DMIData->dmi_data + entry->offset;
+		len = entry->length;
+		ordinal = entry->ordinal;
+	} else {
+		// No index: walk the table the same way the index builder does.
+		uint32_t seen[256] = {0};
+		const uint8_t* walk = DMIData->dmi_data;
+		const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
+		while (walk + SMBIOS_HEADER_SIZE < end && walk[0] != SMBIOS_TYPE_END) {
+			if ((uint16_t)(walk[2] | (walk[3] << 8)) == handle) {
+				p = walk;
+				len = walk[1];
+				LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
+				ordinal = seen[walk[0]];
+				break;
+			}
+			seen[walk[0]]++;
+			walk = DMINext(walk, end);
+		}
+		if (!p) return -1;
+	}
+
+	ref->type = p[0];
+	ref->length = len;
+	ref->raw = p;
+	ref->record = handle_record(ctx, p[0], ordinal, handle);
+	return 0;
+}
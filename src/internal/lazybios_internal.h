@@ -190,19 +190,29 @@ static inline void lazybiosDecoderAppend(char* buf, size_t buf_len, size_t* len,
 
 /** @brief Marks a parsed structure field as present and valid. */
 #define LAZYBIOS_MARK_PRESENT(record, field) do { \
-    (record)->field_status.field = LAZYBIOS_FIELD_PRESENT; \
+    LAZYBIOS_SET_FIELD_STATUS((record), field, LAZYBIOS_FIELD_PRESENT); \
 } while (0)
 
 /** @brief Marks a parsed structure field as absent. */
 #define LAZYBIOS_MARK_ABSENT(record, field) do { \
-    (record)->field_status.field = LAZYBIOS_FIELD_ABSENT; \
+    LAZYBIOS_SET_FIELD_STATUS((record), field, LAZYBIOS_FIELD_ABSENT); \
 } while (0)
 
 /** @brief Marks a parsed structure field as unreachable (structure too short for newer spec version). */
 #define LAZYBIOS_MARK_UNREACHABLE(record, field) do { \
-    (record)->field_status.field = LAZYBIOS_FIELD_UNREACHABLE; \
+    LAZYBIOS_SET_FIELD_STATUS((record), field, LAZYBIOS_FIELD_UNREACHABLE); \
 } while (0)
 
+/**
+ * @brief Fails to compile unless a field index has positions 0 to fields - 1 and its status words hold them.
+ *
+ * Index members are hand-sized char arrays of 1 to fields bytes, so a skipped
+ * or repeated size, which would alias two fields' status bits, breaks the sum.
+ */
+#define LAZYBIOS_CHECK_FIELD_INDEX(status_type, index_type, fields) \
+	typedef char index_type##_positions[sizeof(index_type) == (fields) * ((fields) + 1) / 2 ? 1 : -1]; \
+	typedef char index_type##_words[(fields) <= 32 * (sizeof(((status_type*)0)->bits) / sizeof(uint64_t)) ? 1 : -1]
+
 /** @brief Clamps a structure length against available buffer boundaries. */
 #define LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end) do { \
 	if ((size_t)((end) - (p)) < (size_t)(len)) { \
@@ -225,8 +235,111 @@ typedef struct {
 
 /** @brief Inspects and validates an SMBIOS 2.x or 3.x entry point. */
 int lazybiosInspectEntryPoint(const uint8_t* entry_data, size_t available, lazybiosEntryInspection* inspection);
+/**
+ * @brief Hands entry-point and DMI-table buffers to a context without copying them.
+ *
+ * On success the context releases both with its allocator, unless the caller
+ * then marks the table as mapped or borrowed; on failure the caller keeps them.
+ * flags takes LAZYBIOS_LOAD_NO_INDEX.
+ */
+int lazybiosAdoptBuffers(lazybiosCTX_t* ctx, uint8_t* entry_data, size_t entry_len, uint8_t* dmi_data, size_t dmi_len, unsigned flags);
 /** @brief Copies validated raw entry-point and DMI-table buffers into a context. */
 int lazybiosLoadRawBuffers(lazybiosCTX_t* ctx, const uint8_t* entry_data, size_t entry_len, const uint8_t* dmi_data, size_t dmi_len);
+/**
+ * @brief Borrows the table of a merged dump already in memory, as lazybiosSingleFile() lays it out.
+ *
+ * The entry point is copied and the table is read in place until cleanup, so
+ * file must outlive the load; the context never frees it.
+ */
+int lazybiosLoadMergedBorrowed(lazybiosCTX_t* ctx, const uint8_t* file, size_t file_len);
+/** @brief Maps a whole regular file read-only; -1 where mapping is unsupported or the file is empty. */
+int lazybiosMapFile(const char* path, void** base, size_t* len);
+/** @brief Releases a mapping made by lazybiosMapFile(). */
+void lazybiosUnmapFile(void* base, size_t len);
+/** @brief Hashes data eight bytes at a time into two words; not cryptographic. */
+void lazybiosHash128(uint64_t seed, const uint8_t* data, size_t len, uint64_t out[2]);
+/** @brief First word of lazybiosHash128(), for keys that fit in 64 bits. */
+uint64_t lazybiosHash64(uint64_t seed, const uint8_t* data, size_t len);
+/** @brief Computes the entry-point half of a fingerprint, its last 16 bytes. */
+void lazybiosFingerprintEntry(const uint8_t* entry_data, size_t entry_len, uint8_t out[16]);
+/** @brief Legacy BIOS address scanned for an entry point when firmware reports none. */
+#define LAZYBIOS_PHYS_SCAN_START UINT64_C(0xF0000)
+/** @brief Bytes of physical memory scanned for an entry point. */
+#define LAZYBIOS_PHYS_SCAN_SIZE 0x10000U
+/**
+ * @brief Loads SMBIOS data from a physical-memory device such as /dev/mem.
+ *
+ * Scans LAZYBIOS_PHYS_SCAN_SIZE bytes from scan_base for an entry point and
+ * reads only that window and the table it names. Any readable file laid out
+ * like physical memory works, which is how the tests drive it.
+ */
+int lazybiosLoadPhysicalMemory(lazybiosCTX_t* ctx, const char* path, uint64_t scan_base);
+/** @brief Size of the paths lazybiosDumpPath() builds. */
+#define LAZYBIOS_DUMP_PATH_MAX 4096
+/** @brief Files lazybiosLoadDump() probes in a dump directory, in the order it probes them. */
+enum { LAZYBIOS_DUMP_ENTRY, LAZYBIOS_DUMP_DMI, LAZYBIOS_DUMP_BIN };
+/**
+ * @brief Builds the path of one file of a dump directory, for every loader that takes dumps.
+ *
+ * The pair is `smbios_entry_point` and `DMI`; the merged file is named after
+ * the directory with `.bin` appended. Returns -1 if the path does not fit.
+ */
+int lazybiosDumpPath(char out[LAZYBIOS_DUMP_PATH_MAX], const char* dir, int file);
+#if defined(OS_LINUX) && defined(LAZYBIOS_HAVE_IO_URING)
+/**
+ * @brief lazybiosBulkLoad() without its fallback.
+ * @return 1 if io_uring or an operation it needs is unavailable, else as lazybiosBulkLoad().
+ */
+int lazybiosBulkLoadUring(const char* const* paths, size_t n, unsigned depth, lazybiosBatchFn callback, void* user);
+#endif
+/** @brief Worker thread started by lazybiosThreadStart(). */
+typedef struct lazybiosThread lazybiosThread;
+/** @brief Runs fn(arg) on a new thread; NULL where threads are unsupported or cannot start. */
+lazybiosThread* lazybiosThreadStart(void (*fn)(void* arg), void* arg);
+/** @brief Waits for a thread to return and releases it; NULL is ignored. */
+void lazybiosThreadJoin(lazybiosThread* thread);
+/** @brief Number of online CPUs, at least 1. */
+unsigned lazybiosCPUCount(void);
+
+/*
+ * Work counters shared by worker threads. Claims only need to be unique, and
+ * thread start and join order everything else, so they are all relaxed.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+static inline size_t lazybiosAtomicFetchAdd(volatile size_t* value, size_t n) {
+#if defined(_WIN64)
+	return (size_t)_InterlockedExchangeAdd64((volatile __int64*)value, (__int64)n);
+#else
+	return (size_t)_InterlockedExchangeAdd((volatile long*)value, (long)n);
+#endif
+}
+
+static inline size_t lazybiosAtomicLoad(volatile size_t* value) {
+	return lazybiosAtomicFetchAdd(value, 0);
+}
+
+static inline void lazybiosAtomicStore(volatile size_t* value, size_t n) {
+#if defined(_WIN64)
+	_InterlockedExchange64((volatile __int64*)value, (__int64)n);
+#else
+	_InterlockedExchange((volatile long*)value, (long)n);
+#endif
+}
+#else
+static inline size_t lazybiosAtomicFetchAdd(volatile size_t* value, size_t n) {
+	return __atomic_fetch_add(value, n, __ATOMIC_RELAXED);
+}
+
+static inline size_t lazybiosAtomicLoad(volatile size_t* value) {
+	return __atomic_load_n(value, __ATOMIC_RELAXED);
+}
+
+static inline void lazybiosAtomicStore(volatile size_t* value, size_t n) {
+	__atomic_store_n(value, n, __ATOMIC_RELAXED);
+}
+#endif
+
 /** @brief Loads the Windows raw SMBIOS table format into a context. */
 int lazybiosLoadWindowsRawSMBIOSData(lazybiosCTX_t* ctx, const uint8_t* raw_data, size_t raw_len);
 /** @brief Finds a valid SMBIOS entry point within a memory image. */
@@ -254,6 +367,21 @@ const char* DMIString(const uint8_t* p, uint8_t length, uint8_t index, const uin
  */
 const uint8_t* DMINext(const uint8_t* p, const uint8_t* end);
 
+/**
+ * @brief Finds the first pair of consecutive NUL bytes in a buffer.
+ *
+ * Uses the widest vector unit available (SSE2 or AVX2 on x86-64, NEON on
+ * AArch64), selected once when the library is loaded.
+ *
+ * @param p First byte to examine.
+ * @param end One-past-the-end address of the buffer.
+ * @return Address of the first NUL of the pair, or NULL if no pair lies before end.
+ */
+const uint8_t* lazybiosFindDoubleNul(const uint8_t* p, const uint8_t* end);
+
+/** @brief Byte-at-a-time lazybiosFindDoubleNul(), used on other targets and for tails. */
+const uint8_t* lazybiosFindDoubleNulScalar(const uint8_t* p, const uint8_t* end);
+
 /**
  * @brief Counts SMBIOS structures having a specified type identifier.
  * @param DMIData Raw DMI table container to inspect.
@@ -262,6 +390,484 @@ const uint8_t* DMINext(const uint8_t* p, const uint8_t* end);
  */
 size_t lazybiosCountStructsByType(const lazybiosDMI_t* DMIData, uint8_t target_type);
 
+/**
+ * @brief One structure of a DMI table, recorded once when the table is loaded.
+ *
+ * Offsets are relative to dmi_data. The formatted length is already clamped to
+ * the table end, and next is the offset DMINext() returns for the structure,
+ * which is one past its string-set terminator. String n of the structure
+ * starts at strings[first_string + n - 1] of the owning index, and ordinal is
+ * the structure's position among those of its type, which is also the
+ * position of its parsed record in the matching context array.
+ */
+typedef struct {
+	uint32_t offset;
+	uint32_t next;
+	uint32_t first_string;
+	uint32_t ordinal;
+	uint16_t handle;
+	uint8_t type;
+	uint8_t length;
+	uint8_t string_count;
+} lazybiosIndexEntry;
+
+/**
+ * @brief Structure index over a loaded DMI table.
+ *
+ * entries holds every structure before the end-of-table marker in table order.
+ * by_type lists entry positions grouped by type, so the entries of type t are
+ * by_type[type_start[t]] up to by_type[type_start[t + 1]], still in table order.
+ * strings holds the dmi_data offset of every string DMIString() can return,
+ * shared by all entries.
+ *
+ * handles maps structure handles to entry positions plus one, zero marking an
+ * empty slot. When handles_hashed is zero it is indexed by the handle itself;
+ * otherwise it is an open-addressed table of handle_slots (a power of two)
+ * probed linearly from a multiplicative hash of the handle. The first
+ * structure carrying a duplicated handle wins.
+ *
+ * borrowed is set when the arrays point into a cache file the context has
+ * mapped, in which case releasing the index frees only this header.
+ */
+struct lazybiosDMIIndex {
+	lazybiosIndexEntry* entries;
+	size_t count;
+	uint32_t* by_type;
+	uint32_t type_start[257];
+	uint32_t* strings;
+	size_t string_count;
+	uint32_t* handles;
+	size_t handle_slots;
+	int handles_hashed;
+	int borrowed;
+};
+
+/**
+ * @brief Looks up the index entry of the structure carrying a handle.
+ * @return The entry, or NULL if no indexed structure uses the handle.
+ */
+const lazybiosIndexEntry* lazybiosIndexFindHandle(const lazybiosDMIIndex_t* index, uint16_t handle);
+
+/**
+ * @brief Builds the structure index for the table held by a DMI container.
+ * @param DMIData Container whose dmi_data and dmi_len are set.
+ * @return 0 on success, or -1 if the table cannot be indexed; DMIData->index is NULL on failure.
+ */
+int lazybiosBuildIndex(lazybiosDMI_t* DMIData);
+
+/**
+ * @brief Releases the structure index of a DMI container, if any.
+ * @param DMIData Container to update.
+ */
+void lazybiosFreeIndex(lazybiosDMI_t* DMIData);
+
+/**
+ * @brief Allocates through an allocator's hooks.
+ * @param allocator Hooks to use; NULL or a zeroed allocator selects the global hooks.
+ */
+void* lazybiosAllocatorMalloc(const lazybiosAllocator_t* allocator, size_t size);
+
+/** @brief Like lazybiosAllocatorMalloc(), zero-filled and checked for count * size overflow. */
+void* lazybiosAllocatorCalloc(const lazybiosAllocator_t* allocator, size_t count, size_t size);
+
+/**
+ * @brief Resizes memory from an allocator, keeping the first old_size bytes.
+ *
+ * Hooks have no resize operation, so custom allocators copy into a new block.
+ * @return The resized block, or NULL with ptr untouched on failure.
+ */
+void* lazybiosAllocatorRealloc(const lazybiosAllocator_t* allocator, void* ptr, size_t old_size, size_t new_size);
+
+/** @brief Releases memory obtained from the same allocator; NULL is ignored. */
+void lazybiosAllocatorFree(const lazybiosAllocator_t* allocator, void* ptr);
+
+/** @brief Returns the global hooks, so a new context can keep the ones it was created with. */
+lazybiosAllocator_t lazybiosGlobalAllocator(void);
+/**
+ * @brief Tells whether an allocator resolves to the default malloc() and free().
+ *
+ * Only those are known to be thread-safe, so the library calls no other
+ * hooks from more than one of its own threads at a time.
+ */
+int lazybiosAllocatorIsDefault(const lazybiosAllocator_t* allocator);
+
+/** @brief Allocates zero-filled memory from the global hooks. */
+static inline void* lazybiosCalloc(size_t count, size_t size) {
+	return lazybiosAllocatorCalloc(NULL, count, size);
+}
+
+/** @brief Releases memory from the global hooks. */
+static inline void lazybiosFree(void* ptr) {
+	lazybiosAllocatorFree(NULL, ptr);
+}
+
+/**
+ * @brief Bump allocator for the arrays a context parses for itself.
+ *
+ * Memory comes from chunks that are never reused, so every allocation is
+ * zero-filled, and it is all released at once by lazybiosArenaFree(), or
+ * handed back for reuse by lazybiosArenaReset().
+ */
+struct lazybiosArena {
+	struct lazybiosArenaChunk* chunks;
+	size_t chunk_size;
+	lazybiosAllocator_t allocator; /**< Hooks the arena and its chunks come from. */
+};
+
+/**
+ * @brief Creates an arena whose first chunk suits a table of a given length.
+ * @return The arena, or NULL if it cannot be allocated.
+ */
+lazybiosArena_t* lazybiosArenaNew(const lazybiosAllocator_t* allocator, size_t table_len);
+
+/**
+ * @brief Returns zero-filled memory for count objects of size bytes.
+ * @return Memory aligned for any record type, or NULL if the size overflows or
+ * a chunk cannot be allocated. Like calloc(), a zero-sized request still
+ * returns a distinct pointer.
+ */
+void* lazybiosArenaAlloc(lazybiosArena_t* arena, size_t count, size_t size);
+
+/** @brief Reports whether ptr points into memory handed out by an arena. */
+int lazybiosArenaOwns(const lazybiosArena_t* arena, const void* ptr);
+
+/**
+ * @brief Releases every allocation made from an arena but keeps its newest chunk.
+ *
+ * The kept chunk is cleared, so a context that is reused for table after
+ * table stops allocating once its arena has grown to fit.
+ */
+void lazybiosArenaReset(lazybiosArena_t* arena);
+
+/**
+ * @brief Moves every chunk of other into arena and frees other's header.
+ *
+ * Both arenas must use the same hooks. Allocations made from other stay
+ * valid and are released with arena from then on.
+ */
+void lazybiosArenaAdopt(lazybiosArena_t* arena, lazybiosArena_t* other);
+
+/** @brief Releases an arena and every allocation made from it. */
+void lazybiosArenaFree(lazybiosArena_t* arena);
+
+/**
+ * @brief Cursor over the structures of one type.
+ *
+ * Uses the table index when one was built and walks the table with DMINext()
+ * otherwise, so parsers work the same on hand-assembled DMI containers.
+ */
+typedef struct {
+	const lazybiosDMI_t* DMIData;
+	const uint8_t* walk;
+	const uint8_t* end;
+	size_t position;
+	uint8_t type;
+	int all_types;
+
+	const uint8_t* p;                /**< Current structure. */
+	const uint8_t* structure_end;    /**< End of the current structure's string-set. */
+	const lazybiosIndexEntry* entry; /**< Index entry of the current structure, or NULL when walking. */
+	uint16_t handle;                 /**< Handle of the current structure. */
+	uint8_t length;                  /**< Clamped formatted length of the current structure. */
+	lazybiosArena_t* arena;          /**< Arena serving decoder allocations, or NULL for the heap. */
+	struct lazybiosScratch* scratch; /**< Fixed buffer tried before the arena, or NULL. */
+} lazybiosStructCursor;
+
+/** @brief Positions a cursor before the first structure of a type. */
+void lazybiosStructCursorInit(lazybiosStructCursor* cursor, const lazybiosDMI_t* DMIData, uint8_t type);
+
+/**
+ * @brief Positions a cursor before the first structure of the table, whatever its type.
+ *
+ * The cursor then visits every structure before the end-of-table marker in
+ * table order, the same structures lazybiosCountStructsByType() counts.
+ */
+void lazybiosStructCursorInitAll(lazybiosStructCursor* cursor, const lazybiosDMI_t* DMIData);
+
+/**
+ * @brief Advances a cursor to the next structure of its type.
+ * @return 1 when cursor->p names a structure, or 0 when none remain.
+ */
+int lazybiosStructCursorNext(lazybiosStructCursor* cursor);
+
+/**
+ * @brief Fixed buffer for the nested arrays of one record, such as an iterator's.
+ *
+ * Requests that do not fit come from the overflow context's arena, so they
+ * are released with the context rather than leaked.
+ */
+typedef struct lazybiosScratch {
+	uint8_t* base;
+	size_t size;
+	size_t used;
+	lazybiosCTX_t* overflow;
+} lazybiosScratch;
+
+/**
+ * @brief Allocates zero-filled memory for a decoder.
+ *
+ * Uses the cursor's scratch buffer or arena when it has one and the global
+ * allocator otherwise, so records returned by the lazybiosGetType* getters
+ * stay releasable by their free functions.
+ */
+void* lazybiosStructCursorAlloc(const lazybiosStructCursor* cursor, size_t count, size_t size);
+
+/**
+ * @brief Decodes the structure under a cursor into one parsed record.
+ *
+ * Each parsed type has one decoder, named after its getter, shared by the
+ * getter and by lazybiosParseAll().
+ *
+ * @param record Zero-filled record of the type's parsed record type.
+ * @param cursor Cursor positioned on a structure of that type.
+ * @return 0 on success, or -1 if an allocation failed. The record may then hold
+ * partial allocations, which the type's free function releases.
+ */
+typedef int (*lazybiosDecodeFn)(void* record, const lazybiosStructCursor* cursor);
+
+int lazybiosDecodeType0(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType1(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType2(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType3(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType4(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType5(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType6(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType7(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType8(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType9(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType10(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType11(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType12(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType13(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType14(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType15(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType16(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType17(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType18(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType19(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType20(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType21(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType22(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType23(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType24(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType25(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType26(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType27(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType28(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType29(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType30(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType31(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType32(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType33(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType34(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType35(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType36(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType37(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType38(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType39(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType40(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType41(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType42(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType43(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType44(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType45(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeType46(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeOemDellType177(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeOemDellType212(void* record, const lazybiosStructCursor* cursor);
+int lazybiosDecodeOemHpType204(void* record, const lazybiosStructCursor* cursor);
+
+/** @brief Returns the table's SMBIOS version as major << 8 | minor, or 0 without a parsed entry point. */
+uint16_t lazybiosSMBIOSVersion(const lazybiosDMI_t* DMIData);
+
+/** @brief How a field descriptor's bytes are interpreted. */
+typedef enum {
+	LAZYBIOS_FIELD_INTEGER = 0, /**< Little-endian integer of width bytes. */
+	LAZYBIOS_FIELD_STRING       /**< One-byte string number resolved through the string-set. */
+} lazybiosFieldKind;
+
+/** @brief Field is marked UNREACHABLE rather than ABSENT on tables older than its version. */
+#define LAZYBIOS_FIELD_GATED 0x1u
+/** @brief Field is exported by the JSON serializer under its own name. */
+#define LAZYBIOS_FIELD_JSON  0x2u
+
+/**
+ * @brief One fixed-offset field of an SMBIOS structure.
+ *
+ * A field is read when the table is at least version major.minor and the
+ * formatted section holds width bytes at offset; it is then PRESENT, except for
+ * strings whose number does not resolve, which are ABSENT like short reads.
+ * record is the offset of the field in the parsed record and size the size of
+ * the member; status is the offset of the record's status words and index the
+ * field's position in them.
+ */
+typedef struct {
+	const char* name;
+	uint16_t record;
+	uint16_t status;
+	uint8_t offset;
+	uint8_t width;
+	uint8_t size;
+	uint8_t kind;
+	uint8_t major;
+	uint8_t minor;
+	uint8_t flags;
+	uint8_t index;
+} lazybiosFieldDesc;
+
+#define LAZYBIOS_FIELD_DESC(record_type, field, kind, width, offset, major, minor, flags) \
+	{ #field, offsetof(record_type, field), offsetof(record_type, field_status), (offset), (width), \
+	  sizeof(((record_type*)0)->field), (kind), (major), (minor), (flags), \
+	  LAZYBIOS_FIELD_INDEX((record_type*)0, field) }
+
+#define LAZYBIOS_FIELD_U8(record_type, field, offset, major, minor, flags) \
+	LAZYBIOS_FIELD_DESC(record_type, field, LAZYBIOS_FIELD_INTEGER, 1, offset, major, minor, flags)
+#define LAZYBIOS_FIELD_U16(record_type, field, offset, major, minor, flags) \
+	LAZYBIOS_FIELD_DESC(record_type, field, LAZYBIOS_FIELD_INTEGER, 2, offset, major, minor, flags)
+#define LAZYBIOS_FIELD_U32(record_type, field, offset, major, minor, flags) \
+	LAZYBIOS_FIELD_DESC(record_type, field, LAZYBIOS_FIELD_INTEGER, 4, offset, major, minor, flags)
+#define LAZYBIOS_FIELD_U64(record_type, field, offset, major, minor, flags) \
+	LAZYBIOS_FIELD_DESC(record_type, field, LAZYBIOS_FIELD_INTEGER, 8, offset, major, minor, flags)
+#define LAZYBIOS_FIELD_STR(record_type, field, offset, major, minor, flags) \
+	LAZYBIOS_FIELD_DESC(record_type, field, LAZYBIOS_FIELD_STRING, 1, offset, major, minor, flags)
+
+/** @brief Terminates a descriptor table. */
+#define LAZYBIOS_FIELD_END { NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Decodes every field of a descriptor table from the structure under a cursor.
+ *
+ * Decoders call this first and then handle the fields that need more than a
+ * fixed-offset read.
+ */
+void lazybiosDecodeFields(void* record, const lazybiosFieldDesc* fields, const lazybiosStructCursor* cursor);
+
+/** @brief Reads a decoded integer field of a parsed record, widened to 64 bits. */
+uint64_t lazybiosFieldInteger(const void* record, const lazybiosFieldDesc* field);
+
+/** @brief Reads a decoded string field of a parsed record. */
+const char* lazybiosFieldString(const void* record, const lazybiosFieldDesc* field);
+
+/** @brief Reads the status of a decoded field of a parsed record. */
+lazybiosFieldStatus_t lazybiosFieldGetStatus(const void* record, const lazybiosFieldDesc* field);
+
+/** @brief Field descriptor tables, one per parsed type, each ending with LAZYBIOS_FIELD_END. */
+extern const lazybiosFieldDesc lazybiosType0Fields[];
+extern const lazybiosFieldDesc lazybiosType1Fields[];
+extern const lazybiosFieldDesc lazybiosType2Fields[];
+extern const lazybiosFieldDesc lazybiosType3Fields[];
+extern const lazybiosFieldDesc lazybiosType4Fields[];
+extern const lazybiosFieldDesc lazybiosType5Fields[];
+extern const lazybiosFieldDesc lazybiosType6Fields[];
+extern const lazybiosFieldDesc lazybiosType7Fields[];
+extern const lazybiosFieldDesc lazybiosType8Fields[];
+extern const lazybiosFieldDesc lazybiosType9Fields[];
+extern const lazybiosFieldDesc lazybiosType10Fields[];
+extern const lazybiosFieldDesc lazybiosType11Fields[];
+extern const lazybiosFieldDesc lazybiosType12Fields[];
+extern const lazybiosFieldDesc lazybiosType13Fields[];
+extern const lazybiosFieldDesc lazybiosType14Fields[];
+extern const lazybiosFieldDesc lazybiosType15Fields[];
+extern const lazybiosFieldDesc lazybiosType16Fields[];
+extern const lazybiosFieldDesc lazybiosType17Fields[];
+extern const lazybiosFieldDesc lazybiosType18Fields[];
+extern const lazybiosFieldDesc lazybiosType19Fields[];
+extern const lazybiosFieldDesc lazybiosType20Fields[];
+extern const lazybiosFieldDesc lazybiosType21Fields[];
+extern const lazybiosFieldDesc lazybiosType22Fields[];
+extern const lazybiosFieldDesc lazybiosType23Fields[];
+extern const lazybiosFieldDesc lazybiosType24Fields[];
+extern const lazybiosFieldDesc lazybiosType25Fields[];
+extern const lazybiosFieldDesc lazybiosType26Fields[];
+extern const lazybiosFieldDesc lazybiosType27Fields[];
+extern const lazybiosFieldDesc lazybiosType28Fields[];
+extern const lazybiosFieldDesc lazybiosType29Fields[];
+extern const lazybiosFieldDesc lazybiosType30Fields[];
+extern const lazybiosFieldDesc lazybiosType31Fields[];
+extern const lazybiosFieldDesc lazybiosType32Fields[];
+extern const lazybiosFieldDesc lazybiosType33Fields[];
+extern const lazybiosFieldDesc lazybiosType34Fields[];
+extern const lazybiosFieldDesc lazybiosType35Fields[];
+extern const lazybiosFieldDesc lazybiosType36Fields[];
+extern const lazybiosFieldDesc lazybiosType37Fields[];
+extern const lazybiosFieldDesc lazybiosType38Fields[];
+extern const lazybiosFieldDesc lazybiosType39Fields[];
+extern const lazybiosFieldDesc lazybiosType40Fields[];
+extern const lazybiosFieldDesc lazybiosType41Fields[];
+extern const lazybiosFieldDesc lazybiosType42Fields[];
+extern const lazybiosFieldDesc lazybiosType43Fields[];
+extern const lazybiosFieldDesc lazybiosType44Fields[];
+extern const lazybiosFieldDesc lazybiosType45Fields[];
+extern const lazybiosFieldDesc lazybiosType46Fields[];
+extern const lazybiosFieldDesc lazybiosOemDellType177Fields[];
+extern const lazybiosFieldDesc lazybiosOemDellType212Fields[];
+extern const lazybiosFieldDesc lazybiosOemHpType204Fields[];
+
+/**
+ * @brief Describes how one SMBIOS type is parsed and where it lives in a context.
+ *
+ * records and count are the offsets of the type's array and count members in
+ * lazybiosCTX_t, size is the size of one record, and fields is the type's
+ * descriptor table.
+ */
+typedef struct {
+	lazybiosDecodeFn decode;
+	void (*release)(void* records, size_t count);
+	size_t records;
+	size_t count;
+	size_t size;
+	int oem;
+	const lazybiosFieldDesc* fields;
+} lazybiosTypeInfo;
+
+/** @brief Parsed types by SMBIOS type number; types without a parser have a NULL decode. */
+extern const lazybiosTypeInfo lazybiosTypeTable[256];
+
+/** @brief Returns the context's parse arena, creating it on first use; NULL if that fails. */
+lazybiosArena_t* lazybiosCTXArena(lazybiosCTX_t* ctx);
+
+/**
+ * @brief Starts an iterator over any DMI container, such as one a stream assembled.
+ *
+ * Nested arrays that outgrow the iterator's scratch buffer spill into ctx's
+ * arena; with a NULL ctx those records fail to decode instead.
+ */
+int lazybiosIterBeginDMI(lazybiosIter_t* it, const lazybiosDMI_t* DMIData, lazybiosCTX_t* ctx, int type_filter);
+
+/**
+ * @brief lazybiosParseAll() with a chosen number of threads.
+ *
+ * With threads 0 the pool is sized as lazybiosParseAll() sizes it. With 2 or
+ * more, tables carrying a structure index are parsed on that many threads
+ * whatever their size, which is how the benchmark finds the crossover.
+ */
+int lazybiosParseAllThreads(lazybiosCTX_t* ctx, unsigned flags, unsigned threads);
+
+/**
+ * @brief Releases every parsed array held by a context and clears its members.
+ * @param keep_arena Nonzero to reset the arena for reuse instead of freeing it.
+ */
+void lazybiosReleaseParsed(lazybiosCTX_t* ctx, int keep_arena);
+
+/**
+ * @brief Returns a string of the cursor's current structure.
+ *
+ * Reads the index string slots when available and falls back to DMIString()
+ * otherwise; both return the same pointer for every string number.
+ *
+ * @param cursor Cursor positioned on a structure.
+ * @param string_number One-based string number from the formatted section.
+ * @return Pointer to the string in the DMI table, or NULL if it is unavailable.
+ */
+static inline const char* lazybiosStructCursorString(const lazybiosStructCursor* cursor, uint8_t string_number) {
+	const lazybiosIndexEntry* entry = cursor->entry;
+	if (!entry)
+		return DMIString(cursor->p, cursor->length, string_number, cursor->structure_end);
+
+	if (string_number == 0 || string_number > entry->string_count) return NULL;
+	return (const char*)cursor->DMIData->dmi_data +
+		cursor->DMIData->index->strings[entry->first_string + string_number - 1];
+}
+
 /**
  * @brief Validates and identifies an SMBIOS entry point.
  * @param ctx Context whose entry tag and tagged union are updated.
@@ -272,9 +878,9 @@ size_t lazybiosCountStructsByType(const lazybiosDMI_t* DMIData, uint8_t target_t
 int lazybiosParseEntry(lazybiosCTX_t* ctx, const uint8_t* entry_buf, size_t buf_len);
 
 
-#define READSTR(record, field, len, offset, p, end) do { \
+#define READSTR(record, field, len, offset, p, cursor) do { \
 	if ((len) > (offset)) { \
-		(record)->field = DMIString((p), (len), (p)[(offset)], (end)); \
+		(record)->field = lazybiosStructCursorString((cursor), (p)[(offset)]); \
 		if ((record)->field != NULL) { \
 			LAZYBIOS_MARK_PRESENT((record), field); \
 		} else { \
@@ -329,6 +935,10 @@ int lazybiosParseEntry(lazybiosCTX_t* ctx, const uint8_t* entry_buf, size_t buf_
 #if defined(OS_LINUX)
 /** @brief Loads SMBIOS data through the Linux backend. */
 int lazybiosLinux(lazybiosCTX_t* ctx);
+/** @brief Loads the sysfs entry point and table with one allocation and one pread each. */
+int lazybiosLinuxSysfs(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_path);
+/** @brief Compares the entry point at entry_path with a fingerprint; 1 changed, 0 unchanged, -1 unreadable. */
+int lazybiosLinuxEntryChanged(const uint8_t fingerprint[LAZYBIOS_FINGERPRINT_SIZE], const char* entry_path);
 #endif
 
 #if defined(OS_WINDOWS)
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file iter.c
+ * @brief Walks a table one structure at a time, decoding records on demand.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <string.h>
+
+// The iterator keeps the cursor in storage the public header can size without seeing it.
+typedef char iter_cursor_fits[sizeof(lazybiosStructCursor) <= sizeof(((lazybiosIter_t*)0)->cursor) ? 1 : -1];
+
+static lazybiosStructCursor* iter_cursor(lazybiosIter_t* it) {
+	return (lazybiosStructCursor*)(void*)it->cursor.words;
+}
+
+int lazybiosIterBeginDMI(lazybiosIter_t* it, const lazybiosDMI_t* DMIData, lazybiosCTX_t* ctx, int type_filter) {
+	if (!it) return -1;
+	memset(it, 0, offsetof(lazybiosIter_t, record));
+	if (!DMIData || !DMIData->dmi_data) return -1;
+	if (type_filter < LAZYBIOS_ITER_ALL_TYPES || type_filter > 255) return -1;
+
+	it->ctx = ctx;
+	if (type_filter == LAZYBIOS_ITER_ALL_TYPES)
+		lazybiosStructCursorInitAll(iter_cursor(it), DMIData);
+	else
+		lazybiosStructCursorInit(iter_cursor(it), DMIData, (uint8_t)type_filter);
+	return 0;
+}
+
+int lazybiosIterBegin(lazybiosIter_t* it, lazybiosCTX_t* ctx, int type_filter) {
+	return lazybiosIterBeginDMI(it, ctx ? ctx->DMIData : NULL, ctx, type_filter);
+}
+
+int lazybiosIterNext(lazybiosIter_t* it) {
+	if (!it) return 0;
+
+	lazybiosStructCursor* cursor = iter_cursor(it);
+	if (!cursor->DMIData) return 0;
+	it->decoded = 0;
+	if (!lazybiosStructCursorNext(cursor)) {
+		it->header = NULL;
+		it->size = 0;
+		return 0;
+	}
+
+	it->header = cursor->p;
+	it->size = (size_t)(cursor->structure_end - cursor->p);
+	it->type = cursor->p[0];
+	it->length = cursor->length;
+	it->handle = cursor->handle;
+	return 1;
+}
+
+const void* lazybiosIterRecord(lazybiosIter_t* it) {
+	if (!it || !it->header) return NULL;
+	if (it->decoded) return it->decoded > 0 ? it->record.words : NULL;
+
+	const lazybiosTypeInfo* info = &lazybiosTypeTable[it->type];
+	it->decoded = -1;
+	if (!info->decode || info->size > sizeof(it->record)) return NULL;
+
+	lazybiosScratch scratch = { (uint8_t*)it->scratch.words, sizeof(it->scratch), 0, it->ctx };
+	lazybiosStructCursor cursor = *iter_cursor(it);
+	cursor.scratch = &scratch;
+
+	memset(it->record.words, 0, info->size);
+	if (info->decode(it->record.words, &cursor) != 0) return NULL;
+	it->decoded = 1;
+	return it->record.words;
+}
+
+int lazybiosForEach(lazybiosCTX_t* ctx, const uint64_t type_mask[4], lazybiosVisitFn callback, void* user) {
+	if (!callback) return -1;
+
+	lazybiosIter_t it;
+	if (lazybiosIterBegin(&it, ctx, LAZYBIOS_ITER_ALL_TYPES) != 0) return -1;
+
+	while (lazybiosIterNext(&it)) {
+		if (type_mask && !(type_mask[it.type >> 6] & (UINT64_C(1) << (it.type & 63)))) continue;
+
+		int rc = callback(&it, lazybiosIterRecord(&it), user);
+		if (rc != 0) return rc;
+	}
+	return 0;
+}
@@ -24,6 +24,7 @@
 
 #include "lazybios/json/lazybios_json.h"
 #include "lazybios/json/cJSON.h"
+#include "lazybios_internal.h"
 
 #include <stdio.h>
 #include <stdint.h>
@@ -55,6 +56,31 @@ static inline void cjson_field_num(cJSON* obj, const char* key,
     }
 }
 
+// Builds a number array from a view into the DMI table.
+static cJSON* cjson_bytes(lazybiosBytes_t bytes) {
+    cJSON* arr = cJSON_CreateArray();
+    for (size_t i = 0; arr && i < bytes.len; i++) {
+        cJSON_AddItemToArray(arr, cJSON_CreateNumber(bytes.ptr[i]));
+    }
+    return arr;
+}
+
+// Adds every descriptor field flagged for export, in table order, under its member name.
+static void cjson_add_fields(cJSON* obj, const void* record, const lazybiosFieldDesc* fields) {
+    for (const lazybiosFieldDesc* field = fields; field->name; field++) {
+        if (!(field->flags & LAZYBIOS_FIELD_JSON)) {
+            continue;
+        }
+
+        lazybiosFieldStatus_t status = lazybiosFieldGetStatus(record, field);
+        if (field->kind == LAZYBIOS_FIELD_STRING) {
+            cjson_field_str(obj, field->name, status, lazybiosFieldString(record, field));
+        } else {
+            cjson_field_num(obj, field->name, status, (double)lazybiosFieldInteger(record, field));
+        }
+    }
+}
+
 void lazybiosExtJSONAddSMBIOSInfo(const lazybiosDMI_t* DMIData,
                                   lazybiosBackend_t backend, cJSON* root) {
     if (!DMIData || !root) {
@@ -192,36 +218,25 @@ void lazybiosExtJSONAddType0(const lazybiosType0_t* type0, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "characteristics");
         }
 
-        if (t->firmware_char_ext_bytes && t->firmware_char_ext_bytes_count >= 1) {
+        if (t->firmware_char_ext_bytes.len >= 1) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
-            lazybiosType0CharacteristicsExtByte1Str(t->firmware_char_ext_bytes[0], buf, sizeof(buf));
+            lazybiosType0CharacteristicsExtByte1Str(t->firmware_char_ext_bytes.ptr[0], buf, sizeof(buf));
             cJSON_AddStringToObject(obj, "characteristics_ext_byte1", buf);
         } else {
             cjson_field_str(obj, "characteristics_ext_byte1",
                             LAZYBIOS_FIELD_STATUS(t, firmware_char_ext_bytes), NULL);
         }
 
-        if (t->firmware_char_ext_bytes && t->firmware_char_ext_bytes_count >= 2) {
+        if (t->firmware_char_ext_bytes.len >= 2) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
-            lazybiosType0CharacteristicsExtByte2Str(t->firmware_char_ext_bytes[1], buf, sizeof(buf));
+            lazybiosType0CharacteristicsExtByte2Str(t->firmware_char_ext_bytes.ptr[1], buf, sizeof(buf));
             cJSON_AddStringToObject(obj, "characteristics_ext_byte2", buf);
         } else {
             cjson_field_str(obj, "characteristics_ext_byte2",
                             LAZYBIOS_FIELD_STATUS(t, firmware_char_ext_bytes), NULL);
         }
 
-        cjson_field_num(obj, "platform_major_release",
-                        LAZYBIOS_FIELD_STATUS(t, platform_major_release),
-                        t->platform_major_release);
-        cjson_field_num(obj, "platform_minor_release",
-                        LAZYBIOS_FIELD_STATUS(t, platform_minor_release),
-                        t->platform_minor_release);
-        cjson_field_num(obj, "ec_major_release",
-                        LAZYBIOS_FIELD_STATUS(t, ec_major_release),
-                        t->ec_major_release);
-        cjson_field_num(obj, "ec_minor_release",
-                        LAZYBIOS_FIELD_STATUS(t, ec_minor_release),
-                        t->ec_minor_release);
+        cjson_add_fields(obj, t, lazybiosType0Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, extended_rom_size) == LAZYBIOS_FIELD_PRESENT) {
             char unit[5];
@@ -300,8 +315,7 @@ void lazybiosExtJSONAddType1(const lazybiosType1_t* type1, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "wake_up_type");
         }
 
-        cjson_field_str(obj, "sku_number", LAZYBIOS_FIELD_STATUS(t, sku_number), t->sku_number);
-        cjson_field_str(obj, "family",     LAZYBIOS_FIELD_STATUS(t, family),     t->family);
+        cjson_add_fields(obj, t, lazybiosType1Fields);
 
         cJSON_AddItemToArray(arr, obj);
     }
@@ -331,11 +345,7 @@ void lazybiosExtJSONAddType2(const lazybiosType2_t* type2, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "manufacturer",  LAZYBIOS_FIELD_STATUS(t, manufacturer),  t->manufacturer);
-        cjson_field_str(obj, "product",       LAZYBIOS_FIELD_STATUS(t, product),       t->product);
-        cjson_field_str(obj, "version",       LAZYBIOS_FIELD_STATUS(t, version),       t->version);
-        cjson_field_str(obj, "serial_number", LAZYBIOS_FIELD_STATUS(t, serial_number), t->serial_number);
-        cjson_field_str(obj, "asset_tag",     LAZYBIOS_FIELD_STATUS(t, asset_tag),     t->asset_tag);
+        cjson_add_fields(obj, t, lazybiosType2Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, feature_flags) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
@@ -347,9 +357,6 @@ void lazybiosExtJSONAddType2(const lazybiosType2_t* type2, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "feature_flags");
         }
 
-        cjson_field_str(obj, "location_in_chassis",
-                        LAZYBIOS_FIELD_STATUS(t, location_in_chassis), t->location_in_chassis);
-
         if (LAZYBIOS_FIELD_STATUS(t, chassis_handle) == LAZYBIOS_FIELD_PRESENT) {
             char buf[10];
             snprintf(buf, sizeof(buf), "0x%04hX", t->chassis_handle);
@@ -412,7 +419,7 @@ void lazybiosExtJSONAddType3(const lazybiosType3_t* type3, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "manufacturer", LAZYBIOS_FIELD_STATUS(t, manufacturer), t->manufacturer);
+        cjson_add_fields(obj, t, lazybiosType3Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, type) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
@@ -424,10 +431,6 @@ void lazybiosExtJSONAddType3(const lazybiosType3_t* type3, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "type");
         }
 
-        cjson_field_str(obj, "version",       LAZYBIOS_FIELD_STATUS(t, version),       t->version);
-        cjson_field_str(obj, "serial_number", LAZYBIOS_FIELD_STATUS(t, serial_number), t->serial_number);
-        cjson_field_str(obj, "asset_tag",     LAZYBIOS_FIELD_STATUS(t, asset_tag),     t->asset_tag);
-
         if (LAZYBIOS_FIELD_STATUS(t, boot_up_state) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "boot_up_state", lazybiosType3StateStr(t->boot_up_state));
         } else if (LAZYBIOS_FIELD_STATUS(t, boot_up_state) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -472,11 +475,6 @@ void lazybiosExtJSONAddType3(const lazybiosType3_t* type3, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "oem_defined");
         }
 
-        cjson_field_num(obj, "height", LAZYBIOS_FIELD_STATUS(t, height), t->height);
-        cjson_field_num(obj, "number_of_power_cords",
-                        LAZYBIOS_FIELD_STATUS(t, number_of_power_cords),
-                        t->number_of_power_cords);
-
         if (LAZYBIOS_FIELD_STATUS(t, contained_elements) == LAZYBIOS_FIELD_PRESENT &&
                 t->contained_elements && t->contained_element_count > 0 &&
                 t->contained_element_record_length > 0) {
@@ -540,8 +538,7 @@ void lazybiosExtJSONAddType4(const lazybiosType4_t* type4, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "socket_designation",
-                        LAZYBIOS_FIELD_STATUS(t, socket_designation), t->socket_designation);
+        cjson_add_fields(obj, t, lazybiosType4Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, processor_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "processor_type",
@@ -565,10 +562,6 @@ void lazybiosExtJSONAddType4(const lazybiosType4_t* type4, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "processor_family");
         }
 
-        cjson_field_str(obj, "processor_manufacturer",
-                        LAZYBIOS_FIELD_STATUS(t, processor_manufacturer),
-                        t->processor_manufacturer);
-
         if (LAZYBIOS_FIELD_STATUS(t, processor_id) == LAZYBIOS_FIELD_PRESENT) {
             char buf[20];
             snprintf(buf, sizeof(buf), "0x%016llX", (unsigned long long)t->processor_id);
@@ -579,9 +572,6 @@ void lazybiosExtJSONAddType4(const lazybiosType4_t* type4, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "processor_id");
         }
 
-        cjson_field_str(obj, "processor_version",
-                        LAZYBIOS_FIELD_STATUS(t, processor_version), t->processor_version);
-
         if (LAZYBIOS_FIELD_STATUS(t, voltage) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
             lazybiosType4VoltageStr(t->voltage, buf, sizeof(buf));
@@ -660,10 +650,6 @@ void lazybiosExtJSONAddType4(const lazybiosType4_t* type4, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "l3_cache_handle");
         }
 
-        cjson_field_str(obj, "serial_number", LAZYBIOS_FIELD_STATUS(t, serial_number), t->serial_number);
-        cjson_field_str(obj, "asset_tag",     LAZYBIOS_FIELD_STATUS(t, asset_tag),     t->asset_tag);
-        cjson_field_str(obj, "part_number",   LAZYBIOS_FIELD_STATUS(t, part_number),   t->part_number);
-
         if (LAZYBIOS_FIELD_STATUS(t, core_count_2) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddNumberToObject(obj, "core_count", t->core_count_2);
         } else if (LAZYBIOS_FIELD_STATUS(t, core_count) == LAZYBIOS_FIELD_PRESENT) {
@@ -697,9 +683,6 @@ void lazybiosExtJSONAddType4(const lazybiosType4_t* type4, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "thread_count");
         }
 
-        cjson_field_num(obj, "thread_enabled",
-                        LAZYBIOS_FIELD_STATUS(t, thread_enabled), t->thread_enabled);
-
         if (LAZYBIOS_FIELD_STATUS(t, processor_characteristics) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
             lazybiosType4CharacteristicsStr(t->processor_characteristics, buf, sizeof(buf));
@@ -710,8 +693,6 @@ void lazybiosExtJSONAddType4(const lazybiosType4_t* type4, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "processor_characteristics");
         }
 
-        cjson_field_str(obj, "socket_type", LAZYBIOS_FIELD_STATUS(t, socket_type), t->socket_type);
-
         cJSON_AddItemToArray(arr, obj);
     }
 
@@ -822,9 +803,7 @@ void lazybiosExtJSONAddType5(const lazybiosType5_t* type5, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "memory_module_voltage");
         }
 
-        cjson_field_num(obj, "number_of_associated_memory_slots",
-                        LAZYBIOS_FIELD_STATUS(t, number_of_associated_memory_slots),
-                        t->number_of_associated_memory_slots);
+        cjson_add_fields(obj, t, lazybiosType5Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, memory_module_configuration_handles) == LAZYBIOS_FIELD_PRESENT &&
                 t->memory_module_configuration_handles && t->number_of_associated_memory_slots > 0) {
@@ -882,8 +861,7 @@ void lazybiosExtJSONAddType6(const lazybiosType6_t* type6, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "socket_designation",
-                        LAZYBIOS_FIELD_STATUS(t, socket_designation), t->socket_designation);
+        cjson_add_fields(obj, t, lazybiosType6Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, bank_connections) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
@@ -977,8 +955,7 @@ void lazybiosExtJSONAddType7(const lazybiosType7_t* type7, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "socket_designation",
-                        LAZYBIOS_FIELD_STATUS(t, socket_designation), t->socket_designation);
+        cjson_add_fields(obj, t, lazybiosType7Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, cache_configuration) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
@@ -1105,9 +1082,7 @@ void lazybiosExtJSONAddType8(const lazybiosType8_t* type8, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "internal_reference_designator",
-                        LAZYBIOS_FIELD_STATUS(t, internal_reference_designator),
-                        t->internal_reference_designator);
+        cjson_add_fields(obj, t, lazybiosType8Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, internal_connector_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "internal_connector_type",
@@ -1118,10 +1093,6 @@ void lazybiosExtJSONAddType8(const lazybiosType8_t* type8, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "internal_connector_type");
         }
 
-        cjson_field_str(obj, "external_reference_designator",
-                        LAZYBIOS_FIELD_STATUS(t, external_reference_designator),
-                        t->external_reference_designator);
-
         if (LAZYBIOS_FIELD_STATUS(t, external_connector_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "external_connector_type",
                                     lazybiosType8ConnectorTypeStr(t->external_connector_type));
@@ -1168,8 +1139,7 @@ void lazybiosExtJSONAddType9(const lazybiosType9_t* type9, size_t count, cJSON*
             continue;
         }
 
-        cjson_field_str(obj, "slot_designation",
-                        LAZYBIOS_FIELD_STATUS(t, slot_designation), t->slot_designation);
+        cjson_add_fields(obj, t, lazybiosType9Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, slot_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "slot_type",
@@ -1207,8 +1177,6 @@ void lazybiosExtJSONAddType9(const lazybiosType9_t* type9, size_t count, cJSON*
             cJSON_AddNullToObject(obj, "slot_length");
         }
 
-        cjson_field_num(obj, "slot_id", LAZYBIOS_FIELD_STATUS(t, slot_id), t->slot_id);
-
         if (LAZYBIOS_FIELD_STATUS(t, slot_characteristics_1) == LAZYBIOS_FIELD_PRESENT) {
             char buf[LAZYBIOS_DECODER_BUF_SIZE];
             lazybiosType9Characteristics1Str(t->slot_characteristics_1, buf, sizeof(buf));
@@ -1403,7 +1371,7 @@ void lazybiosExtJSONAddType11(const lazybiosType11_t* type11, size_t count, cJSO
             continue;
         }
 
-        cjson_field_num(obj, "string_count", LAZYBIOS_FIELD_STATUS(t, string_count), t->string_count);
+        cjson_add_fields(obj, t, lazybiosType11Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, strings) == LAZYBIOS_FIELD_PRESENT &&
             t->strings && t->string_count > 0) {
@@ -1450,7 +1418,7 @@ void lazybiosExtJSONAddType12(const lazybiosType12_t* type12, size_t count, cJSO
             continue;
         }
 
-        cjson_field_num(obj, "option_count", LAZYBIOS_FIELD_STATUS(t, option_count), t->option_count);
+        cjson_add_fields(obj, t, lazybiosType12Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, options) == LAZYBIOS_FIELD_PRESENT &&
             t->options && t->option_count > 0) {
@@ -1505,7 +1473,7 @@ void lazybiosExtJSONAddType13(const lazybiosType13_t* type13, size_t count, cJSO
             cJSON_AddNullToObject(obj, "language_description_format");
         }
 
-        cjson_field_num(obj, "installable_languages", LAZYBIOS_FIELD_STATUS(t, installable_languages), t->installable_languages);
+        cjson_add_fields(obj, t, lazybiosType13Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, languages) == LAZYBIOS_FIELD_PRESENT &&
             t->languages && t->installable_languages > 0) {
@@ -1610,9 +1578,7 @@ void lazybiosExtJSONAddType15(const lazybiosType15_t* type15, size_t count, cJSO
             continue;
         }
 
-        cjson_field_num(obj, "log_area_length", LAZYBIOS_FIELD_STATUS(t, log_area_length), t->log_area_length);
-        cjson_field_num(obj, "log_header_start_offset", LAZYBIOS_FIELD_STATUS(t, log_header_start_offset), t->log_header_start_offset);
-        cjson_field_num(obj, "log_data_start_offset", LAZYBIOS_FIELD_STATUS(t, log_data_start_offset), t->log_data_start_offset);
+        cjson_add_fields(obj, t, lazybiosType15Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, access_method) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "access_method", lazybiosType15AccessMethodStr(t->access_method));
@@ -1789,7 +1755,7 @@ void lazybiosExtJSONAddType16(const lazybiosType16_t* type16, size_t count, cJSO
             cJSON_AddNullToObject(obj, "memory_error_information_handle");
         }
 
-        cjson_field_num(obj, "number_of_memory_devices", LAZYBIOS_FIELD_STATUS(t, number_of_memory_devices), t->number_of_memory_devices);
+        cjson_add_fields(obj, t, lazybiosType16Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, extended_maximum_capacity) == LAZYBIOS_FIELD_PRESENT) {
             if (t->maximum_capacity != 0x80000000U) {
@@ -1831,8 +1797,7 @@ void lazybiosExtJSONAddType17(const lazybiosType17_t* type17, size_t count, cJSO
             continue;
         }
 
-        cjson_field_num(obj, "physical_memory_array_handle", LAZYBIOS_FIELD_STATUS(t, physical_memory_array_handle), t->physical_memory_array_handle);
-        cjson_field_num(obj, "memory_error_information_handle", LAZYBIOS_FIELD_STATUS(t, memory_error_information_handle), t->memory_error_information_handle);
+        cjson_add_fields(obj, t, lazybiosType17Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, total_width) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddNumberToObject(obj, "total_width_bits", t->total_width == 0xFFFF ? 0 : t->total_width);
@@ -1872,7 +1837,6 @@ void lazybiosExtJSONAddType17(const lazybiosType17_t* type17, size_t count, cJSO
             cJSON_AddNullToObject(obj, "form_factor");
         }
 
-        cjson_field_num(obj, "device_set", LAZYBIOS_FIELD_STATUS(t, device_set), t->device_set);
         cjson_add_str(obj, "device_locator", t->device_locator);
         cjson_add_str(obj, "bank_locator", t->bank_locator);
 
@@ -2235,8 +2199,7 @@ void lazybiosExtJSONAddType19(const lazybiosType19_t* type19, size_t count, cJSO
             cJSON_AddNullToObject(obj, "ending_address_bytes");
         }
 
-        cjson_field_num(obj, "memory_array_handle", LAZYBIOS_FIELD_STATUS(t, memory_array_handle), t->memory_array_handle);
-        cjson_field_num(obj, "partition_width", LAZYBIOS_FIELD_STATUS(t, partition_width), t->partition_width);
+        cjson_add_fields(obj, t, lazybiosType19Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, extended_starting_address) == LAZYBIOS_FIELD_PRESENT) {
             if (t->starting_address != 0xFFFFFFFFU) {
@@ -2308,8 +2271,7 @@ void lazybiosExtJSONAddType20(const lazybiosType20_t* type20, size_t count, cJSO
             cJSON_AddNullToObject(obj, "ending_address_bytes");
         }
 
-        cjson_field_num(obj, "memory_device_handle", LAZYBIOS_FIELD_STATUS(t, memory_device_handle), t->memory_device_handle);
-        cjson_field_num(obj, "memory_array_mapped_address_handle", LAZYBIOS_FIELD_STATUS(t, memory_array_mapped_address_handle), t->memory_array_mapped_address_handle);
+        cjson_add_fields(obj, t, lazybiosType20Fields);
 
         if (LAZYBIOS_FIELD_STATUS(t, partition_row_position) == LAZYBIOS_FIELD_PRESENT) {
             if (t->partition_row_position == 0xFF) cJSON_AddStringToObject(obj, "partition_row_position", "Unknown");
@@ -2409,7 +2371,7 @@ void lazybiosExtJSONAddType21(const lazybiosType21_t* type21, size_t count, cJSO
             cJSON_AddNullToObject(obj, "interface");
         }
 
-        cjson_field_num(obj, "number_of_buttons", LAZYBIOS_FIELD_STATUS(t, number_of_buttons), t->number_of_buttons);
+        cjson_add_fields(obj, t, lazybiosType21Fields);
 
         cJSON_AddItemToArray(arr, obj);
     }
@@ -2429,11 +2391,7 @@ void lazybiosExtJSONAddType22(const lazybiosType22_t* type22, size_t count, cJSO
         const lazybiosType22_t* t = &type22[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "location", LAZYBIOS_FIELD_STATUS(t, location), t->location);
-        cjson_field_str(obj, "manufacturer", LAZYBIOS_FIELD_STATUS(t, manufacturer), t->manufacturer);
-        cjson_field_str(obj, "manufacture_date", LAZYBIOS_FIELD_STATUS(t, manufacture_date), t->manufacture_date);
-        cjson_field_str(obj, "serial_number", LAZYBIOS_FIELD_STATUS(t, serial_number), t->serial_number);
-        cjson_field_str(obj, "device_name", LAZYBIOS_FIELD_STATUS(t, device_name), t->device_name);
+        cjson_add_fields(obj, t, lazybiosType22Fields);
         if (LAZYBIOS_FIELD_STATUS(t, device_chemistry) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "device_chemistry", lazybiosType22DeviceChemistryStr(t->device_chemistry));
         } else if (LAZYBIOS_FIELD_STATUS(t, device_chemistry) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -2441,15 +2399,7 @@ void lazybiosExtJSONAddType22(const lazybiosType22_t* type22, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "device_chemistry");
         }
-        cjson_field_num(obj, "design_capacity", LAZYBIOS_FIELD_STATUS(t, design_capacity), t->design_capacity);
-        cjson_field_num(obj, "design_voltage", LAZYBIOS_FIELD_STATUS(t, design_voltage), t->design_voltage);
-        cjson_field_str(obj, "sbds_version_number", LAZYBIOS_FIELD_STATUS(t, sbds_version_number), t->sbds_version_number);
         cjson_field_num(obj, "maximum_error_percent", LAZYBIOS_FIELD_STATUS(t, maximum_error), t->maximum_error);
-        cjson_field_num(obj, "sbds_serial_number", LAZYBIOS_FIELD_STATUS(t, sbds_serial_number), t->sbds_serial_number);
-        cjson_field_num(obj, "sbds_manufacture_date", LAZYBIOS_FIELD_STATUS(t, sbds_manufacture_date), t->sbds_manufacture_date);
-        cjson_field_str(obj, "sbds_device_chemistry", LAZYBIOS_FIELD_STATUS(t, sbds_device_chemistry), t->sbds_device_chemistry);
-        cjson_field_num(obj, "design_capacity_multiplier", LAZYBIOS_FIELD_STATUS(t, design_capacity_multiplier), t->design_capacity_multiplier);
-        cjson_field_num(obj, "oem_specific", LAZYBIOS_FIELD_STATUS(t, oem_specific), t->oem_specific);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type22", arr);
@@ -2467,11 +2417,7 @@ void lazybiosExtJSONAddType23(const lazybiosType23_t* type23, size_t count, cJSO
         const lazybiosType23_t* t = &type23[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "capabilities", LAZYBIOS_FIELD_STATUS(t, capabilities), t->capabilities);
-        cjson_field_num(obj, "reset_count", LAZYBIOS_FIELD_STATUS(t, reset_count), t->reset_count);
-        cjson_field_num(obj, "reset_limit", LAZYBIOS_FIELD_STATUS(t, reset_limit), t->reset_limit);
-        cjson_field_num(obj, "timer_interval", LAZYBIOS_FIELD_STATUS(t, timer_interval), t->timer_interval);
-        cjson_field_num(obj, "timeout", LAZYBIOS_FIELD_STATUS(t, timeout), t->timeout);
+        cjson_add_fields(obj, t, lazybiosType23Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type23", arr);
@@ -2489,7 +2435,7 @@ void lazybiosExtJSONAddType24(const lazybiosType24_t* type24, size_t count, cJSO
         const lazybiosType24_t* t = &type24[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "hardware_security_settings", LAZYBIOS_FIELD_STATUS(t, hardware_security_settings), t->hardware_security_settings);
+        cjson_add_fields(obj, t, lazybiosType24Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type24", arr);
@@ -2507,11 +2453,8 @@ void lazybiosExtJSONAddType25(const lazybiosType25_t* type25, size_t count, cJSO
         const lazybiosType25_t* t = &type25[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "next_scheduled_power_on_month", LAZYBIOS_FIELD_STATUS(t, next_scheduled_power_on_month), t->next_scheduled_power_on_month);
+        cjson_add_fields(obj, t, lazybiosType25Fields);
         cjson_field_num(obj, "next_scheduled_power_on_day_of_month", LAZYBIOS_FIELD_STATUS(t, next_scheduled_power_on_day), t->next_scheduled_power_on_day);
-        cjson_field_num(obj, "next_scheduled_power_on_hour", LAZYBIOS_FIELD_STATUS(t, next_scheduled_power_on_hour), t->next_scheduled_power_on_hour);
-        cjson_field_num(obj, "next_scheduled_power_on_minute", LAZYBIOS_FIELD_STATUS(t, next_scheduled_power_on_minute), t->next_scheduled_power_on_minute);
-        cjson_field_num(obj, "next_scheduled_power_on_second", LAZYBIOS_FIELD_STATUS(t, next_scheduled_power_on_second), t->next_scheduled_power_on_second);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type25", arr);
@@ -2529,7 +2472,7 @@ void lazybiosExtJSONAddType26(const lazybiosType26_t* type26, size_t count, cJSO
         const lazybiosType26_t* t = &type26[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
+        cjson_add_fields(obj, t, lazybiosType26Fields);
         if (LAZYBIOS_FIELD_STATUS(t, location_and_status) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "location", lazybiosType26LocationStr(t->location_and_status));
             cJSON_AddStringToObject(obj, "status", lazybiosType26StatusStr(t->location_and_status));
@@ -2540,13 +2483,6 @@ void lazybiosExtJSONAddType26(const lazybiosType26_t* type26, size_t count, cJSO
             cJSON_AddNullToObject(obj, "location");
             cJSON_AddNullToObject(obj, "status");
         }
-        cjson_field_num(obj, "maximum_value", LAZYBIOS_FIELD_STATUS(t, maximum_value), t->maximum_value);
-        cjson_field_num(obj, "minimum_value", LAZYBIOS_FIELD_STATUS(t, minimum_value), t->minimum_value);
-        cjson_field_num(obj, "resolution", LAZYBIOS_FIELD_STATUS(t, resolution), t->resolution);
-        cjson_field_num(obj, "tolerance", LAZYBIOS_FIELD_STATUS(t, tolerance), t->tolerance);
-        cjson_field_num(obj, "accuracy", LAZYBIOS_FIELD_STATUS(t, accuracy), t->accuracy);
-        cjson_field_num(obj, "oem_defined", LAZYBIOS_FIELD_STATUS(t, oem_defined), t->oem_defined);
-        cjson_field_num(obj, "nominal_value", LAZYBIOS_FIELD_STATUS(t, nominal_value), t->nominal_value);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type26", arr);
@@ -2564,7 +2500,7 @@ void lazybiosExtJSONAddType27(const lazybiosType27_t* type27, size_t count, cJSO
         const lazybiosType27_t* t = &type27[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "temperature_probe_handle", LAZYBIOS_FIELD_STATUS(t, temperature_probe_handle), t->temperature_probe_handle);
+        cjson_add_fields(obj, t, lazybiosType27Fields);
         if (LAZYBIOS_FIELD_STATUS(t, device_type_and_status) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "device_type", lazybiosType27DeviceTypeStr(t->device_type_and_status));
             cJSON_AddStringToObject(obj, "status", lazybiosType27StatusStr(t->device_type_and_status));
@@ -2575,10 +2511,6 @@ void lazybiosExtJSONAddType27(const lazybiosType27_t* type27, size_t count, cJSO
             cJSON_AddNullToObject(obj, "device_type");
             cJSON_AddNullToObject(obj, "status");
         }
-        cjson_field_num(obj, "cooling_unit_group", LAZYBIOS_FIELD_STATUS(t, cooling_unit_group), t->cooling_unit_group);
-        cjson_field_num(obj, "oem_defined", LAZYBIOS_FIELD_STATUS(t, oem_defined), t->oem_defined);
-        cjson_field_num(obj, "nominal_speed", LAZYBIOS_FIELD_STATUS(t, nominal_speed), t->nominal_speed);
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type27", arr);
@@ -2596,7 +2528,7 @@ void lazybiosExtJSONAddType28(const lazybiosType28_t* type28, size_t count, cJSO
         const lazybiosType28_t* t = &type28[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
+        cjson_add_fields(obj, t, lazybiosType28Fields);
         if (LAZYBIOS_FIELD_STATUS(t, location_and_status) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "location", lazybiosType28LocationStr(t->location_and_status));
             cJSON_AddStringToObject(obj, "status", lazybiosType28StatusStr(t->location_and_status));
@@ -2607,13 +2539,7 @@ void lazybiosExtJSONAddType28(const lazybiosType28_t* type28, size_t count, cJSO
             cJSON_AddNullToObject(obj, "location");
             cJSON_AddNullToObject(obj, "status");
         }
-        cjson_field_num(obj, "maximum_value", LAZYBIOS_FIELD_STATUS(t, maximum_value), t->maximum_value);
         cjson_field_num(obj, "minimum_value", LAZYBIOS_FIELD_STATUS(t, minimum_value), t->minimum_value);
-        cjson_field_num(obj, "resolution", LAZYBIOS_FIELD_STATUS(t, resolution), t->resolution);
-        cjson_field_num(obj, "tolerance", LAZYBIOS_FIELD_STATUS(t, tolerance), t->tolerance);
-        cjson_field_num(obj, "accuracy", LAZYBIOS_FIELD_STATUS(t, accuracy), t->accuracy);
-        cjson_field_num(obj, "oem_defined", LAZYBIOS_FIELD_STATUS(t, oem_defined), t->oem_defined);
-        cjson_field_num(obj, "nominal_value", LAZYBIOS_FIELD_STATUS(t, nominal_value), t->nominal_value);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type28", arr);
@@ -2631,7 +2557,7 @@ void lazybiosExtJSONAddType29(const lazybiosType29_t* type29, size_t count, cJSO
         const lazybiosType29_t* t = &type29[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
+        cjson_add_fields(obj, t, lazybiosType29Fields);
         if (LAZYBIOS_FIELD_STATUS(t, location_and_status) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "location", lazybiosType29LocationStr(t->location_and_status));
             cJSON_AddStringToObject(obj, "status", lazybiosType29StatusStr(t->location_and_status));
@@ -2642,13 +2568,6 @@ void lazybiosExtJSONAddType29(const lazybiosType29_t* type29, size_t count, cJSO
             cJSON_AddNullToObject(obj, "location");
             cJSON_AddNullToObject(obj, "status");
         }
-        cjson_field_num(obj, "maximum_value", LAZYBIOS_FIELD_STATUS(t, maximum_value), t->maximum_value);
-        cjson_field_num(obj, "minimum_value", LAZYBIOS_FIELD_STATUS(t, minimum_value), t->minimum_value);
-        cjson_field_num(obj, "resolution", LAZYBIOS_FIELD_STATUS(t, resolution), t->resolution);
-        cjson_field_num(obj, "tolerance", LAZYBIOS_FIELD_STATUS(t, tolerance), t->tolerance);
-        cjson_field_num(obj, "accuracy", LAZYBIOS_FIELD_STATUS(t, accuracy), t->accuracy);
-        cjson_field_num(obj, "oem_defined", LAZYBIOS_FIELD_STATUS(t, oem_defined), t->oem_defined);
-        cjson_field_num(obj, "nominal_value", LAZYBIOS_FIELD_STATUS(t, nominal_value), t->nominal_value);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type29", arr);
@@ -2666,8 +2585,7 @@ void lazybiosExtJSONAddType30(const lazybiosType30_t* type30, size_t count, cJSO
         const lazybiosType30_t* t = &type30[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "manufacturer_name", LAZYBIOS_FIELD_STATUS(t, manufacturer_name), t->manufacturer_name);
-        cjson_field_num(obj, "connections", LAZYBIOS_FIELD_STATUS(t, connections), t->connections);
+        cjson_add_fields(obj, t, lazybiosType30Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type30", arr);
@@ -2685,11 +2603,9 @@ void lazybiosExtJSONAddType31(const lazybiosType31_t* type31, size_t count, cJSO
         const lazybiosType31_t* t = &type31[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "checksum", LAZYBIOS_FIELD_STATUS(t, checksum), t->checksum);
+        cjson_add_fields(obj, t, lazybiosType31Fields);
         cjson_field_num(obj, "reserved1", LAZYBIOS_FIELD_STATUS(t, reserved_1), t->reserved_1);
         cjson_field_num(obj, "reserved2", LAZYBIOS_FIELD_STATUS(t, reserved_2), t->reserved_2);
-        cjson_field_num(obj, "bis_entry_point_16", LAZYBIOS_FIELD_STATUS(t, bis_entry_point_16), t->bis_entry_point_16);
-        cjson_field_num(obj, "bis_entry_point_32", LAZYBIOS_FIELD_STATUS(t, bis_entry_point_32), t->bis_entry_point_32);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type31", arr);
@@ -2806,7 +2722,7 @@ void lazybiosExtJSONAddType34(const lazybiosType34_t* type34, size_t count, cJSO
         const lazybiosType34_t* t = &type34[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
+        cjson_add_fields(obj, t, lazybiosType34Fields);
         if (LAZYBIOS_FIELD_STATUS(t, device_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "device_type", lazybiosType34DeviceTypeStr(t->device_type));
         } else if (LAZYBIOS_FIELD_STATUS(t, device_type) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -2814,7 +2730,6 @@ void lazybiosExtJSONAddType34(const lazybiosType34_t* type34, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "device_type");
         }
-        cjson_field_num(obj, "address", LAZYBIOS_FIELD_STATUS(t, address), t->address);
         if (LAZYBIOS_FIELD_STATUS(t, address_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "address_type", lazybiosType34AddressTypeStr(t->address_type));
         } else if (LAZYBIOS_FIELD_STATUS(t, address_type) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -2839,10 +2754,7 @@ void lazybiosExtJSONAddType35(const lazybiosType35_t* type35, size_t count, cJSO
         const lazybiosType35_t* t = &type35[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
-        cjson_field_num(obj, "management_device_handle", LAZYBIOS_FIELD_STATUS(t, management_device_handle), t->management_device_handle);
-        cjson_field_num(obj, "component_handle", LAZYBIOS_FIELD_STATUS(t, component_handle), t->component_handle);
-        cjson_field_num(obj, "threshold_handle", LAZYBIOS_FIELD_STATUS(t, threshold_handle), t->threshold_handle);
+        cjson_add_fields(obj, t, lazybiosType35Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type35", arr);
@@ -2860,12 +2772,7 @@ void lazybiosExtJSONAddType36(const lazybiosType36_t* type36, size_t count, cJSO
         const lazybiosType36_t* t = &type36[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "lower_threshold_non_critical", LAZYBIOS_FIELD_STATUS(t, lower_threshold_non_critical), t->lower_threshold_non_critical);
-        cjson_field_num(obj, "upper_threshold_non_critical", LAZYBIOS_FIELD_STATUS(t, upper_threshold_non_critical), t->upper_threshold_non_critical);
-        cjson_field_num(obj, "lower_threshold_critical", LAZYBIOS_FIELD_STATUS(t, lower_threshold_critical), t->lower_threshold_critical);
-        cjson_field_num(obj, "upper_threshold_critical", LAZYBIOS_FIELD_STATUS(t, upper_threshold_critical), t->upper_threshold_critical);
-        cjson_field_num(obj, "lower_threshold_non_recoverable", LAZYBIOS_FIELD_STATUS(t, lower_threshold_non_recoverable), t->lower_threshold_non_recoverable);
-        cjson_field_num(obj, "upper_threshold_non_recoverable", LAZYBIOS_FIELD_STATUS(t, upper_threshold_non_recoverable), t->upper_threshold_non_recoverable);
+        cjson_add_fields(obj, t, lazybiosType36Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type36", arr);
@@ -2890,8 +2797,7 @@ void lazybiosExtJSONAddType37(const lazybiosType37_t* type37, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "channel_type");
         }
-        cjson_field_num(obj, "maximum_channel_load", LAZYBIOS_FIELD_STATUS(t, maximum_channel_load), t->maximum_channel_load);
-        cjson_field_num(obj, "memory_device_count", LAZYBIOS_FIELD_STATUS(t, memory_device_count), t->memory_device_count);
+        cjson_add_fields(obj, t, lazybiosType37Fields);
         if (LAZYBIOS_FIELD_STATUS(t, memory_devices) == LAZYBIOS_FIELD_PRESENT && t->memory_devices) {
             cJSON* load_arr = cJSON_CreateArray();
             for (uint8_t j = 0; j < t->memory_device_count; j++) {
@@ -2926,12 +2832,8 @@ void lazybiosExtJSONAddType38(const lazybiosType38_t* type38, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "interface_type");
         }
-        cjson_field_num(obj, "ipmi_specification_revision", LAZYBIOS_FIELD_STATUS(t, ipmi_specification_revision), t->ipmi_specification_revision);
-        cjson_field_num(obj, "i2c_target_address", LAZYBIOS_FIELD_STATUS(t, i2c_target_address), t->i2c_target_address);
-        cjson_field_num(obj, "nv_storage_device_address", LAZYBIOS_FIELD_STATUS(t, nv_storage_device_address), t->nv_storage_device_address);
+        cjson_add_fields(obj, t, lazybiosType38Fields);
         cjson_field_num(obj, "base_address", LAZYBIOS_FIELD_STATUS(t, base_address), (double)t->base_address);
-        cjson_field_num(obj, "base_address_modifier_interrupt_info", LAZYBIOS_FIELD_STATUS(t, base_address_modifier_interrupt_info), t->base_address_modifier_interrupt_info);
-        cjson_field_num(obj, "interrupt_number", LAZYBIOS_FIELD_STATUS(t, interrupt_number), t->interrupt_number);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type38", arr);
@@ -2949,19 +2851,7 @@ void lazybiosExtJSONAddType39(const lazybiosType39_t* type39, size_t count, cJSO
         const lazybiosType39_t* t = &type39[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "power_unit_group", LAZYBIOS_FIELD_STATUS(t, power_unit_group), t->power_unit_group);
-        cjson_field_str(obj, "location", LAZYBIOS_FIELD_STATUS(t, location), t->location);
-        cjson_field_str(obj, "device_name", LAZYBIOS_FIELD_STATUS(t, device_name), t->device_name);
-        cjson_field_str(obj, "manufacturer", LAZYBIOS_FIELD_STATUS(t, manufacturer), t->manufacturer);
-        cjson_field_str(obj, "serial_number", LAZYBIOS_FIELD_STATUS(t, serial_number), t->serial_number);
-        cjson_field_str(obj, "asset_tag_number", LAZYBIOS_FIELD_STATUS(t, asset_tag_number), t->asset_tag_number);
-        cjson_field_str(obj, "model_part_number", LAZYBIOS_FIELD_STATUS(t, model_part_number), t->model_part_number);
-        cjson_field_str(obj, "revision_level", LAZYBIOS_FIELD_STATUS(t, revision_level), t->revision_level);
-        cjson_field_num(obj, "max_power_capacity", LAZYBIOS_FIELD_STATUS(t, max_power_capacity), t->max_power_capacity);
-        cjson_field_num(obj, "power_supply_characteristics", LAZYBIOS_FIELD_STATUS(t, power_supply_characteristics), t->power_supply_characteristics);
-        cjson_field_num(obj, "input_voltage_probe_handle", LAZYBIOS_FIELD_STATUS(t, input_voltage_probe_handle), t->input_voltage_probe_handle);
-        cjson_field_num(obj, "cooling_device_handle", LAZYBIOS_FIELD_STATUS(t, cooling_device_handle), t->cooling_device_handle);
-        cjson_field_num(obj, "input_current_probe_handle", LAZYBIOS_FIELD_STATUS(t, input_current_probe_handle), t->input_current_probe_handle);
+        cjson_add_fields(obj, t, lazybiosType39Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type39", arr);
@@ -2979,7 +2869,7 @@ void lazybiosExtJSONAddType40(const lazybiosType40_t* type40, size_t count, cJSO
         const lazybiosType40_t* t = &type40[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "additional_information_entry_count", LAZYBIOS_FIELD_STATUS(t, additional_information_entry_count), t->additional_information_entry_count);
+        cjson_add_fields(obj, t, lazybiosType40Fields);
         if (LAZYBIOS_FIELD_STATUS(t, additional_information_entries) == LAZYBIOS_FIELD_PRESENT && t->additional_information_entries) {
             cJSON* entries_arr = cJSON_CreateArray();
             for (uint8_t j = 0; j < t->additional_information_entry_count; j++) {
@@ -2988,12 +2878,8 @@ void lazybiosExtJSONAddType40(const lazybiosType40_t* type40, size_t count, cJSO
                 cJSON_AddNumberToObject(entry_obj, "referenced_handle", t->additional_information_entries[j].referenced_handle);
                 cJSON_AddNumberToObject(entry_obj, "referenced_offset", t->additional_information_entries[j].referenced_offset);
                 cjson_field_str(entry_obj, "string", LAZYBIOS_FIELD_PRESENT, t->additional_information_entries[j].string);
-                if (t->additional_information_entries[j].value && t->additional_information_entries[j].value_length > 0) {
-                    cJSON* val_arr = cJSON_CreateArray();
-                    for (size_t k = 0; k < t->additional_information_entries[j].value_length; k++) {
-                        cJSON_AddItemToArray(val_arr, cJSON_CreateNumber(t->additional_information_entries[j].value[k]));
-                    }
-                    cJSON_AddItemToObject(entry_obj, "value", val_arr);
+                if (t->additional_information_entries[j].value.len > 0) {
+                    cJSON_AddItemToObject(entry_obj, "value", cjson_bytes(t->additional_information_entries[j].value));
                 }
                 cJSON_AddItemToArray(entries_arr, entry_obj);
             }
@@ -3016,7 +2902,7 @@ void lazybiosExtJSONAddType41(const lazybiosType41_t* type41, size_t count, cJSO
         const lazybiosType41_t* t = &type41[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "reference_designation", LAZYBIOS_FIELD_STATUS(t, reference_designation), t->reference_designation);
+        cjson_add_fields(obj, t, lazybiosType41Fields);
         if (LAZYBIOS_FIELD_STATUS(t, device_type_and_status) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "device_type", lazybiosType41DeviceTypeStr(t->device_type_and_status));
             cJSON_AddStringToObject(obj, "status", lazybiosType41DeviceStatusStr(t->device_type_and_status));
@@ -3027,10 +2913,6 @@ void lazybiosExtJSONAddType41(const lazybiosType41_t* type41, size_t count, cJSO
             cJSON_AddNullToObject(obj, "device_type");
             cJSON_AddNullToObject(obj, "status");
         }
-        cjson_field_num(obj, "device_type_instance", LAZYBIOS_FIELD_STATUS(t, device_type_instance), t->device_type_instance);
-        cjson_field_num(obj, "segment_group_number", LAZYBIOS_FIELD_STATUS(t, segment_group_number), t->segment_group_number);
-        cjson_field_num(obj, "bus_number", LAZYBIOS_FIELD_STATUS(t, bus_number), t->bus_number);
-        cjson_field_num(obj, "device_function_number", LAZYBIOS_FIELD_STATUS(t, device_function_number), t->device_function_number);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type41", arr);
@@ -3055,24 +2937,18 @@ void lazybiosExtJSONAddType42(const lazybiosType42_t* type42, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "interface_type");
         }
-        if (LAZYBIOS_FIELD_STATUS(t, interface_type_specific_data) == LAZYBIOS_FIELD_PRESENT && t->interface_type_specific_data) {
-            cJSON* data_arr = cJSON_CreateArray();
-            for (size_t j = 0; j < t->interface_type_specific_data_size; j++) {
-                cJSON_AddItemToArray(data_arr, cJSON_CreateNumber(t->interface_type_specific_data[j]));
-            }
-            cJSON_AddItemToObject(obj, "interface_type_specific_data", data_arr);
+        if (LAZYBIOS_FIELD_STATUS(t, interface_type_specific_data) == LAZYBIOS_FIELD_PRESENT &&
+            t->interface_type_specific_data.len > 0) {
+            cJSON_AddItemToObject(obj, "interface_type_specific_data", cjson_bytes(t->interface_type_specific_data));
         }
         if (LAZYBIOS_FIELD_STATUS(t, protocol_records) == LAZYBIOS_FIELD_PRESENT && t->protocol_records) {
             cJSON* records_arr = cJSON_CreateArray();
             for (uint8_t j = 0; j < t->number_of_protocol_records; j++) {
                 cJSON* rec_obj = cJSON_CreateObject();
                 cJSON_AddStringToObject(rec_obj, "protocol_type", lazybiosType42ProtocolTypeStr(t->protocol_records[j].protocol_type));
-                if (t->protocol_records[j].protocol_type_specific_data && t->protocol_records[j].protocol_type_specific_data_length > 0) {
-                    cJSON* pdata_arr = cJSON_CreateArray();
-                    for (uint8_t k = 0; k < t->protocol_records[j].protocol_type_specific_data_length; k++) {
-                        cJSON_AddItemToArray(pdata_arr, cJSON_CreateNumber(t->protocol_records[j].protocol_type_specific_data[k]));
-                    }
-                    cJSON_AddItemToObject(rec_obj, "protocol_type_specific_data", pdata_arr);
+                if (t->protocol_records[j].protocol_type_specific_data.len > 0) {
+                    cJSON_AddItemToObject(rec_obj, "protocol_type_specific_data",
+                                          cjson_bytes(t->protocol_records[j].protocol_type_specific_data));
                 }
                 cJSON_AddItemToArray(records_arr, rec_obj);
             }
@@ -3096,13 +2972,8 @@ void lazybiosExtJSONAddType43(const lazybiosType43_t* type43, size_t count, cJSO
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
         cjson_field_str(obj, "vendor_id", LAZYBIOS_FIELD_STATUS(t, vendor_id), (char*)t->vendor_id);
-        cjson_field_num(obj, "major_spec_version", LAZYBIOS_FIELD_STATUS(t, major_spec_version), t->major_spec_version);
-        cjson_field_num(obj, "minor_spec_version", LAZYBIOS_FIELD_STATUS(t, minor_spec_version), t->minor_spec_version);
-        cjson_field_num(obj, "firmware_version_1", LAZYBIOS_FIELD_STATUS(t, firmware_version_1), t->firmware_version_1);
-        cjson_field_num(obj, "firmware_version_2", LAZYBIOS_FIELD_STATUS(t, firmware_version_2), t->firmware_version_2);
-        cjson_field_str(obj, "description", LAZYBIOS_FIELD_STATUS(t, description), t->description);
+        cjson_add_fields(obj, t, lazybiosType43Fields);
         cjson_field_num(obj, "characteristics", LAZYBIOS_FIELD_STATUS(t, characteristics), (double)t->characteristics);
-        cjson_field_num(obj, "oem_defined", LAZYBIOS_FIELD_STATUS(t, oem_defined), t->oem_defined);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type43", arr);
@@ -3120,7 +2991,7 @@ void lazybiosExtJSONAddType44(const lazybiosType44_t* type44, size_t count, cJSO
         const lazybiosType44_t* t = &type44[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_num(obj, "referenced_handle", LAZYBIOS_FIELD_STATUS(t, referenced_handle), t->referenced_handle);
+        cjson_add_fields(obj, t, lazybiosType44Fields);
         if (LAZYBIOS_FIELD_STATUS(t, processor_type) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "processor_type", lazybiosType44ProcessorTypeStr(t->processor_type));
         } else if (LAZYBIOS_FIELD_STATUS(t, processor_type) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -3128,12 +2999,9 @@ void lazybiosExtJSONAddType44(const lazybiosType44_t* type44, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "processor_type");
         }
-        if (LAZYBIOS_FIELD_STATUS(t, processor_specific_data) == LAZYBIOS_FIELD_PRESENT && t->processor_specific_data) {
-            cJSON* data_arr = cJSON_CreateArray();
-            for (uint8_t j = 0; j < t->block_length; j++) {
-                cJSON_AddItemToArray(data_arr, cJSON_CreateNumber(t->processor_specific_data[j]));
-            }
-            cJSON_AddItemToObject(obj, "processor_specific_data", data_arr);
+        if (LAZYBIOS_FIELD_STATUS(t, processor_specific_data) == LAZYBIOS_FIELD_PRESENT &&
+            t->processor_specific_data.len > 0) {
+            cJSON_AddItemToObject(obj, "processor_specific_data", cjson_bytes(t->processor_specific_data));
         }
         cJSON_AddItemToArray(arr, obj);
     }
@@ -3152,8 +3020,7 @@ void lazybiosExtJSONAddType45(const lazybiosType45_t* type45, size_t count, cJSO
         const lazybiosType45_t* t = &type45[i];
         cJSON* obj = cJSON_CreateObject();
         if (!obj) continue;
-        cjson_field_str(obj, "firmware_component_name", LAZYBIOS_FIELD_STATUS(t, firmware_component_name), t->firmware_component_name);
-        cjson_field_str(obj, "firmware_version", LAZYBIOS_FIELD_STATUS(t, firmware_version), t->firmware_version);
+        cjson_add_fields(obj, t, lazybiosType45Fields);
         if (LAZYBIOS_FIELD_STATUS(t, version_format) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "version_format", lazybiosType45VersionFormatStr(t->version_format));
         } else if (LAZYBIOS_FIELD_STATUS(t, version_format) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -3161,7 +3028,6 @@ void lazybiosExtJSONAddType45(const lazybiosType45_t* type45, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "version_format");
         }
-        cjson_field_str(obj, "firmware_id", LAZYBIOS_FIELD_STATUS(t, firmware_id), t->firmware_id);
         if (LAZYBIOS_FIELD_STATUS(t, firmware_id_format) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "firmware_id_format", lazybiosType45FirmwareIDFormatStr(t->firmware_id_format));
         } else if (LAZYBIOS_FIELD_STATUS(t, firmware_id_format) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -3169,11 +3035,7 @@ void lazybiosExtJSONAddType45(const lazybiosType45_t* type45, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "firmware_id_format");
         }
-        cjson_field_str(obj, "release_date", LAZYBIOS_FIELD_STATUS(t, release_date), t->release_date);
-        cjson_field_str(obj, "manufacturer", LAZYBIOS_FIELD_STATUS(t, manufacturer), t->manufacturer);
-        cjson_field_str(obj, "lowest_supported_firmware_version", LAZYBIOS_FIELD_STATUS(t, lowest_supported_firmware_version), t->lowest_supported_firmware_version);
         cjson_field_num(obj, "image_size", LAZYBIOS_FIELD_STATUS(t, image_size), (double)t->image_size);
-        cjson_field_num(obj, "characteristics", LAZYBIOS_FIELD_STATUS(t, characteristics), t->characteristics);
         if (LAZYBIOS_FIELD_STATUS(t, state) == LAZYBIOS_FIELD_PRESENT) {
             cJSON_AddStringToObject(obj, "state", lazybiosType45StateStr(t->state));
         } else if (LAZYBIOS_FIELD_STATUS(t, state) == LAZYBIOS_FIELD_UNREACHABLE) {
@@ -3213,8 +3075,7 @@ void lazybiosExtJSONAddType46(const lazybiosType46_t* type46, size_t count, cJSO
         } else {
             cJSON_AddNullToObject(obj, "string_property_id");
         }
-        cjson_field_str(obj, "string_property_value", LAZYBIOS_FIELD_STATUS(t, string_property_value), t->string_property_value);
-        cjson_field_num(obj, "parent_handle", LAZYBIOS_FIELD_STATUS(t, parent_handle), t->parent_handle);
+        cjson_add_fields(obj, t, lazybiosType46Fields);
         cJSON_AddItemToArray(arr, obj);
     }
     cJSON_AddItemToObject(root, "Type46", arr);
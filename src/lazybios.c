@@ -30,6 +30,13 @@
 
 const char lazybiosVersion[] = "2.0.0";
 
+// Entry-point bytes to read from the start of a merged dump, or SIZE_MAX for an unknown anchor.
+static size_t single_file_entry_size(const uint8_t header[5]) {
+	if (header[3] == '3') return 24; // for SMBIOS 3.x.x the length is 24 bytes
+	if (header[3] == '_') return 31; // for SMBIOS 2.x the length is 31 bytes
+	return SIZE_MAX; // our fallback
+}
+
 int lazybiosSingleFile(lazybiosCTX_t* ctx, const char* bin_path) {
 	if (!ctx || !ctx->DMIData || !bin_path) return -1;
 
@@ -47,15 +54,7 @@ int lazybiosSingleFile(lazybiosCTX_t* ctx, const char* bin_path) {
 		return -1;
 	}
 
-	size_t entry_size = 0;
-	if (header[3] == '3') {
-		entry_size = 24; // for SMBIOS 3.x.x the length is 24 bytes
-	} else if (header[3] == '_') {
-		entry_size = 31; // for SMBIOS 2.x the length is 31 bytes
-	} else {
-		entry_size = SIZE_MAX; // our fallback
-	}
-
+	size_t entry_size = single_file_entry_size(header);
 	if (entry_size == SIZE_MAX) {
 		lb_log("Couldn't read SMBIOS anchor!");
 		lb_dbg("Header: %02X %02X %02X %02X %02X", header[0], header[1], header[2], header[3], header[4]);
@@ -105,7 +104,7 @@ int lazybiosSingleFile(lazybiosCTX_t* ctx, const char* bin_path) {
 		return -1;
 	}
 
-	uint8_t* table_data = malloc(table_len);
+	uint8_t* table_data = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, table_len);
 	if (!table_data) {
 		lb_log("Failed to allocate DMI buffer (%zu bytes)", table_len);
 		fclose(binf);
@@ -117,13 +116,56 @@ int lazybiosSingleFile(lazybiosCTX_t* ctx, const char* bin_path) {
 
 	if (got != table_len) {
 		lb_log("Short read of DMI data (%zu of %zu bytes)", got, table_len);
-		free(table_data);
+		lazybiosAllocatorFree(&ctx->DMIData->allocator, table_data);
+		return -1;
+	}
+
+	// The table was read straight into its final buffer; only the entry point is copied.
+	uint8_t* entry_copy = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, parsed_entry_len);
+	if (entry_copy) memcpy(entry_copy, entry_buf, parsed_entry_len);
+	if (!entry_copy || lazybiosAdoptBuffers(ctx, entry_copy, parsed_entry_len, table_data, table_len, 0) != 0) {
+		lazybiosAllocatorFree(&ctx->DMIData->allocator, entry_copy);
+		lazybiosAllocatorFree(&ctx->DMIData->allocator, table_data);
+		return -1;
+	}
+	return 0;
+}
+
+int lazybiosLoadMergedBorrowed(lazybiosCTX_t* ctx, const uint8_t* file, size_t file_len) {
+	if (!ctx || !ctx->DMIData || !file) return -1;
+
+	size_t entry_size = file_len >= 5 ? single_file_entry_size(file) : SIZE_MAX;
+	size_t parsed_entry_len;
+	size_t table_offset;
+	size_t table_len;
+	if (entry_size == SIZE_MAX || entry_size > file_len ||
+		lazybiosGetSingleFileLayout(file, entry_size, file_len,
+			&parsed_entry_len, &table_offset, &table_len) != 0) {
+		lb_log("Invalid SMBIOS single-file layout");
+		return -1;
+	}
+
+	return lazybiosLoadBorrowed(ctx, file, parsed_entry_len, file + table_offset, table_len, 0, NULL, NULL);
+}
+
+int lazybiosSingleFileMapped(lazybiosCTX_t* ctx, const char* bin_path) {
+	if (!ctx || !ctx->DMIData || !bin_path) return -1;
+
+	void* base;
+	size_t file_len;
+	if (lazybiosMapFile(bin_path, &base, &file_len) != 0) {
+		lb_dbg("Cannot map %s; reading it instead", bin_path);
+		return lazybiosSingleFile(ctx, bin_path);
+	}
+
+	if (lazybiosLoadMergedBorrowed(ctx, base, file_len) != 0) {
+		lazybiosUnmapFile(base, file_len);
 		return -1;
 	}
 
-	int result = lazybiosLoadRawBuffers(ctx, entry_buf, parsed_entry_len, table_data, table_len);
-	free(table_data);
-	return result;
+	ctx->DMIData->mapping = base;
+	ctx->DMIData->mapping_len = file_len;
+	return 0;
 }
 
 int lazybiosFile(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_path) {
@@ -144,15 +186,14 @@ int lazybiosFile(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_pat
 
 	uint8_t entry_buf[64];
 	size_t n = fread(entry_buf, 1, sizeof(entry_buf), entry);
-	ctx->DMIData->entry_len = n;
-
 	if (n < 20) {
 		lb_log("Invalid SMBIOS entry point (%zu bytes)", n);
 		fclose(entry);
 		fclose(dmi);
 		return -1;
 	}
-	ctx->DMIData->entry_data = malloc(ctx->DMIData->entry_len);
+	ctx->DMIData->entry_len = n;
+	ctx->DMIData->entry_data = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, ctx->DMIData->entry_len);
 	if (!ctx->DMIData->entry_data) {
 		lb_log("Failed to allocate memory for entry_data");
 		fclose(entry);
@@ -165,7 +206,7 @@ int lazybiosFile(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_pat
 	if (fseek(dmi, 0, SEEK_END) != 0) {
 		lb_log("Failed to seek in DMI table");
 		fclose(dmi);
-		return -1;
+		goto fail;
 	}
 
 	long len = ftell(dmi);
@@ -173,22 +214,22 @@ int lazybiosFile(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_pat
 		lb_log("Invalid or empty DMI table");
 		lb_dbg("ftell returned %ld", len);
 		fclose(dmi);
-		return -1;
+		goto fail;
 	}
 
 	if (lazybiosParseEntry(ctx, ctx->DMIData->entry_data, ctx->DMIData->entry_len) != 0) {
 		fclose(dmi);
-		return -1;
+		goto fail;
 	}
 
 	ctx->DMIData->dmi_len = (size_t)len;
 	rewind(dmi);
 
-	ctx->DMIData->dmi_data = malloc(ctx->DMIData->dmi_len);
+	ctx->DMIData->dmi_data = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, ctx->DMIData->dmi_len);
 	if (!ctx->DMIData->dmi_data) {
 		lb_log("Failed to allocate %zu bytes for DMI buffer", ctx->DMIData->dmi_len);
 		fclose(dmi);
-		return -1;
+		goto fail;
 	}
 
 	size_t got = fread(ctx->DMIData->dmi_data, 1, ctx->DMIData->dmi_len, dmi);
@@ -196,22 +237,77 @@ int lazybiosFile(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_pat
 
 	if (got != ctx->DMIData->dmi_len) {
 		lb_log("Short read in DMI table");
-		free(ctx->DMIData->dmi_data);
-		ctx->DMIData->dmi_data = NULL;
+		goto fail;
+	}
+
+	if (lazybiosBuildIndex(ctx->DMIData) != 0)
+		lb_dbg("Structure index unavailable; parsers will walk the table");
+	return 0;
+
+fail:
+	// Callers fall back to other sources on the same context, which loaders only accept fresh.
+	lazybiosCTXReset(ctx);
+	return -1;
+}
+
+int lazybiosFileMapped(lazybiosCTX_t* ctx, const char* entry_path, const char* dmi_path) {
+	if (!ctx || !ctx->DMIData || !entry_path || !dmi_path) return -1;
+
+	void* base;
+	size_t dmi_len;
+	if (lazybiosMapFile(dmi_path, &base, &dmi_len) != 0) {
+		lb_dbg("Cannot map %s; reading it instead", dmi_path);
+		return lazybiosFile(ctx, entry_path, dmi_path);
+	}
+
+	FILE* entry = fopen(entry_path, "rb");
+	if (!entry) {
+		lb_log("Failed to open %s: %s", entry_path, strerror(errno));
+		lazybiosUnmapFile(base, dmi_len);
 		return -1;
 	}
+
+	uint8_t entry_buf[64];
+	size_t n = fread(entry_buf, 1, sizeof(entry_buf), entry);
+	fclose(entry);
+	if (n < 20) {
+		lb_log("Invalid SMBIOS entry point (%zu bytes)", n);
+		lazybiosUnmapFile(base, dmi_len);
+		return -1;
+	}
+
+	uint8_t* entry_copy = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, n);
+	if (entry_copy) memcpy(entry_copy, entry_buf, n);
+	if (!entry_copy || lazybiosAdoptBuffers(ctx, entry_copy, n, base, dmi_len, 0) != 0) {
+		lazybiosAllocatorFree(&ctx->DMIData->allocator, entry_copy);
+		lazybiosUnmapFile(base, dmi_len);
+		return -1;
+	}
+
+	ctx->DMIData->mapping = base;
+	ctx->DMIData->mapping_len = dmi_len;
 	return 0;
 }
 
+/*
+ * A context and its DMI container share one block, which remembers the hooks
+ * it came from; lazybiosSetAllocator() may give the context different ones.
+ */
+typedef struct {
+	lazybiosCTX_t ctx;
+	lazybiosDMI_t dmi;
+	lazybiosAllocator_t owner;
+} ctx_block;
+
 lazybiosCTX_t* lazybiosCTXNew(void) {
-	lazybiosCTX_t* ctx = calloc(1, sizeof(*ctx));
-	if (!ctx) return NULL;
+	lazybiosAllocator_t owner = lazybiosGlobalAllocator();
+	ctx_block* block = lazybiosAllocatorCalloc(&owner, 1, sizeof(*block));
+	if (!block) return NULL;
 
-	ctx->DMIData = calloc(1, sizeof(*ctx->DMIData));
-	if (!ctx->DMIData) {
-		free(ctx);
-		return NULL;
-	}
+	block->owner = owner;
+	block->dmi.allocator = owner;
+	lazybiosCTX_t* ctx = &block->ctx;
+	ctx->DMIData = &block->dmi;
 
 	#if defined(OS_LINUX)
 		ctx->backend = LAZYBIOS_BACKEND_LINUX;
@@ -361,22 +457,11 @@ const uint8_t* DMINext(const uint8_t* p, const uint8_t* end) {
 	uint8_t len = p[1];
 	if (len < SMBIOS_HEADER_SIZE || (size_t)(end - p) <= len) return end;
 
-	const uint8_t* next = p + len;
-
-	// Skip string section safely
-	while (next + 1 < end) {
-		if (next[0] == 0 && next[1] == 0)
-			break; // double null found
-		next++;
-	}
-
-	// Skip double-null terminator
-	if (next + 2 <= end) 
-		next += 2;
-	else
-		next = end;
+	// Skip the string section and its double-null terminator
+	const uint8_t* terminator = lazybiosFindDoubleNul(p + len, end);
+	if (!terminator) return end;
 
-	return next;
+	return terminator + 2;
 }
 
 const char* DMIString(const uint8_t* p, uint8_t length, uint8_t index, const uint8_t* end) {
@@ -386,10 +471,8 @@ const char* DMIString(const uint8_t* p, uint8_t length, uint8_t index, const uin
 
 	// Point to the start of the unformatted string area
 	const uint8_t* str = p + length;
-	const uint8_t* strings_end = str;
-	while (strings_end + 1 < end && (strings_end[0] != 0 || strings_end[1] != 0))
-		strings_end++;
-	if (strings_end + 1 >= end) return NULL;
+	const uint8_t* strings_end = lazybiosFindDoubleNul(str, end);
+	if (!strings_end) return NULL;
 
 	// Iterate until the selected string
 	for (uint8_t i = 1; i < index; i++) {
@@ -404,23 +487,19 @@ const char* DMIString(const uint8_t* p, uint8_t length, uint8_t index, const uin
     return (const char*)str;
 }
 
-int lazybiosIsVersionPlus(const lazybiosDMI_t* DMIData, uint8_t required_major, uint8_t required_minor) {
-	uint8_t major;
-	uint8_t minor;
-
+uint16_t lazybiosSMBIOSVersion(const lazybiosDMI_t* DMIData) {
 	if (!DMIData) return 0;
 
-	if (DMIData->entry_tag == SMBIOS_VER_3X && DMIData->entry_union.v3) {
-		major = DMIData->entry_union.v3->major_version;
-		minor = DMIData->entry_union.v3->minor_version;
-	} else if (DMIData->entry_tag == SMBIOS_VER_2X && DMIData->entry_union.v2) {
-		major = DMIData->entry_union.v2->major_version;
-		minor = DMIData->entry_union.v2->minor_version;
-	} else {
-		return 0;
-	}
+	if (DMIData->entry_tag == SMBIOS_VER_3X && DMIData->entry_union.v3)
+		return (uint16_t)(DMIData->entry_union.v3->major_version << 8 | DMIData->entry_union.v3->minor_version);
+	if (DMIData->entry_tag == SMBIOS_VER_2X && DMIData->entry_union.v2)
+		return (uint16_t)(DMIData->entry_union.v2->major_version << 8 | DMIData->entry_union.v2->minor_version);
+	return 0;
+}
 
-	return major > required_major || (major == required_major && minor >= required_minor);
+int lazybiosIsVersionPlus(const lazybiosDMI_t* DMIData, uint8_t required_major, uint8_t required_minor) {
+	uint16_t version = lazybiosSMBIOSVersion(DMIData);
+	return version != 0 && version >= (uint16_t)(required_major << 8 | required_minor);
 }
 
 static int lazybiosVerifyChecksum(const uint8_t* entry_buf, size_t len) {
@@ -520,6 +599,10 @@ int lazybiosParseEntry(lazybiosCTX_t* ctx, const uint8_t* entry_buf, size_t buf_
 size_t lazybiosCountStructsByType(const lazybiosDMI_t* DMIData, uint8_t target_type) {
 	if (!DMIData || !DMIData->dmi_data) return 0;
 
+	if (DMIData->index)
+		return DMIData->index->type_start[target_type + 1] -
+			DMIData->index->type_start[target_type];
+
 	size_t count = 0;
 	const uint8_t* p = DMIData->dmi_data;
 	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
@@ -548,204 +631,38 @@ void lazybiosPrintSMVer(const lazybiosCTX_t* ctx) {
 	}
 }
 
-int lazybiosCleanup(lazybiosCTX_t* ctx) {
-	if (!ctx) return -1;
-
-	lazybiosFreeType0(ctx->Type0, ctx->type0_count);
-	ctx->Type0 = NULL;
-	ctx->type0_count = 0;
-
-	lazybiosFreeType1(ctx->Type1, ctx->type1_count);
-	ctx->Type1 = NULL;
-	ctx->type1_count = 0;
-
-    lazybiosFreeType2(ctx->Type2, ctx->type2_count);
-    ctx->Type2 = NULL;
-    ctx->type2_count = 0;
-
-    lazybiosFreeType3(ctx->Type3, ctx->type3_count);
-    ctx->Type3 = NULL;
-    ctx->type3_count = 0;
-
-    lazybiosFreeType4(ctx->Type4, ctx->type4_count);
-    ctx->Type4 = NULL;
-    ctx->type4_count = 0;
-
-    lazybiosFreeType5(ctx->Type5, ctx->type5_count);
-    ctx->Type5 = NULL;
-    ctx->type5_count = 0;
-
-    lazybiosFreeType6(ctx->Type6, ctx->type6_count);
-    ctx->Type6 = NULL;
-    ctx->type6_count = 0;
-
-    lazybiosFreeType7(ctx->Type7, ctx->type7_count);
-    ctx->Type7 = NULL;
-    ctx->type7_count = 0;
-
-    lazybiosFreeType8(ctx->Type8, ctx->type8_count);
-    ctx->Type8 = NULL;
-    ctx->type8_count = 0;
-
-    lazybiosFreeType9(ctx->Type9, ctx->type9_count);
-    ctx->Type9 = NULL;
-    ctx->type9_count = 0;
-
-    lazybiosFreeType10(ctx->Type10, ctx->type10_count);
-    ctx->Type10 = NULL;
-    ctx->type10_count = 0;
-
-    lazybiosFreeType11(ctx->Type11, ctx->type11_count);
-    ctx->Type11 = NULL;
-    ctx->type11_count = 0;
-
-    lazybiosFreeType12(ctx->Type12, ctx->type12_count);
-    ctx->Type12 = NULL;
-    ctx->type12_count = 0;
-
-    lazybiosFreeType13(ctx->Type13, ctx->type13_count);
-    ctx->Type13 = NULL;
-    ctx->type13_count = 0;
-
-    lazybiosFreeType14(ctx->Type14, ctx->type14_count);
-    ctx->Type14 = NULL;
-    ctx->type14_count = 0;
-
-    lazybiosFreeType15(ctx->Type15, ctx->type15_count);
-    ctx->Type15 = NULL;
-    ctx->type15_count = 0;
-
-    lazybiosFreeType16(ctx->Type16, ctx->type16_count);
-    ctx->Type16 = NULL;
-    ctx->type16_count = 0;
-
-    lazybiosFreeType17(ctx->Type17, ctx->type17_count);
-    ctx->Type17 = NULL;
-    ctx->type17_count = 0;
-
-    lazybiosFreeType18(ctx->Type18, ctx->type18_count);
-    ctx->Type18 = NULL;
-    ctx->type18_count = 0;
-
-    lazybiosFreeType19(ctx->Type19, ctx->type19_count);
-    ctx->Type19 = NULL;
-    ctx->type19_count = 0;
-
-    lazybiosFreeType20(ctx->Type20, ctx->type20_count);
-    ctx->Type20 = NULL;
-    ctx->type20_count = 0;
-
-    lazybiosFreeType21(ctx->Type21, ctx->type21_count);
-    ctx->Type21 = NULL;
-    ctx->type21_count = 0;
-
-    lazybiosFreeType22(ctx->Type22, ctx->type22_count);
-    ctx->Type22 = NULL;
-    ctx->type22_count = 0;
-
-    lazybiosFreeType23(ctx->Type23, ctx->type23_count);
-    ctx->Type23 = NULL;
-    ctx->type23_count = 0;
-
-    lazybiosFreeType24(ctx->Type24, ctx->type24_count);
-    ctx->Type24 = NULL;
-    ctx->type24_count = 0;
-
-    lazybiosFreeType25(ctx->Type25, ctx->type25_count);
-    ctx->Type25 = NULL;
-    ctx->type25_count = 0;
-
-    lazybiosFreeType26(ctx->Type26, ctx->type26_count);
-    ctx->Type26 = NULL;
-    ctx->type26_count = 0;
-
-    lazybiosFreeType27(ctx->Type27, ctx->type27_count);
-    ctx->Type27 = NULL;
-    ctx->type27_count = 0;
-
-    lazybiosFreeType28(ctx->Type28, ctx->type28_count);
-    ctx->Type28 = NULL;
-    ctx->type28_count = 0;
-
-    lazybiosFreeType29(ctx->Type29, ctx->type29_count);
-    ctx->Type29 = NULL;
-    ctx->type29_count = 0;
-
-    lazybiosFreeType30(ctx->Type30, ctx->type30_count);
-    ctx->Type30 = NULL;
-    ctx->type30_count = 0;
-
-    lazybiosFreeType31(ctx->Type31, ctx->type31_count);
-    ctx->Type31 = NULL;
-    ctx->type31_count = 0;
-
-    lazybiosFreeType32(ctx->Type32, ctx->type32_count);
-    ctx->Type32 = NULL;
-    ctx->type32_count = 0;
-
-    lazybiosFreeType33(ctx->Type33, ctx->type33_count);
-    ctx->Type33 = NULL;
-    ctx->type33_count = 0;
-
-    lazybiosFreeType34(ctx->Type34, ctx->type34_count);
-    ctx->Type34 = NULL;
-    ctx->type34_count = 0;
-
-    lazybiosFreeType35(ctx->Type35, ctx->type35_count);
-    ctx->Type35 = NULL;
-    ctx->type35_count = 0;
-
-    lazybiosFreeType36(ctx->Type36, ctx->type36_count);
-    ctx->Type36 = NULL;
-    ctx->type36_count = 0;
-
-    lazybiosFreeType37(ctx->Type37, ctx->type37_count);
-    ctx->Type37 = NULL;
-    ctx->type37_count = 0;
-
-    lazybiosFreeType38(ctx->Type38, ctx->type38_count);
-    ctx->Type38 = NULL;
-    ctx->type38_count = 0;
-
-    lazybiosFreeType39(ctx->Type39, ctx->type39_count);
-    ctx->Type39 = NULL;
-    ctx->type39_count = 0;
-
-    lazybiosFreeType40(ctx->Type40, ctx->type40_count);
-    ctx->Type40 = NULL;
-    ctx->type40_count = 0;
-
-    lazybiosFreeType41(ctx->Type41, ctx->type41_count);
-    ctx->Type41 = NULL;
-    ctx->type41_count = 0;
-
-    lazybiosFreeType42(ctx->Type42, ctx->type42_count);
-    ctx->Type42 = NULL;
-    ctx->type42_count = 0;
+static void release_table(lazybiosDMI_t* DMIData) {
+	lazybiosFreeIndex(DMIData);
+	if (DMIData->mapping)
+		lazybiosUnmapFile(DMIData->mapping, DMIData->mapping_len);
+	else if (!DMIData->table_borrowed && !DMIData->table_in_entry_block)
+		lazybiosAllocatorFree(&DMIData->allocator, DMIData->dmi_data);
+	if (DMIData->release)
+		DMIData->release(DMIData->release_user);
+	lazybiosAllocatorFree(&DMIData->allocator, DMIData->entry_data);
+}
 
-    lazybiosFreeType43(ctx->Type43, ctx->type43_count);
-    ctx->Type43 = NULL;
-    ctx->type43_count = 0;
+int lazybiosCTXReset(lazybiosCTX_t* ctx) {
+	if (!ctx || !ctx->DMIData) return -1;
 
-    lazybiosFreeType44(ctx->Type44, ctx->type44_count);
-    ctx->Type44 = NULL;
-    ctx->type44_count = 0;
+	lazybiosReleaseParsed(ctx, 1);
+	release_table(ctx->DMIData);
 
-    lazybiosFreeType45(ctx->Type45, ctx->type45_count);
-    ctx->Type45 = NULL;
-    ctx->type45_count = 0;
+	// Loaders only accept a fresh context, so everything but the hooks is cleared.
+	const lazybiosAllocator_t allocator = ctx->DMIData->allocator;
+	memset(ctx->DMIData, 0, sizeof(*ctx->DMIData));
+	ctx->DMIData->allocator = allocator;
+	return 0;
+}
 
-    lazybiosFreeType46(ctx->Type46, ctx->type46_count);
-    ctx->Type46 = NULL;
-    ctx->type46_count = 0;
+int lazybiosCleanup(lazybiosCTX_t* ctx) {
+	if (!ctx) return -1;
 
-    lazybiosFreeOemHpType204(ctx->HpType204, ctx->hptype204_count);
-    ctx->HpType204 = NULL;
-    ctx->hptype204_count = 0;
+	lazybiosReleaseParsed(ctx, 0);
+	release_table(ctx->DMIData);
 
-	free(ctx->DMIData->dmi_data);
-	free(ctx->DMIData->entry_data);
-	free(ctx->DMIData);
-	free(ctx);
+	ctx_block* block = (ctx_block*)ctx;
+	lazybiosAllocator_t owner = block->owner;
+	lazybiosAllocatorFree(&owner, block);
 	return 0;
 }
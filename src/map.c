@@ -0,0 +1,113 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file map.c
+ * @brief Maps dump files read-only so a context can borrow their pages.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+#if defined(_WIN32)
+#	define MAP_WINDOWS 1
+#	include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__) || defined(__HAIKU__)
+#	define MAP_POSIX 1
+#	include <fcntl.h>
+#	include <stdint.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#if defined(MAP_POSIX)
+
+#ifndef O_CLOEXEC
+#	define O_CLOEXEC 0
+#endif
+
+int lazybiosMapFile(const char* path, void** base, size_t* len) {
+	if (!path || !base || !len) return -1;
+
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) return -1;
+
+	// Pseudo-files such as sysfs attributes report no usable size; they take the read path.
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+		(uintmax_t)st.st_size > SIZE_MAX) {
+		close(fd);
+		return -1;
+	}
+
+	void* mapped = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED) return -1;
+
+	*base = mapped;
+	*len = (size_t)st.st_size;
+	return 0;
+}
+
+void lazybiosUnmapFile(void* base, size_t len) {
+	if (base) munmap(base, len);
+}
+#elif defined(MAP_WINDOWS)
+int lazybiosMapFile(const char* path, void** base, size_t* len) {
+	if (!path || !base || !len) return -1;
+
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return -1;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || (unsigned long long)size.QuadPart > SIZE_MAX) {
+		CloseHandle(file);
+		return -1;
+	}
+
+	// The view keeps the mapping object and the file alive after both handles close.
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping) return -1;
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view) return -1;
+
+	*base = view;
+	*len = (size_t)size.QuadPart;
+	return 0;
+}
+
+void lazybiosUnmapFile(void* base, size_t len) {
+	(void)len;
+	if (base) UnmapViewOfFile(base);
+}
+#else
+int lazybiosMapFile(const char* path, void** base, size_t* len) {
+	(void)path;
+	(void)base;
+	(void)len;
+	return -1;
+}
+
+void lazybiosUnmapFile(void* base, size_t len) {
+	(void)base;
+	(void)len;
+}
+#endif
@@ -0,0 +1,384 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file parse.c
+ * @brief Maps SMBIOS types to their decoders and parses whole tables in one walk.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <string.h>
+
+// The free functions take typed arrays; the table needs one signature for all of them.
+#define RELEASE(release_fn, record_type) \
+	static void release_fn##Records(void* records, size_t count) { \
+		release_fn((record_type*)records, count); \
+	}
+
+RELEASE(lazybiosFreeType0, lazybiosType0_t)
+RELEASE(lazybiosFreeType1, lazybiosType1_t)
+RELEASE(lazybiosFreeType2, lazybiosType2_t)
+RELEASE(lazybiosFreeType3, lazybiosType3_t)
+RELEASE(lazybiosFreeType4, lazybiosType4_t)
+RELEASE(lazybiosFreeType5, lazybiosType5_t)
+RELEASE(lazybiosFreeType6, lazybiosType6_t)
+RELEASE(lazybiosFreeType7, lazybiosType7_t)
+RELEASE(lazybiosFreeType8, lazybiosType8_t)
+RELEASE(lazybiosFreeType9, lazybiosType9_t)
+RELEASE(lazybiosFreeType10, lazybiosType10_t)
+RELEASE(lazybiosFreeType11, lazybiosType11_t)
+RELEASE(lazybiosFreeType12, lazybiosType12_t)
+RELEASE(lazybiosFreeType13, lazybiosType13_t)
+RELEASE(lazybiosFreeType14, lazybiosType14_t)
+RELEASE(lazybiosFreeType15, lazybiosType15_t)
+RELEASE(lazybiosFreeType16, lazybiosType16_t)
+RELEASE(lazybiosFreeType17, lazybiosType17_t)
+RELEASE(lazybiosFreeType18, lazybiosType18_t)
+RELEASE(lazybiosFreeType19, lazybiosType19_t)
+RELEASE(lazybiosFreeType20, lazybiosType20_t)
+RELEASE(lazybiosFreeType21, lazybiosType21_t)
+RELEASE(lazybiosFreeType22, lazybiosType22_t)
+RELEASE(lazybiosFreeType23, lazybiosType23_t)
+RELEASE(lazybiosFreeType24, lazybiosType24_t)
+RELEASE(lazybiosFreeType25, lazybiosType25_t)
+RELEASE(lazybiosFreeType26, lazybiosType26_t)
+RELEASE(lazybiosFreeType27, lazybiosType27_t)
+RELEASE(lazybiosFreeType28, lazybiosType28_t)
+RELEASE(lazybiosFreeType29, lazybiosType29_t)
+RELEASE(lazybiosFreeType30, lazybiosType30_t)
+RELEASE(lazybiosFreeType31, lazybiosType31_t)
+RELEASE(lazybiosFreeType32, lazybiosType32_t)
+RELEASE(lazybiosFreeType33, lazybiosType33_t)
+RELEASE(lazybiosFreeType34, lazybiosType34_t)
+RELEASE(lazybiosFreeType35, lazybiosType35_t)
+RELEASE(lazybiosFreeType36, lazybiosType36_t)
+RELEASE(lazybiosFreeType37, lazybiosType37_t)
+RELEASE(lazybiosFreeType38, lazybiosType38_t)
+RELEASE(lazybiosFreeType39, lazybiosType39_t)
+RELEASE(lazybiosFreeType40, lazybiosType40_t)
+RELEASE(lazybiosFreeType41, lazybiosType41_t)
+RELEASE(lazybiosFreeType42, lazybiosType42_t)
+RELEASE(lazybiosFreeType43, lazybiosType43_t)
+RELEASE(lazybiosFreeType44, lazybiosType44_t)
+RELEASE(lazybiosFreeType45, lazybiosType45_t)
+RELEASE(lazybiosFreeType46, lazybiosType46_t)
+RELEASE(lazybiosFreeOemDellType177, lazybiosOemDellType177_t)
+RELEASE(lazybiosFreeOemDellType212, lazybiosOemDellType212_t)
+RELEASE(lazybiosFreeOemHpType204, lazybiosOemHpType204_t)
+
+#define TYPE(decode, release, records, count, record_type, oem, fields) \
+	{ decode, release##Records, offsetof(lazybiosCTX_t, records), offsetof(lazybiosCTX_t, count), \
+	  sizeof(record_type), oem, fields }
+
+#define STANDARD(n) \
+	[n] = TYPE(lazybiosDecodeType##n, lazybiosFreeType##n, Type##n, type##n##_count, lazybiosType##n##_t, 0, \
+		lazybiosType##n##Fields)
+
+const lazybiosTypeInfo lazybiosTypeTable[256] = {
+	STANDARD(0), STANDARD(1), STANDARD(2), STANDARD(3), STANDARD(4), STANDARD(5),
+	STANDARD(6), STANDARD(7), STANDARD(8), STANDARD(9), STANDARD(10), STANDARD(11),
+	STANDARD(12), STANDARD(13), STANDARD(14), STANDARD(15), STANDARD(16), STANDARD(17),
+	STANDARD(18), STANDARD(19), STANDARD(20), STANDARD(21), STANDARD(22), STANDARD(23),
+	STANDARD(24), STANDARD(25), STANDARD(26), STANDARD(27), STANDARD(28), STANDARD(29),
+	STANDARD(30), STANDARD(31), STANDARD(32), STANDARD(33), STANDARD(34), STANDARD(35),
+	STANDARD(36), STANDARD(37), STANDARD(38), STANDARD(39), STANDARD(40), STANDARD(41),
+	STANDARD(42), STANDARD(43), STANDARD(44), STANDARD(45), STANDARD(46),
+	[SMBIOS_OEM_DELL_TYPE177] = TYPE(lazybiosDecodeOemDellType177, lazybiosFreeOemDellType177,
+		DellType177, delltype177_count, lazybiosOemDellType177_t, 1, lazybiosOemDellType177Fields),
+	[SMBIOS_OEM_HP_TYPE204] = TYPE(lazybiosDecodeOemHpType204, lazybiosFreeOemHpType204,
+		HpType204, hptype204_count, lazybiosOemHpType204_t, 1, lazybiosOemHpType204Fields),
+	[SMBIOS_OEM_DELL_TYPE212] = TYPE(lazybiosDecodeOemDellType212, lazybiosFreeOemDellType212,
+		DellType212, delltype212_count, lazybiosOemDellType212_t, 1, lazybiosOemDellType212Fields),
+};
+
+static void** ctx_records(lazybiosCTX_t* ctx, const lazybiosTypeInfo* info) {
+	return (void**)((uint8_t*)ctx + info->records);
+}
+
+static size_t* ctx_count(lazybiosCTX_t* ctx, const lazybiosTypeInfo* info) {
+	return (size_t*)((uint8_t*)ctx + info->count);
+}
+
+static int type_parsed(const lazybiosCTX_t* ctx, uint8_t type) {
+	return (int)((ctx->parsed_types[type / 64] >> (type % 64)) & 1);
+}
+
+static void mark_parsed(lazybiosCTX_t* ctx, uint8_t type) {
+	ctx->parsed_types[type / 64] |= UINT64_C(1) << (type % 64);
+}
+
+lazybiosArena_t* lazybiosCTXArena(lazybiosCTX_t* ctx) {
+	if (!ctx->arena) ctx->arena = lazybiosArenaNew(&ctx->DMIData->allocator, ctx->DMIData->dmi_len);
+	return ctx->arena;
+}
+
+// A type needs parsing when neither the caller nor an earlier parse filled it.
+static int type_pending(lazybiosCTX_t* ctx, uint8_t type) {
+	const lazybiosTypeInfo* info = &lazybiosTypeTable[type];
+	return info->decode && !*ctx_records(ctx, info) && !type_parsed(ctx, type);
+}
+
+// Structures handed to a parse worker at a time; enough to amortize one claim.
+#define PARSE_GRAIN 64
+// Pool size cap: past this, workers mostly wait on memory bandwidth.
+#define PARSE_MAX_THREADS 8
+
+typedef struct {
+	uint8_t type;
+	size_t begin;
+	size_t end;
+} parse_item;
+
+typedef struct {
+	const lazybiosDMI_t* DMIData;
+	uint8_t* const* records;
+	const parse_item* items;
+	size_t item_count;
+	volatile size_t next;
+	volatile size_t failed;
+} parse_job;
+
+typedef struct {
+	parse_job* job;
+	lazybiosArena_t* arena;
+	lazybiosThread* thread;
+} parse_worker;
+
+/*
+ * Every item names a run of one type's index slots, and record k of that type
+ * always lands in slot k of its array, so the result does not depend on which
+ * worker decodes what. Nested arrays come from the worker's own arena.
+ */
+static void parse_worker_run(void* arg) {
+	parse_worker* worker = arg;
+	parse_job* job = worker->job;
+
+	for (;;) {
+		size_t i = lazybiosAtomicFetchAdd(&job->next, 1);
+		if (i >= job->item_count || lazybiosAtomicLoad(&job->failed)) return;
+
+		const parse_item* item = &job->items[i];
+		const lazybiosTypeInfo* info = &lazybiosTypeTable[item->type];
+		lazybiosStructCursor cursor;
+		lazybiosStructCursorInit(&cursor, job->DMIData, item->type);
+		cursor.arena = worker->arena;
+		cursor.position = item->begin;
+		for (size_t k = item->begin; k < item->end && lazybiosStructCursorNext(&cursor); k++) {
+			if (info->decode(job->records[item->type] + k * info->size, &cursor) != 0) {
+				lazybiosAtomicStore(&job->failed, 1);
+				return;
+			}
+		}
+	}
+}
+
+static int parse_parallel(lazybiosCTX_t* ctx, uint8_t* const records[256], const size_t histogram[256], unsigned threads) {
+	const lazybiosDMI_t* DMIData = ctx->DMIData;
+	const lazybiosAllocator_t* allocator = &DMIData->allocator;
+
+	size_t item_count = 0;
+	for (size_t t = 0; t < 256; t++)
+		if (records[t]) item_count += (histogram[t] + PARSE_GRAIN - 1) / PARSE_GRAIN;
+
+	parse_item* items = lazybiosAllocatorCalloc(allocator, item_count, sizeof(*items));
+	parse_worker* workers = lazybiosAllocatorCalloc(allocator, threads, sizeof(*workers));
+	if (!items || !workers) {
+		lazybiosAllocatorFree(allocator, items);
+		lazybiosAllocatorFree(allocator, workers);
+		return -1;
+	}
+
+	size_t n = 0;
+	for (size_t t = 0; t < 256; t++) {
+		if (!records[t]) continue;
+		for (size_t begin = 0; begin < histogram[t]; begin += PARSE_GRAIN) {
+			items[n].type = (uint8_t)t;
+			items[n].begin = begin;
+			items[n].end = histogram[t] - begin > PARSE_GRAIN ? begin + PARSE_GRAIN : histogram[t];
+			n++;
+		}
+	}
+
+	parse_job job;
+	memset(&job, 0, sizeof(job));
+	job.DMIData = DMIData;
+	job.records = records;
+	job.items = items;
+	job.item_count = item_count;
+
+	// The calling thread decodes into the context's arena; a worker that cannot start leaves its share to the rest.
+	workers[0].job = &job;
+	workers[0].arena = ctx->arena;
+	for (unsigned w = 1; w < threads; w++) {
+		workers[w].job = &job;
+		workers[w].arena = lazybiosArenaNew(allocator, DMIData->dmi_len / threads);
+		if (workers[w].arena) workers[w].thread = lazybiosThreadStart(parse_worker_run, &workers[w]);
+	}
+	parse_worker_run(&workers[0]);
+	for (unsigned w = 1; w < threads; w++) {
+		lazybiosThreadJoin(workers[w].thread);
+		lazybiosArenaAdopt(ctx->arena, workers[w].arena);
+	}
+
+	lazybiosAllocatorFree(allocator, items);
+	lazybiosAllocatorFree(allocator, workers);
+	return job.failed ? -1 : 0;
+}
+
+int lazybiosParseAllThreads(lazybiosCTX_t* ctx, unsigned flags, unsigned threads) {
+	if (!ctx || !ctx->DMIData || !ctx->DMIData->dmi_data) return -1;
+
+	const lazybiosDMI_t* DMIData = ctx->DMIData;
+	lazybiosArena_t* arena = lazybiosCTXArena(ctx);
+	lazybiosStructCursor cursor;
+	size_t histogram[256] = {0};
+
+	if (DMIData->index) {
+		for (size_t t = 0; t < 256; t++)
+			histogram[t] = DMIData->index->type_start[t + 1] - DMIData->index->type_start[t];
+	} else {
+		lazybiosStructCursorInitAll(&cursor, DMIData);
+		while (lazybiosStructCursorNext(&cursor))
+			histogram[cursor.p[0]]++;
+	}
+
+	uint8_t wanted[256] = {0};
+	uint8_t* records[256] = {0};
+	size_t filled[256] = {0};
+	size_t pending = 0;
+	for (size_t t = 0; t < 256; t++) {
+		if (!type_pending(ctx, (uint8_t)t)) continue;
+		if (lazybiosTypeTable[t].oem && !(flags & LAZYBIOS_PARSE_OEM)) continue;
+		wanted[t] = 1;
+		if (histogram[t] == 0) continue;
+
+		records[t] = lazybiosArenaAlloc(arena, histogram[t], lazybiosTypeTable[t].size);
+		if (!records[t]) goto fail;
+		pending += histogram[t];
+	}
+
+	if (threads == 0 && (flags & LAZYBIOS_PARSE_PARALLEL) && pending >= LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES) {
+		threads = lazybiosCPUCount();
+		if (threads > PARSE_MAX_THREADS) threads = PARSE_MAX_THREADS;
+	}
+	if (threads > pending / PARSE_GRAIN) threads = (unsigned)(pending / PARSE_GRAIN);
+	// Worker arenas grow through the context's hooks, and custom ones need not be thread-safe.
+	if (threads >= 2 && !lazybiosAllocatorIsDefault(&DMIData->allocator)) {
+		lb_dbg("Parsing on the calling thread because custom allocator hooks are installed");
+		threads = 0;
+	}
+
+	// Work can only be split up front through the index; without one the table is walked.
+	if (threads >= 2 && DMIData->index) {
+		if (parse_parallel(ctx, records, histogram, threads) != 0) goto fail;
+		memcpy(filled, histogram, sizeof(filled));
+	} else {
+		lazybiosStructCursorInitAll(&cursor, DMIData);
+		cursor.arena = arena;
+		while (lazybiosStructCursorNext(&cursor)) {
+			uint8_t type = cursor.p[0];
+			if (!records[type] || filled[type] == histogram[type]) continue;
+
+			const lazybiosTypeInfo* info = &lazybiosTypeTable[type];
+			if (info->decode(records[type] + filled[type]++ * info->size, &cursor) != 0) goto fail;
+		}
+	}
+
+	for (size_t t = 0; t < 256; t++) {
+		if (!wanted[t]) continue;
+		*ctx_records(ctx, &lazybiosTypeTable[t]) = records[t];
+		*ctx_count(ctx, &lazybiosTypeTable[t]) = filled[t];
+		mark_parsed(ctx, (uint8_t)t);
+	}
+	return 0;
+
+fail:
+	// Whatever was decoded stays in the arena until the context is cleaned up.
+	lb_log("Failed to allocate parsed structures");
+	return -1;
+}
+
+int lazybiosParseAll(lazybiosCTX_t* ctx, unsigned flags) {
+	return lazybiosParseAllThreads(ctx, flags, 0);
+}
+
+static int parse_type(lazybiosCTX_t* ctx, uint8_t type) {
+	const lazybiosTypeInfo* info = &lazybiosTypeTable[type];
+	size_t count = lazybiosCountStructsByType(ctx->DMIData, type);
+	uint8_t* records = NULL;
+	size_t index = 0;
+
+	if (count > 0) {
+		lazybiosArena_t* arena = lazybiosCTXArena(ctx);
+		records = lazybiosArenaAlloc(arena, count, info->size);
+		if (!records) return -1;
+
+		lazybiosStructCursor cursor;
+		lazybiosStructCursorInit(&cursor, ctx->DMIData, type);
+		cursor.arena = arena;
+		while (index < count && lazybiosStructCursorNext(&cursor)) {
+			if (info->decode(records + index * info->size, &cursor) != 0) return -1;
+			index++;
+		}
+	}
+
+	*ctx_records(ctx, info) = records;
+	*ctx_count(ctx, info) = index;
+	mark_parsed(ctx, type);
+	return 0;
+}
+
+void* lazybiosCTXGetType(lazybiosCTX_t* ctx, uint8_t type, size_t* count) {
+	if (count) *count = 0;
+	if (!ctx || !count || !ctx->DMIData || !ctx->DMIData->dmi_data) return NULL;
+
+	const lazybiosTypeInfo* info = &lazybiosTypeTable[type];
+	if (!info->decode) return NULL;
+	if (type_pending(ctx, type) && parse_type(ctx, type) != 0) return NULL;
+
+	*count = *ctx_count(ctx, info);
+	return *ctx_records(ctx, info);
+}
+
+uint8_t* lazybiosBytesCopy(lazybiosBytes_t bytes) {
+	if (!bytes.ptr || bytes.len == 0) return NULL;
+
+	uint8_t* copy = lazybiosAllocatorMalloc(NULL, bytes.len);
+	if (copy) memcpy(copy, bytes.ptr, bytes.len);
+	return copy;
+}
+
+void lazybiosReleaseParsed(lazybiosCTX_t* ctx, int keep_arena) {
+	for (size_t t = 0; t < 256; t++) {
+		const lazybiosTypeInfo* info = &lazybiosTypeTable[t];
+		if (!info->decode) continue;
+
+		// Arrays the caller assigned from a getter are still on the heap.
+		void* records = *ctx_records(ctx, info);
+		if (!lazybiosArenaOwns(ctx->arena, records)) info->release(records, *ctx_count(ctx, info));
+		*ctx_records(ctx, info) = NULL;
+		*ctx_count(ctx, info) = 0;
+	}
+	memset(ctx->parsed_types, 0, sizeof(ctx->parsed_types));
+	if (keep_arena) {
+		lazybiosArenaReset(ctx->arena);
+		return;
+	}
+	lazybiosArenaFree(ctx->arena);
+	ctx->arena = NULL;
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file physmem.c
+ * @brief Reads the entry point and table out of a physical-memory device.
+ * @author LazySeldi
+ */
+#if (defined(__HAIKU__) || defined(__BEOS__) || defined(__BeOS) || defined(_BEOS)) && \
+	!defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "lazybios_internal.h"
+
+#if defined(__unix__) || defined(__APPLE__) || defined(__HAIKU__) || \
+	defined(__BEOS__) || defined(__BeOS) || defined(_BEOS)
+#	define PHYSMEM_POSIX 1
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <limits.h>
+#	include <stdint.h>
+#	include <sys/mman.h>
+#	include <sys/types.h>
+#	include <unistd.h>
+#endif
+
+#if defined(PHYSMEM_POSIX)
+
+#ifndef O_CLOEXEC
+#	define O_CLOEXEC 0
+#endif
+
+static int physmem_offset(uint64_t address, off_t* out) {
+	uint64_t off_t_max = ((uint64_t)1 << (sizeof(off_t) * CHAR_BIT - 1)) - 1;
+	if (address > off_t_max) return -1;
+	*out = (off_t)address;
+	return 0;
+}
+
+/*
+ * Reads up to len bytes at address and returns how many arrived; a short count
+ * means the device ended. Some kernels refuse read() on ranges they will still
+ * map, so a failed first read falls back to mapping just the pages involved.
+ */
+static size_t physmem_read(int fd, uint64_t address, uint8_t* buf, size_t len) {
+	size_t got = 0;
+	while (got < len) {
+		off_t offset;
+		if (got > UINT64_MAX - address || physmem_offset(address + got, &offset) != 0) break;
+		ssize_t n = pread(fd, buf + got, len - got, offset);
+		if (n < 0 && errno == EINTR) continue;
+		if (n <= 0) {
+			if (n < 0 && got == 0) break;
+			return got;
+		}
+		got += (size_t)n;
+	}
+	if (got != 0) return got;
+
+	long page_size = sysconf(_SC_PAGESIZE);
+	off_t offset;
+	if (page_size <= 0 || physmem_offset(address, &offset) != 0) return 0;
+
+	size_t page_offset = (size_t)(address % (uint64_t)page_size);
+	if (len > SIZE_MAX - page_offset - (size_t)page_size) return 0;
+	size_t map_size = (len + page_offset + (size_t)page_size - 1) & ~((size_t)page_size - 1);
+
+	void* mapped = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, offset - (off_t)page_offset);
+	if (mapped == MAP_FAILED) {
+		lb_dbg("Failed to read or map 0x%llx: %s", (unsigned long long)address, strerror(errno));
+		return 0;
+	}
+	memcpy(buf, (const uint8_t*)mapped + page_offset, len);
+	munmap(mapped, map_size);
+	return len;
+}
+
+/*
+ * The scan window is read once. The final buffer holds the entry point and the
+ * table back to back, so the context frees a single block: a table inside the
+ * window is copied out of it, and one anywhere else is read straight into place.
+ */
+int lazybiosLoadPhysicalMemory(lazybiosCTX_t* ctx, const char* path, uint64_t scan_base) {
+	if (!ctx || !ctx->DMIData || !path) return -1;
+
+	int fd;
+	do {
+		fd = open(path, O_RDONLY | O_CLOEXEC);
+	} while (fd < 0 && errno == EINTR);
+	if (fd < 0) {
+		lb_log("Failed to open %s, check that you have permission to read it", path);
+		lb_dbg("Error: %s", strerror(errno));
+		return -1;
+	}
+
+	const lazybiosAllocator_t* allocator = &ctx->DMIData->allocator;
+	uint8_t* window = lazybiosAllocatorMalloc(allocator, LAZYBIOS_PHYS_SCAN_SIZE);
+	uint8_t* buf = NULL;
+	int result = -1;
+	if (!window) {
+		lb_log("Failed to allocate the SMBIOS scan window");
+		goto done;
+	}
+
+	size_t window_len = physmem_read(fd, scan_base, window, LAZYBIOS_PHYS_SCAN_SIZE);
+	size_t entry_offset = 0;
+	size_t entry_len = 0;
+	uint64_t table_addr = 0;
+	size_t table_len = 0;
+	if (lazybiosFindSMBIOSEntryPoint(window, window_len, &entry_offset, &entry_len) != 0 ||
+		lazybiosGetSMBIOSTableLocation(window + entry_offset, window_len - entry_offset,
+			&entry_len, &table_addr, &table_len) != 0) {
+		lb_log("SMBIOS/DMI signature not found in %s", path);
+		goto done;
+	}
+
+	if (table_len > SIZE_MAX - entry_len) goto done;
+	buf = lazybiosAllocatorMalloc(allocator, entry_len + table_len);
+	if (!buf) {
+		lb_log("Failed to allocate DMI buffer (%zu bytes)", table_len);
+		goto done;
+	}
+	memcpy(buf, window + entry_offset, entry_len);
+
+	if (table_addr >= scan_base && table_addr - scan_base <= window_len &&
+		table_len <= window_len - (size_t)(table_addr - scan_base)) {
+		memcpy(buf + entry_len, window + (size_t)(table_addr - scan_base), table_len);
+	} else if (physmem_read(fd, table_addr, buf + entry_len, table_len) != table_len) {
+		lb_log("Failed to read DMI/SMBIOS table at 0x%016llx", (unsigned long long)table_addr);
+		goto done;
+	}
+
+	if (lazybiosAdoptBuffers(ctx, buf, entry_len, buf + entry_len, table_len, 0) == 0) {
+		ctx->DMIData->table_in_entry_block = 1;
+		buf = NULL;
+		result = 0;
+	}
+
+done:
+	lazybiosAllocatorFree(allocator, buf);
+	lazybiosAllocatorFree(allocator, window);
+	close(fd);
+	return result;
+}
+#else
+int lazybiosLoadPhysicalMemory(lazybiosCTX_t* ctx, const char* path, uint64_t scan_base) {
+	(void)ctx;
+	(void)path;
+	(void)scan_base;
+	return -1;
+}
+#endif
@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file scan.c
+ * @brief Finds the double-NUL terminators that end SMBIOS string-sets.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#	define SCAN_SSE2 1
+#	include <emmintrin.h>
+#	if defined(__GNUC__)
+#		define SCAN_AVX2 1
+#		include <immintrin.h>
+#	endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#	define SCAN_NEON 1
+#	include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+static unsigned scan_ctz(uint64_t mask) {
+	unsigned long bit;
+	_BitScanForward64(&bit, mask);
+	return (unsigned)bit;
+}
+#else
+static unsigned scan_ctz(uint64_t mask) {
+	return (unsigned)__builtin_ctzll(mask);
+}
+#endif
+
+const uint8_t* lazybiosFindDoubleNulScalar(const uint8_t* p, const uint8_t* end) {
+	while (p + 1 < end) {
+		if (p[0] == 0 && p[1] == 0) return p;
+		p++;
+	}
+	return NULL;
+}
+
+/*
+ * The vector loops compare a block and the same block shifted by one byte, so
+ * a block starting at p needs its width plus one readable byte. Whatever is
+ * left over goes to the scalar loop.
+ */
+#ifdef SCAN_SSE2
+static const uint8_t* find_double_nul_sse2(const uint8_t* p, const uint8_t* end) {
+	const __m128i zero = _mm_setzero_si128();
+	while ((size_t)(end - p) > 16) {
+		__m128i here = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), zero);
+		__m128i next = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 1)), zero);
+		unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(here, next));
+		if (mask) return p + scan_ctz(mask);
+		p += 16;
+	}
+	return lazybiosFindDoubleNulScalar(p, end);
+}
+#endif
+
+#ifdef SCAN_AVX2
+__attribute__((target("avx2")))
+static const uint8_t* find_double_nul_avx2(const uint8_t* p, const uint8_t* end) {
+	const __m256i zero = _mm256_setzero_si256();
+	while ((size_t)(end - p) > 32) {
+		__m256i here = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)p), zero);
+		__m256i next = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p + 1)), zero);
+		uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(here, next));
+		if (mask) return p + scan_ctz(mask);
+		p += 32;
+	}
+	return find_double_nul_sse2(p, end);
+}
+#endif
+
+#ifdef SCAN_NEON
+static const uint8_t* find_double_nul_neon(const uint8_t* p, const uint8_t* end) {
+	while ((size_t)(end - p) > 16) {
+		uint8x16_t here = vceqzq_u8(vld1q_u8(p));
+		uint8x16_t next = vceqzq_u8(vld1q_u8(p + 1));
+		// Narrow each byte of the comparison to a nibble of a 64-bit mask.
+		uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(vandq_u8(here, next)), 4);
+		uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+		if (mask) return p + scan_ctz(mask) / 4;
+		p += 16;
+	}
+	return lazybiosFindDoubleNulScalar(p, end);
+}
+#endif
+
+typedef const uint8_t* (*find_double_nul_fn)(const uint8_t* p, const uint8_t* end);
+
+#if defined(SCAN_AVX2)
+static find_double_nul_fn find_double_nul = find_double_nul_sse2;
+
+// Picks the widest implementation the CPU supports once, before any caller runs.
+__attribute__((constructor))
+static void find_double_nul_select(void) {
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) find_double_nul = find_double_nul_avx2;
+}
+#elif defined(SCAN_SSE2)
+static const find_double_nul_fn find_double_nul = find_double_nul_sse2;
+#elif defined(SCAN_NEON)
+static const find_double_nul_fn find_double_nul = find_double_nul_neon;
+#else
+static const find_double_nul_fn find_double_nul = lazybiosFindDoubleNulScalar;
+#endif
+
+const uint8_t* lazybiosFindDoubleNul(const uint8_t* p, const uint8_t* end) {
+	if (!p || !end || p >= end) return NULL;
+	return find_double_nul(p, end);
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file snapshot.c
+ * @brief Freezes a fully parsed context behind an atomic reference count.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+struct lazybiosSnapshot {
+	lazybiosCTX_t* ctx;
+	long refs;
+};
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+static void snapshot_ref_inc(long* refs) {
+	_InterlockedIncrement(refs);
+}
+
+static long snapshot_ref_dec(long* refs) {
+	return _InterlockedDecrement(refs);
+}
+#else
+// A new reference is always taken through an existing one, so it needs no ordering.
+static void snapshot_ref_inc(long* refs) {
+	__atomic_fetch_add(refs, 1, __ATOMIC_RELAXED);
+}
+
+// Every reader's accesses must happen before the thread that frees the snapshot.
+static long snapshot_ref_dec(long* refs) {
+	return __atomic_sub_fetch(refs, 1, __ATOMIC_ACQ_REL);
+}
+#endif
+
+lazybiosSnapshot_t* lazybiosSnapshotNew(lazybiosCTX_t* ctx) {
+	if (!ctx || !ctx->DMIData || !ctx->DMIData->dmi_data) return NULL;
+
+	/*
+	 * Once every type with a decoder is parsed, lazybiosCTXGetType() only
+	 * reads the context, which is what makes unsynchronized readers safe.
+	 */
+	if (lazybiosParseAll(ctx, LAZYBIOS_PARSE_OEM) != 0) return NULL;
+
+	lazybiosSnapshot_t* snapshot = lazybiosAllocatorMalloc(&ctx->DMIData->allocator, sizeof(*snapshot));
+	if (!snapshot) return NULL;
+
+	snapshot->ctx = ctx;
+	snapshot->refs = 1;
+	return snapshot;
+}
+
+lazybiosSnapshot_t* lazybiosSnapshotRetain(lazybiosSnapshot_t* snapshot) {
+	if (snapshot) snapshot_ref_inc(&snapshot->refs);
+	return snapshot;
+}
+
+void lazybiosSnapshotRelease(lazybiosSnapshot_t* snapshot) {
+	if (!snapshot || snapshot_ref_dec(&snapshot->refs) != 0) return;
+
+	// The hooks live in the context block that lazybiosCleanup() frees.
+	const lazybiosAllocator_t allocator = snapshot->ctx->DMIData->allocator;
+	lazybiosCleanup(snapshot->ctx);
+	lazybiosAllocatorFree(&allocator, snapshot);
+}
+
+const lazybiosCTX_t* lazybiosSnapshotCTX(const lazybiosSnapshot_t* snapshot) {
+	return snapshot ? snapshot->ctx : NULL;
+}
+
+const void* lazybiosSnapshotGetType(const lazybiosSnapshot_t* snapshot, uint8_t type, size_t* count) {
+	if (count) *count = 0;
+	if (!snapshot) return NULL;
+	return lazybiosCTXGetType(snapshot->ctx, type, count);
+}
@@ -0,0 +1,156 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file stream.c
+ * @brief Decodes a DMI table that arrives in chunks, one structure at a time.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+#include <string.h>
+
+typedef enum {
+	STREAM_RUNNING,
+	STREAM_DONE,
+	STREAM_FAILED
+} stream_state;
+
+struct lazybiosStream {
+	lazybiosVisitFn callback;
+	void* user;
+	stream_state state;
+	lazybiosDMI_t dmi;
+	size_t used;     // Bytes of buf holding input not yet emitted.
+	size_t scanned;  // String-set bytes of the pending structure known to hold no terminator.
+	uint8_t entry[UINT8_MAX];
+	uint8_t buf[LAZYBIOS_STREAM_MAX_STRUCTURE];
+	lazybiosIter_t it;
+};
+
+lazybiosStream_t* lazybiosStreamNew(const uint8_t* entry, size_t entry_len, lazybiosVisitFn callback, void* user) {
+	if (!callback) return NULL;
+
+	lazybiosEntryInspection inspection;
+	if (lazybiosInspectEntryPoint(entry, entry_len, &inspection) != 0) {
+		lb_log("Invalid SMBIOS entry point");
+		return NULL;
+	}
+
+	lazybiosStream_t* stream = lazybiosCalloc(1, sizeof(*stream));
+	if (!stream) {
+		lb_log("Failed to allocate stream");
+		return NULL;
+	}
+
+	stream->callback = callback;
+	stream->user = user;
+	memcpy(stream->entry, entry, inspection.length);
+	stream->dmi.entry_data = stream->entry;
+	stream->dmi.entry_len = inspection.length;
+	stream->dmi.entry_tag = inspection.tag;
+	if (inspection.tag == SMBIOS_VER_3X)
+		stream->dmi.entry_union.v3 = (lazybiosSMBIOS3Entry*)stream->entry;
+	else
+		stream->dmi.entry_union.v2 = (lazybiosSMBIOS2Entry*)stream->entry;
+	return stream;
+}
+
+// Hands one complete structure to the callback; returns non-zero if it stops the stream.
+static int stream_emit(lazybiosStream_t* stream, const uint8_t* p, size_t size) {
+	stream->dmi.dmi_data = (uint8_t*)p;
+	stream->dmi.dmi_len = size;
+
+	lazybiosIterBeginDMI(&stream->it, &stream->dmi, NULL, p[0]);
+	lazybiosIterNext(&stream->it);
+	return stream->callback(&stream->it, lazybiosIterRecord(&stream->it), stream->user);
+}
+
+// Emits every complete structure in the buffer and keeps the unfinished tail.
+static int stream_drain(lazybiosStream_t* stream) {
+	size_t start = 0;
+	int rc = 0;
+
+	while (stream->used - start >= SMBIOS_HEADER_SIZE) {
+		const uint8_t* p = stream->buf + start;
+		const uint8_t* end = stream->buf + stream->used;
+		uint8_t len = p[1];
+		if (len < SMBIOS_HEADER_SIZE) {
+			lb_log("Stream structure at type %u has invalid length %u", p[0], len);
+			rc = -1;
+			break;
+		}
+		if ((size_t)(end - p) < (size_t)len + 2) break;
+
+		// Resume one byte early so a terminator split across chunks is found.
+		size_t from = stream->scanned > 0 ? stream->scanned - 1 : 0;
+		const uint8_t* terminator = lazybiosFindDoubleNul(p + len + from, end);
+		if (!terminator) {
+			stream->scanned = (size_t)(end - p) - len;
+			break;
+		}
+
+		size_t size = (size_t)(terminator + 2 - p);
+		stream->scanned = 0;
+		start += size;
+		if (p[0] == SMBIOS_TYPE_END) {
+			rc = 1;
+			break;
+		}
+		if (stream_emit(stream, p, size) != 0) {
+			rc = 1;
+			break;
+		}
+	}
+
+	stream->used -= start;
+	memmove(stream->buf, stream->buf + start, stream->used);
+	return rc;
+}
+
+int lazybiosStreamFeed(lazybiosStream_t* stream, const void* bytes, size_t n) {
+	if (!stream || (!bytes && n)) return -1;
+	if (stream->state == STREAM_DONE) return 1;
+	if (stream->state == STREAM_FAILED) return -1;
+
+	const uint8_t* in = bytes;
+	while (n > 0) {
+		size_t room = sizeof(stream->buf) - stream->used;
+		if (room == 0) {
+			lb_log("Stream structure exceeds %d bytes", LAZYBIOS_STREAM_MAX_STRUCTURE);
+			stream->state = STREAM_FAILED;
+			return -1;
+		}
+
+		size_t take = n < room ? n : room;
+		memcpy(stream->buf + stream->used, in, take);
+		stream->used += take;
+		in += take;
+		n -= take;
+
+		int rc = stream_drain(stream);
+		if (rc != 0) {
+			stream->state = rc > 0 ? STREAM_DONE : STREAM_FAILED;
+			return rc;
+		}
+	}
+	return 0;
+}
+
+void lazybiosStreamFree(lazybiosStream_t* stream) {
+	lazybiosFree(stream);
+}
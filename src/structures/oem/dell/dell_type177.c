@@ -26,48 +26,53 @@
 #include "lazybios/structures/oem/dell/dell_type177.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosOemDellType177FieldStatus_t, lazybiosOemDellType177FieldIndex_t, 1);
+
 #define ACPI_WMI_SUPPORTED 0x04
 
+const lazybiosFieldDesc lazybiosOemDellType177Fields[] = {
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeOemDellType177(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosOemDellType177_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+    // Read the 64-bit flags from offset 0x04
+    uint64_t flags = 0;
+    if (len >= 0x0C) {
+        memcpy(&flags, p + ACPI_WMI_SUPPORTED, sizeof(flags));
+    }
+
+    current->acpi_wmi_supported = (flags & (1ULL << 1)) ? "Yes" : "No";
+    if (flags & (1ULL << 1)) {
+        current->acpi_wmi_supported = "Yes";
+        LAZYBIOS_MARK_PRESENT(current, acpi_wmi_supported);
+    } else {
+        current->acpi_wmi_supported = "No";
+        LAZYBIOS_MARK_ABSENT(current, acpi_wmi_supported);
+    }
+
+	return 0;
+}
+
 lazybiosOemDellType177_t* lazybiosGetOemDellType177(lazybiosOemDellType177_t* DELLType177, size_t* delltype177_count, lazybiosDMI_t* DMIData) {
 	if (delltype177_count) *delltype177_count = 0;
 	if (!delltype177_count || !DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
 	const size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_OEM_DELL_TYPE177);
 	size_t index = 0;
 
-	DELLType177 = calloc(count, sizeof(*DELLType177));
+	DELLType177 = lazybiosCalloc(count, sizeof(*DELLType177));
 	if (!DELLType177) return NULL;
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_OEM_DELL_TYPE177) {
-			lazybiosOemDellType177_t* current = &DELLType177[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-		    (void)structure_end;
-
-		    // Read the 64-bit flags from offset 0x04
-		    uint64_t flags = 0;
-		    if (len >= 0x0C) {
-		        memcpy(&flags, p + ACPI_WMI_SUPPORTED, sizeof(flags));
-		    }
-
-		    current->acpi_wmi_supported = (flags & (1ULL << 1)) ? "Yes" : "No";
-		    if (flags & (1ULL << 1)) {
-		        current->acpi_wmi_supported = "Yes";
-		        LAZYBIOS_MARK_PRESENT(current, acpi_wmi_supported);
-		    } else {
-		        current->acpi_wmi_supported = "No";
-		        LAZYBIOS_MARK_ABSENT(current, acpi_wmi_supported);
-		    }
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_OEM_DELL_TYPE177);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeOemDellType177(&DELLType177[index], &cursor);
+		index++;
 	}
 	*delltype177_count = index;
 	return DELLType177;
@@ -77,5 +82,5 @@ void lazybiosFreeOemDellType177(lazybiosOemDellType177_t* DELLType177, size_t de
 	(void)delltype177_count;
     if (!DELLType177) return;
 
-	free(DELLType177);
+	lazybiosFree(DELLType177);
 }
@@ -28,6 +28,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosOemHpType204FieldStatus_t, lazybiosOemHpType204FieldIndex_t, 7);
+
 // Fields
 #define RACK_NAME 0x04
 #define ENCLOSURE_NAME 0x05
@@ -37,38 +39,42 @@
 #define SERVER_BAY 0x08
 #define BAYS_FILLED 0x09
 
+const lazybiosFieldDesc lazybiosOemHpType204Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosOemHpType204_t, rack_name, RACK_NAME, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosOemHpType204_t, enclosure_name, ENCLOSURE_NAME, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosOemHpType204_t, enclosure_model, ENCLOSURE_MODEL, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosOemHpType204_t, enclosure_bays, ENCLOSURE_BAYS, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosOemHpType204_t, enclosure_serial, ENCLOSURE_SERIAL, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosOemHpType204_t, server_bay, SERVER_BAY, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosOemHpType204_t, bays_filled, BAYS_FILLED, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeOemHpType204(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosOemHpType204_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosOemHpType204Fields, cursor);
+
+
+	return 0;
+}
+
 lazybiosOemHpType204_t* lazybiosGetOemHpType204(lazybiosOemHpType204_t* HPType204, size_t* hptype204_count, lazybiosDMI_t* DMIData) {
 	if (hptype204_count) *hptype204_count = 0;
 	if (!hptype204_count || !DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
 	const size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_OEM_HP_TYPE204);
 	size_t index = 0;
 
-	HPType204 = calloc(count, sizeof(*HPType204));
+	HPType204 = lazybiosCalloc(count, sizeof(*HPType204));
 	if (!HPType204) return NULL;
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_OEM_HP_TYPE204) {
-			lazybiosOemHpType204_t* current = &HPType204[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, rack_name, len, RACK_NAME, p, structure_end);
-		    READSTR(current, enclosure_name, len, ENCLOSURE_NAME, p, structure_end);
-		    READSTR(current, enclosure_model, len, ENCLOSURE_MODEL, p, structure_end);
-		    READU8(current, enclosure_bays, len, ENCLOSURE_BAYS, p);
-		    READSTR(current, enclosure_serial, len, ENCLOSURE_SERIAL, p, structure_end);
-		    READSTR(current, server_bay, len, SERVER_BAY, p, structure_end);
-		    READU8(current, bays_filled, len, BAYS_FILLED, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_OEM_HP_TYPE204);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeOemHpType204(&HPType204[index], &cursor);
+		index++;
 	}
 	*hptype204_count = index;
 	return HPType204;
@@ -78,5 +84,5 @@ void lazybiosFreeOemHpType204(lazybiosOemHpType204_t* HPType204, size_t hptype20
 	(void)hptype204_count;
     if (!HPType204) return;
 
-	free(HPType204);
+	lazybiosFree(HPType204);
 }
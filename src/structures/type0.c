@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType0FieldStatus_t, lazybiosType0FieldIndex_t, 13);
+
 #define VENDOR 0x04
 #define FIRMWARE_VERSION 0x05
 #define BIOS_STARTING_SEGMENT 0x06
@@ -39,103 +41,94 @@
 #define EMBEDDED_CONTROLLER_FIRMWARE_MINOR_RELEASE 0x17
 #define EXTENDED_FIRMWARE_ROM_SIZE 0x18
 
+const lazybiosFieldDesc lazybiosType0Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType0_t, vendor, VENDOR, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType0_t, version, FIRMWARE_VERSION, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType0_t, release_date, FIRMWARE_RELEASE_DATE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType0_t, bios_starting_segment, BIOS_STARTING_SEGMENT, 0, 0, 0),
+	LAZYBIOS_FIELD_U64(lazybiosType0_t, characteristics, FIRMWARE_CHARACTERISTICS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType0_t, platform_major_release, PLATFORM_FIRMWARE_MAJOR_RELEASE, 2, 4, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType0_t, platform_minor_release, PLATFORM_FIRMWARE_MINOR_RELEASE, 2, 4, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType0_t, ec_major_release, EMBEDDED_CONTROLLER_FIRMWARE_MAJOR_RELEASE, 2, 4, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType0_t, ec_minor_release, EMBEDDED_CONTROLLER_FIRMWARE_MINOR_RELEASE, 2, 4, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType0(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType0_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType0Fields, cursor);
+
+	if (current->bios_starting_segment == 0) LAZYBIOS_MARK_ABSENT(current, bios_starting_segment);
+
+	if (len > FIRMWARE_ROM_SIZE && p[FIRMWARE_ROM_SIZE] == 0xFF) {
+		if (lazybiosIsVersionPlus(DMIData, 3, 1) && len >= EXTENDED_FIRMWARE_ROM_SIZE + sizeof(uint16_t)) {
+			memcpy(&current->extended_rom_size, p + EXTENDED_FIRMWARE_ROM_SIZE, sizeof(uint16_t));
+			lazybiosType0ExtendedROMSizeU16(current->extended_rom_size, current->unit);
+			LAZYBIOS_MARK_PRESENT(current, extended_rom_size);
+			LAZYBIOS_MARK_PRESENT(current, unit);
+		} else {
+			current->extended_rom_size = 0;
+			LAZYBIOS_MARK_UNREACHABLE(current, extended_rom_size);
+			if (lazybiosIsVersionPlus(DMIData, 3, 1)) LAZYBIOS_MARK_ABSENT(current, extended_rom_size);
+		}
+
+		current->rom_size = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, rom_size);
+		LAZYBIOS_MARK_ABSENT(current, rom_size);
+	} else if (len > FIRMWARE_ROM_SIZE) {
+		current->rom_size = (uint32_t)(p[FIRMWARE_ROM_SIZE] + 1) * 64;
+		LAZYBIOS_MARK_PRESENT(current, rom_size);
+		current->extended_rom_size = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, extended_rom_size);
+	} else {
+		current->rom_size = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, rom_size);
+		current->extended_rom_size = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, extended_rom_size);
+		LAZYBIOS_MARK_ABSENT(current, rom_size);
+	}
+
+	if (len > FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES) {
+		current->firmware_char_ext_bytes.ptr = p + FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES;
+		current->firmware_char_ext_bytes.len =
+			(size_t)(len - FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES) > 2
+				? 2
+				: (size_t)(len - FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES);
+		LAZYBIOS_MARK_PRESENT(current, firmware_char_ext_bytes);
+	}
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 4)) {
+		if (current->platform_major_release == 0xFF && current->platform_minor_release == 0xFF) {
+			LAZYBIOS_MARK_ABSENT(current, platform_major_release);
+			LAZYBIOS_MARK_ABSENT(current, platform_minor_release);
+		}
+		if (current->ec_major_release == 0xFF) LAZYBIOS_MARK_ABSENT(current, ec_major_release);
+		if (current->ec_minor_release == 0xFF) LAZYBIOS_MARK_ABSENT(current, ec_minor_release);
+	}
+
+	return 0;
+}
+
 lazybiosType0_t* lazybiosGetType0(lazybiosType0_t* Type0, size_t* type0_count, lazybiosDMI_t* DMIData) {
 	if (type0_count) *type0_count = 0;
 	if (!type0_count || !DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
 	const size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_BIOS);
 	size_t index = 0;
 
-	Type0 = calloc(count, sizeof(*Type0));
+	Type0 = lazybiosCalloc(count, sizeof(*Type0));
 	if (!Type0) return NULL;
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_BIOS) {
-			lazybiosType0_t* current = &Type0[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, vendor, len, VENDOR, p, structure_end);
-			READSTR(current, version, len, FIRMWARE_VERSION, p, structure_end);
-			READSTR(current, release_date, len, FIRMWARE_RELEASE_DATE, p, structure_end);
-
-			READU16(current, bios_starting_segment, len, BIOS_STARTING_SEGMENT, p);
-			if (current->bios_starting_segment == 0) LAZYBIOS_MARK_ABSENT(current, bios_starting_segment);
-
-			if (len > FIRMWARE_ROM_SIZE && p[FIRMWARE_ROM_SIZE] == 0xFF) {
-				if (lazybiosIsVersionPlus(DMIData, 3, 1) && len >= EXTENDED_FIRMWARE_ROM_SIZE + sizeof(uint16_t)) {
-					memcpy(&current->extended_rom_size, p + EXTENDED_FIRMWARE_ROM_SIZE, sizeof(uint16_t));
-					lazybiosType0ExtendedROMSizeU16(current->extended_rom_size, current->unit);
-					LAZYBIOS_MARK_PRESENT(current, extended_rom_size);
-					LAZYBIOS_MARK_PRESENT(current, unit);
-				} else {
-					current->extended_rom_size = 0;
-					LAZYBIOS_MARK_UNREACHABLE(current, extended_rom_size);
-					if (lazybiosIsVersionPlus(DMIData, 3, 1)) LAZYBIOS_MARK_ABSENT(current, extended_rom_size);
-				}
-
-				current->rom_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, rom_size);
-				current->field_status.rom_size = LAZYBIOS_FIELD_ABSENT;
-			} else if (len > FIRMWARE_ROM_SIZE) {
-				current->rom_size = (uint32_t)(p[FIRMWARE_ROM_SIZE] + 1) * 64;
-				LAZYBIOS_MARK_PRESENT(current, rom_size);
-				current->extended_rom_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_rom_size);
-			} else {
-				current->rom_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, rom_size);
-				current->extended_rom_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_rom_size);
-				LAZYBIOS_MARK_ABSENT(current, rom_size);
-			}
-
-			READU64(current, characteristics, len, FIRMWARE_CHARACTERISTICS, p);
-
-			if (len > FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES) {
-				current->firmware_char_ext_bytes_count =
-					(size_t)(len - FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES) > 2
-						? 2
-						: (size_t)(len - FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES);
-				LAZYBIOS_MARK_PRESENT(current, firmware_char_ext_bytes_count);
-				current->firmware_char_ext_bytes = malloc(current->firmware_char_ext_bytes_count);
-				if (current->firmware_char_ext_bytes) {
-					memcpy(current->firmware_char_ext_bytes, p + FIRMWARE_CHARACTERISTICS_EXTENSION_BYTES,
-						current->firmware_char_ext_bytes_count);
-					LAZYBIOS_MARK_PRESENT(current, firmware_char_ext_bytes);
-				}
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 4)) {
-				READU8(current, platform_major_release, len, PLATFORM_FIRMWARE_MAJOR_RELEASE, p);
-				READU8(current, platform_minor_release, len, PLATFORM_FIRMWARE_MINOR_RELEASE, p);
-				READU8(current, ec_major_release, len, EMBEDDED_CONTROLLER_FIRMWARE_MAJOR_RELEASE, p);
-				READU8(current, ec_minor_release, len, EMBEDDED_CONTROLLER_FIRMWARE_MINOR_RELEASE, p);
-				if (current->platform_major_release == 0xFF && current->platform_minor_release == 0xFF) {
-					LAZYBIOS_MARK_ABSENT(current, platform_major_release);
-					LAZYBIOS_MARK_ABSENT(current, platform_minor_release);
-				}
-				if (current->ec_major_release == 0xFF) LAZYBIOS_MARK_ABSENT(current, ec_major_release);
-				if (current->ec_minor_release == 0xFF) LAZYBIOS_MARK_ABSENT(current, ec_minor_release);
-			} else {
-				current->platform_major_release = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, platform_major_release);
-				current->platform_minor_release = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, platform_minor_release);
-				current->ec_major_release = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, ec_major_release);
-				current->ec_minor_release = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, ec_minor_release);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_BIOS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType0(&Type0[index], &cursor);
+		index++;
 	}
 	*type0_count = index;
 	return Type0;
@@ -253,9 +246,8 @@ uint16_t lazybiosType0ExtendedROMSizeU16(uint16_t raw, char unit[5]) {
 
 
 void lazybiosFreeType0(lazybiosType0_t* Type0, size_t type0_count) {
+    (void)type0_count;
     if (!Type0) return;
 
-	for (size_t i = 0; i < type0_count; i++) free(Type0[i].firmware_char_ext_bytes);
-
-    free(Type0);
+    lazybiosFree(Type0);
 }
@@ -25,6 +25,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType1FieldStatus_t, lazybiosType1FieldIndex_t, 8);
+
 // Fields
 #define MANUFACTURER 0x04
 #define PRODUCT_NAME 0x05
@@ -47,71 +49,67 @@
 #define WAKEUP_TYPE_PCI_PME 0x07
 #define WAKEUP_TYPE_AC_POWER_RESTORED 0x08
 
+const lazybiosFieldDesc lazybiosType1Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType1_t, manufacturer, MANUFACTURER, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType1_t, product_name, PRODUCT_NAME, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType1_t, version, VERSION, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType1_t, serial_number, SERIAL_NUMBER, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType1_t, wake_up_type, WAKE_UP_TYPE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType1_t, sku_number, SKU_NUMBER, 2, 4, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType1_t, family, FAMILY, 2, 4, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType1(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType1_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType1Fields, cursor);
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
+		if (len >= UUID + sizeof(current->uuid)) {
+			const uint8_t* uuid = p + UUID;
+			int all_zero = 1;
+			int all_ff = 1;
+			for (int i = 0; i < 16; i++) current->uuid[i] = uuid[i];
+			for (int i = 0; i < 16; i++) {
+				if (uuid[i] != 0x00) all_zero = 0;
+				if (uuid[i] != 0xFF) all_ff = 0;
+			}
+			if (all_zero || all_ff) {
+				LAZYBIOS_MARK_ABSENT(current, uuid);
+			} else {
+				LAZYBIOS_MARK_PRESENT(current, uuid);
+			}
+		} else {
+			for (int i = 0; i < 16; i++) current->uuid[i] = 0;
+			LAZYBIOS_MARK_ABSENT(current, uuid);
+		}
+	} else {
+		for (int i = 0; i < 16; i++) current->uuid[i] = 0;
+	}
+
+	return 0;
+}
+
 lazybiosType1_t* lazybiosGetType1(lazybiosType1_t* Type1, size_t* type1_count, lazybiosDMI_t* DMIData) {
 	if (type1_count) *type1_count = 0;
 	if (!type1_count || !DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
 	const size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM);
 	size_t index = 0;
 
-	Type1 = calloc(count, sizeof(*Type1));
+	Type1 = lazybiosCalloc(count, sizeof(*Type1));
 	if (!Type1) return NULL;
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM) {
-			lazybiosType1_t* current = &Type1[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-			READSTR(current, product_name, len, PRODUCT_NAME, p, structure_end);
-			READSTR(current, version, len, VERSION, p, structure_end);
-			READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				if (len >= UUID + sizeof(current->uuid)) {
-					const uint8_t* uuid = p + UUID;
-					int all_zero = 1;
-					int all_ff = 1;
-					for (int i = 0; i < 16; i++) current->uuid[i] = uuid[i];
-					for (int i = 0; i < 16; i++) {
-						if (uuid[i] != 0x00) all_zero = 0;
-						if (uuid[i] != 0xFF) all_ff = 0;
-					}
-					if (all_zero || all_ff) {
-						LAZYBIOS_MARK_ABSENT(current, uuid);
-					} else {
-						LAZYBIOS_MARK_PRESENT(current, uuid);
-					}
-				} else {
-					for (int i = 0; i < 16; i++) current->uuid[i] = 0;
-					LAZYBIOS_MARK_ABSENT(current, uuid);
-				}
-				READU8(current, wake_up_type, len, WAKE_UP_TYPE, p);
-			} else {
-				for (int i = 0; i < 16; i++) current->uuid[i] = 0;
-				current->wake_up_type = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, wake_up_type);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 4)) {
-				READSTR(current, sku_number, len, SKU_NUMBER, p, structure_end);
-				READSTR(current, family, len, FAMILY, p, structure_end);
-			} else {
-				current->sku_number = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, sku_number);
-				current->family = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, family);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType1(&Type1[index], &cursor);
+		index++;
 	}
 	*type1_count = index;
 	return Type1;
@@ -148,5 +146,5 @@ void lazybiosFreeType1(lazybiosType1_t* Type1, size_t type1_count) {
     (void)type1_count;
     if (!Type1) return;
 
-    free(Type1);
+    lazybiosFree(Type1);
 }
@@ -24,6 +24,9 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType10DeviceFieldStatus_t, lazybiosType10DeviceFieldIndex_t, 2);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType10FieldStatus_t, lazybiosType10FieldIndex_t, 2);
+
 #define DEVICES 0x04
 #define DEVICE_ENTRY_SIZE 2
 #define DEVICE_STATUS_MASK 0x80
@@ -41,57 +44,65 @@
 #define DEVICE_TYPE_SATA_CONTROLLER 0x09
 #define DEVICE_TYPE_SAS_CONTROLLER 0x0A
 
+const lazybiosFieldDesc lazybiosType10Fields[] = {
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType10(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType10_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	if (len >= DEVICES && (len - DEVICES) % DEVICE_ENTRY_SIZE == 0) {
+		current->device_count = (len - DEVICES) / DEVICE_ENTRY_SIZE;
+		LAZYBIOS_MARK_PRESENT(current, device_count);
+		if (current->device_count > 0) {
+			current->devices = lazybiosStructCursorAlloc(cursor, current->device_count, sizeof(lazybiosType10Device_t));
+			if (!current->devices) {
+				return -1;
+			}
+			for (size_t i = 0; i < current->device_count; i++) {
+				size_t device_offset = DEVICES + (i * DEVICE_ENTRY_SIZE);
+				current->devices[i].device_type_and_status = p[device_offset];
+				LAZYBIOS_MARK_PRESENT(&current->devices[i], device_type_and_status);
+				uint8_t string_number = p[device_offset + 1];
+				current->devices[i].description = lazybiosStructCursorString(cursor, string_number);
+				if (string_number == 0 || current->devices[i].description) {
+					LAZYBIOS_MARK_PRESENT(&current->devices[i], description);
+				} else {
+					LAZYBIOS_MARK_ABSENT(&current->devices[i], description);
+				}
+			}
+		}
+		LAZYBIOS_MARK_PRESENT(current, devices);
+	} else {
+		LAZYBIOS_MARK_ABSENT(current, device_count);
+		LAZYBIOS_MARK_ABSENT(current, devices);
+	}
+
+	return 0;
+}
+
 lazybiosType10_t* lazybiosGetType10(lazybiosType10_t* Type10, size_t* type10_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_ONBOARD_DEVICES);
 	size_t index = 0;
-	Type10 = calloc(count, sizeof(lazybiosType10_t));
+	Type10 = lazybiosCalloc(count, sizeof(lazybiosType10_t));
 	if (!Type10) return NULL;
 	if (count == 0) {
 		*type10_count = 0;
 		return Type10;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-		if (type == SMBIOS_TYPE_ONBOARD_DEVICES) {
-			lazybiosType10_t* current = &Type10[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			if (len >= DEVICES && (len - DEVICES) % DEVICE_ENTRY_SIZE == 0) {
-				current->device_count = (len - DEVICES) / DEVICE_ENTRY_SIZE;
-				LAZYBIOS_MARK_PRESENT(current, device_count);
-				if (current->device_count > 0) {
-					current->devices = calloc(current->device_count, sizeof(lazybiosType10Device_t));
-					if (!current->devices) {
-						lazybiosFreeType10(Type10, index + 1);
-						return NULL;
-					}
-					for (size_t i = 0; i < current->device_count; i++) {
-						size_t device_offset = DEVICES + (i * DEVICE_ENTRY_SIZE);
-						current->devices[i].device_type_and_status = p[device_offset];
-						LAZYBIOS_MARK_PRESENT(&current->devices[i], device_type_and_status);
-						uint8_t string_number = p[device_offset + 1];
-						current->devices[i].description = DMIString(p, len, string_number, structure_end);
-						if (string_number == 0 || current->devices[i].description) {
-							LAZYBIOS_MARK_PRESENT(&current->devices[i], description);
-						} else {
-							LAZYBIOS_MARK_ABSENT(&current->devices[i], description);
-						}
-					}
-				}
-				LAZYBIOS_MARK_PRESENT(current, devices);
-			} else {
-				LAZYBIOS_MARK_ABSENT(current, device_count);
-				LAZYBIOS_MARK_ABSENT(current, devices);
-			}
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_ONBOARD_DEVICES);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType10(&Type10[index], &cursor) != 0) {
+			lazybiosFreeType10(Type10, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type10_count = index;
 	return Type10;
@@ -120,7 +131,7 @@ const char* lazybiosType10DeviceStatusStr(uint8_t device_type_and_status) {
 void lazybiosFreeType10(lazybiosType10_t* Type10, size_t type10_count) {
 	if (!Type10) return;
 	for (size_t i = 0; i < type10_count; i++) {
-		free(Type10[i].devices);
+		lazybiosFree(Type10[i].devices);
 	}
-	free(Type10);
+	lazybiosFree(Type10);
 }
@@ -24,59 +24,64 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType11FieldStatus_t, lazybiosType11FieldIndex_t, 2);
+
 // Fields
 #define COUNT 0x04
 
+const lazybiosFieldDesc lazybiosType11Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType11_t, string_count, COUNT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType11(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType11_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType11Fields, cursor);
+
+	if (LAZYBIOS_FIELD_STATUS(current, string_count) == LAZYBIOS_FIELD_PRESENT && current->string_count > 0) {
+		current->strings = lazybiosStructCursorAlloc(cursor, current->string_count, sizeof(*current->strings));
+		if (current->strings) {
+			LAZYBIOS_MARK_PRESENT(current, strings);
+			for (size_t i = 0; i < current->string_count; i++) {
+				current->strings[i] = lazybiosStructCursorString(cursor, (uint8_t)(i + 1));
+				if (!current->strings[i] || current->strings[i][0] == '\0') {
+					current->strings[i] = NULL;
+					LAZYBIOS_MARK_ABSENT(current, strings);
+				}
+			}
+		} else {
+			return -1;
+		}
+	} else if (LAZYBIOS_FIELD_STATUS(current, string_count) == LAZYBIOS_FIELD_PRESENT) {
+		LAZYBIOS_MARK_PRESENT(current, strings);
+	}
+
+	return 0;
+}
+
 lazybiosType11_t* lazybiosGetType11(lazybiosType11_t* Type11, size_t* type11_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_OEM_STRINGS);
 	size_t index = 0;
 
-	Type11 = calloc(count, sizeof(lazybiosType11_t));
+	Type11 = lazybiosCalloc(count, sizeof(lazybiosType11_t));
 	if (!Type11) return NULL;
 	if (count == 0) {
 		*type11_count = 0;
 		return Type11;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_OEM_STRINGS) {
-			if (index >= count) break;
-			lazybiosType11_t* current = &Type11[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READU8(current, string_count, len, COUNT, p);
-
-			if (LAZYBIOS_FIELD_STATUS(current, string_count) == LAZYBIOS_FIELD_PRESENT && current->string_count > 0) {
-				current->strings = calloc(current->string_count, sizeof(*current->strings));
-				if (current->strings) {
-					LAZYBIOS_MARK_PRESENT(current, strings);
-					for (size_t i = 0; i < current->string_count; i++) {
-						current->strings[i] = DMIString(p, len, (uint8_t)(i + 1), structure_end);
-						if (!current->strings[i] || current->strings[i][0] == '\0') {
-							current->strings[i] = NULL;
-							LAZYBIOS_MARK_ABSENT(current, strings);
-						}
-					}
-				} else {
-					lazybiosFreeType11(Type11, index + 1);
-					return NULL;
-				}
-			} else if (LAZYBIOS_FIELD_STATUS(current, string_count) == LAZYBIOS_FIELD_PRESENT) {
-				LAZYBIOS_MARK_PRESENT(current, strings);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_OEM_STRINGS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType11(&Type11[index], &cursor) != 0) {
+			lazybiosFreeType11(Type11, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type11_count = index;
 	return Type11;
@@ -86,8 +91,8 @@ void lazybiosFreeType11(lazybiosType11_t* Type11, size_t type11_count) {
     if (!Type11) return;
 
     for (size_t i = 0; i < type11_count; i++) {
-        free(Type11[i].strings);
+        lazybiosFree(Type11[i].strings);
     }
 
-    free(Type11);
+    lazybiosFree(Type11);
 }
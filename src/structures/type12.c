@@ -24,59 +24,64 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType12FieldStatus_t, lazybiosType12FieldIndex_t, 2);
+
 // Fields
 #define COUNT 0x04
 
+const lazybiosFieldDesc lazybiosType12Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType12_t, option_count, COUNT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType12(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType12_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType12Fields, cursor);
+
+	if (LAZYBIOS_FIELD_STATUS(current, option_count) == LAZYBIOS_FIELD_PRESENT && current->option_count > 0) {
+		current->options = lazybiosStructCursorAlloc(cursor, current->option_count, sizeof(*current->options));
+		if (current->options) {
+			LAZYBIOS_MARK_PRESENT(current, options);
+			for (size_t i = 0; i < current->option_count; i++) {
+				current->options[i] = lazybiosStructCursorString(cursor, (uint8_t)(i + 1));
+				if (!current->options[i] || current->options[i][0] == '\0') {
+					current->options[i] = NULL;
+					LAZYBIOS_MARK_ABSENT(current, options);
+				}
+			}
+		} else {
+			return -1;
+		}
+	} else if (LAZYBIOS_FIELD_STATUS(current, option_count) == LAZYBIOS_FIELD_PRESENT) {
+		LAZYBIOS_MARK_PRESENT(current, options);
+	}
+
+	return 0;
+}
+
 lazybiosType12_t* lazybiosGetType12(lazybiosType12_t* Type12, size_t* type12_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_CONFIGURATION_OPTIONS);
 	size_t index = 0;
 
-	Type12 = calloc(count, sizeof(lazybiosType12_t));
+	Type12 = lazybiosCalloc(count, sizeof(lazybiosType12_t));
 	if (!Type12) return NULL;
 	if (count == 0) {
 		*type12_count = 0;
 		return Type12;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_CONFIGURATION_OPTIONS) {
-			if (index >= count) break;
-			lazybiosType12_t* current = &Type12[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READU8(current, option_count, len, COUNT, p);
-
-			if (LAZYBIOS_FIELD_STATUS(current, option_count) == LAZYBIOS_FIELD_PRESENT && current->option_count > 0) {
-				current->options = calloc(current->option_count, sizeof(*current->options));
-				if (current->options) {
-					LAZYBIOS_MARK_PRESENT(current, options);
-					for (size_t i = 0; i < current->option_count; i++) {
-						current->options[i] = DMIString(p, len, (uint8_t)(i + 1), structure_end);
-						if (!current->options[i] || current->options[i][0] == '\0') {
-							current->options[i] = NULL;
-							LAZYBIOS_MARK_ABSENT(current, options);
-						}
-					}
-				} else {
-					lazybiosFreeType12(Type12, index + 1);
-					return NULL;
-				}
-			} else if (LAZYBIOS_FIELD_STATUS(current, option_count) == LAZYBIOS_FIELD_PRESENT) {
-				LAZYBIOS_MARK_PRESENT(current, options);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_CONFIGURATION_OPTIONS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType12(&Type12[index], &cursor) != 0) {
+			lazybiosFreeType12(Type12, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type12_count = index;
 	return Type12;
@@ -85,7 +90,7 @@ lazybiosType12_t* lazybiosGetType12(lazybiosType12_t* Type12, size_t* type12_cou
 void lazybiosFreeType12(lazybiosType12_t* Type12, size_t type12_count) {
     if (!Type12) return;
 
-    for (size_t i = 0; i < type12_count; i++) free(Type12[i].options);
+    for (size_t i = 0; i < type12_count; i++) lazybiosFree(Type12[i].options);
 
-    free(Type12);
+    lazybiosFree(Type12);
 }
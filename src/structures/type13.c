@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType13FieldStatus_t, lazybiosType13FieldIndex_t, 4);
+
 // Fields
 #define INSTALLABLE_LANGUAGES 0x04
 #define FLAGS 0x05
@@ -32,71 +34,70 @@
 // Flag Masks
 #define LANGUAGE_FORMAT_MASK 0x01
 
+const lazybiosFieldDesc lazybiosType13Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType13_t, installable_languages, INSTALLABLE_LANGUAGES, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType13_t, flags, FLAGS, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType13_t, current_language, CURRENT_LANGUAGE, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType13(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType13_t* current = record;
+	const uint8_t* p = cursor->p;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType13Fields, cursor);
+	if (LAZYBIOS_FIELD_STATUS(current, current_language) == LAZYBIOS_FIELD_PRESENT &&
+		LAZYBIOS_FIELD_STATUS(current, installable_languages) == LAZYBIOS_FIELD_PRESENT &&
+		p[CURRENT_LANGUAGE] > current->installable_languages) {
+		current->current_language = NULL;
+		LAZYBIOS_MARK_UNREACHABLE(current, current_language);
+		LAZYBIOS_MARK_ABSENT(current, current_language);
+	}
+
+	if (LAZYBIOS_FIELD_STATUS(current, installable_languages) == LAZYBIOS_FIELD_PRESENT &&
+		current->installable_languages > 0) {
+		current->languages = lazybiosStructCursorAlloc(cursor, current->installable_languages, sizeof(*current->languages));
+		if (current->languages) {
+			LAZYBIOS_MARK_PRESENT(current, languages);
+			for (size_t i = 0; i < current->installable_languages; i++) {
+				current->languages[i] = lazybiosStructCursorString(cursor, (uint8_t)(i + 1));
+				if (!current->languages[i] || current->languages[i][0] == '\0') {
+					current->languages[i] = NULL;
+					LAZYBIOS_MARK_ABSENT(current, languages);
+				}
+			}
+		} else {
+			return -1;
+		}
+	} else if (LAZYBIOS_FIELD_STATUS(current, installable_languages) == LAZYBIOS_FIELD_PRESENT) {
+		LAZYBIOS_MARK_PRESENT(current, languages);
+	}
+
+	return 0;
+}
+
 lazybiosType13_t* lazybiosGetType13(lazybiosType13_t* Type13, size_t* type13_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_FIRMWARE_LANGUAGE_INFORMATION);
 	size_t index = 0;
 
-	Type13 = calloc(count, sizeof(lazybiosType13_t));
+	Type13 = lazybiosCalloc(count, sizeof(lazybiosType13_t));
 	if (!Type13) return NULL;
 	if (count == 0) {
 		*type13_count = 0;
 		return Type13;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_FIRMWARE_LANGUAGE_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType13_t* current = &Type13[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READU8(current, installable_languages, len, INSTALLABLE_LANGUAGES, p);
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU8(current, flags, len, FLAGS, p);
-			} else {
-				current->flags = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, flags);
-			}
-			READSTR(current, current_language, len, CURRENT_LANGUAGE, p, structure_end);
-			if (LAZYBIOS_FIELD_STATUS(current, current_language) == LAZYBIOS_FIELD_PRESENT &&
-				LAZYBIOS_FIELD_STATUS(current, installable_languages) == LAZYBIOS_FIELD_PRESENT &&
-				p[CURRENT_LANGUAGE] > current->installable_languages) {
-				current->current_language = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, current_language);
-				LAZYBIOS_MARK_ABSENT(current, current_language);
-			}
-
-			if (LAZYBIOS_FIELD_STATUS(current, installable_languages) == LAZYBIOS_FIELD_PRESENT &&
-				current->installable_languages > 0) {
-				current->languages = calloc(current->installable_languages, sizeof(*current->languages));
-				if (current->languages) {
-					LAZYBIOS_MARK_PRESENT(current, languages);
-					for (size_t i = 0; i < current->installable_languages; i++) {
-						current->languages[i] = DMIString(p, len, (uint8_t)(i + 1), structure_end);
-						if (!current->languages[i] || current->languages[i][0] == '\0') {
-							current->languages[i] = NULL;
-							LAZYBIOS_MARK_ABSENT(current, languages);
-						}
-					}
-				} else {
-					lazybiosFreeType13(Type13, index + 1);
-					return NULL;
-				}
-			} else if (LAZYBIOS_FIELD_STATUS(current, installable_languages) == LAZYBIOS_FIELD_PRESENT) {
-				LAZYBIOS_MARK_PRESENT(current, languages);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_FIRMWARE_LANGUAGE_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType13(&Type13[index], &cursor) != 0) {
+			lazybiosFreeType13(Type13, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type13_count = index;
 	return Type13;
@@ -109,7 +110,7 @@ const char* lazybiosType13LanguageFormatStr(uint8_t flags) {
 void lazybiosFreeType13(lazybiosType13_t* Type13, size_t type13_count) {
     if (!Type13) return;
 
-    for (size_t i = 0; i < type13_count; i++) free(Type13[i].languages);
+    for (size_t i = 0; i < type13_count; i++) lazybiosFree(Type13[i].languages);
     
-    free(Type13);
+    lazybiosFree(Type13);
 }
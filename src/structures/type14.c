@@ -25,74 +25,82 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType14ItemFieldStatus_t, lazybiosType14ItemFieldIndex_t, 2);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType14FieldStatus_t, lazybiosType14FieldIndex_t, 3);
+
 // Fields
 #define GROUP_NAME 0x04
 #define ITEMS 0x05
 #define ITEM_SIZE 3
 
+const lazybiosFieldDesc lazybiosType14Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType14_t, group_name, GROUP_NAME, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType14(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType14_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType14Fields, cursor);
+
+	if (len >= ITEMS && (len - ITEMS) % ITEM_SIZE == 0) {
+		current->item_count = (len - ITEMS) / ITEM_SIZE;
+		LAZYBIOS_MARK_PRESENT(current, item_count);
+
+		if (current->item_count > 0) {
+			current->items = lazybiosStructCursorAlloc(cursor, current->item_count, sizeof(lazybiosType14Item_t));
+			if (!current->items) {
+				return -1;
+			}
+
+			for (size_t i = 0; i < current->item_count; i++) {
+				const size_t item_offset = ITEMS + (i * ITEM_SIZE);
+				current->items[i].item_type = p[item_offset];
+				memcpy(&current->items[i].item_handle, p + item_offset + 1, sizeof(uint16_t));
+				LAZYBIOS_MARK_PRESENT(&current->items[i], item_type);
+				LAZYBIOS_MARK_PRESENT(&current->items[i], item_handle);
+				if (current->items[i].item_handle == 0xFFFF) {
+					LAZYBIOS_MARK_ABSENT(&current->items[i], item_handle);
+				}
+			}
+		}
+		LAZYBIOS_MARK_PRESENT(current, items);
+	} else {
+		current->item_count = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, item_count);
+		current->items = NULL;
+		LAZYBIOS_MARK_UNREACHABLE(current, items);
+		LAZYBIOS_MARK_ABSENT(current, item_count);
+		LAZYBIOS_MARK_ABSENT(current, items);
+	}
+
+	return 0;
+}
+
 lazybiosType14_t* lazybiosGetType14(lazybiosType14_t* Type14, size_t* type14_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_GROUP_ASSOCIATIONS);
 	size_t index = 0;
 
-	Type14 = calloc(count, sizeof(lazybiosType14_t));
+	Type14 = lazybiosCalloc(count, sizeof(lazybiosType14_t));
 	if (!Type14) return NULL;
 	if (count == 0) {
 		*type14_count = 0;
 		return Type14;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_GROUP_ASSOCIATIONS) {
-			if (index >= count) break;
-			lazybiosType14_t* current = &Type14[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, group_name, len, GROUP_NAME, p, structure_end);
-
-			if (len >= ITEMS && (len - ITEMS) % ITEM_SIZE == 0) {
-				current->item_count = (len - ITEMS) / ITEM_SIZE;
-				LAZYBIOS_MARK_PRESENT(current, item_count);
-
-				if (current->item_count > 0) {
-					current->items = calloc(current->item_count, sizeof(lazybiosType14Item_t));
-					if (!current->items) {
-						lazybiosFreeType14(Type14, index + 1);
-						return NULL;
-					}
-
-					for (size_t i = 0; i < current->item_count; i++) {
-						const size_t item_offset = ITEMS + (i * ITEM_SIZE);
-						current->items[i].item_type = p[item_offset];
-						memcpy(&current->items[i].item_handle, p + item_offset + 1, sizeof(uint16_t));
-						LAZYBIOS_MARK_PRESENT(&current->items[i], item_type);
-						LAZYBIOS_MARK_PRESENT(&current->items[i], item_handle);
-						if (current->items[i].item_handle == 0xFFFF) {
-							LAZYBIOS_MARK_ABSENT(&current->items[i], item_handle);
-						}
-					}
-				}
-				LAZYBIOS_MARK_PRESENT(current, items);
-			} else {
-				current->item_count = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, item_count);
-				current->items = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, items);
-				LAZYBIOS_MARK_ABSENT(current, item_count);
-				LAZYBIOS_MARK_ABSENT(current, items);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_GROUP_ASSOCIATIONS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType14(&Type14[index], &cursor) != 0) {
+			lazybiosFreeType14(Type14, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type14_count = index;
 	return Type14;
@@ -101,7 +109,7 @@ lazybiosType14_t* lazybiosGetType14(lazybiosType14_t* Type14, size_t* type14_cou
 void lazybiosFreeType14(lazybiosType14_t* Type14, size_t type14_count) {
     if (!Type14) return;
 
-    for (size_t i = 0; i < type14_count; i++) free(Type14[i].items);
+    for (size_t i = 0; i < type14_count; i++) lazybiosFree(Type14[i].items);
 
-    free(Type14);
+    lazybiosFree(Type14);
 }
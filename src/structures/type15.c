@@ -25,6 +25,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType15LogTypeDescriptorFieldStatus_t, lazybiosType15LogTypeDescriptorFieldIndex_t, 2);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType15FieldStatus_t, lazybiosType15FieldIndex_t, 11);
+
 // Fields
 #define LOG_AREA_LENGTH 0x04
 #define LOG_HEADER_START_OFFSET 0x06
@@ -94,96 +97,94 @@
 #define VARIABLE_DATA_FORMAT_SYSTEM_MANAGEMENT_TYPE 0x05
 #define VARIABLE_DATA_FORMAT_MULTIPLE_EVENT_SYSTEM_MANAGEMENT_TYPE 0x06
 
+const lazybiosFieldDesc lazybiosType15Fields[] = {
+	LAZYBIOS_FIELD_U16(lazybiosType15_t, log_area_length, LOG_AREA_LENGTH, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType15_t, log_header_start_offset, LOG_HEADER_START_OFFSET, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType15_t, log_data_start_offset, LOG_DATA_START_OFFSET, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType15_t, access_method, ACCESS_METHOD, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType15_t, log_status, LOG_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType15_t, log_change_token, LOG_CHANGE_TOKEN, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType15_t, access_method_address, ACCESS_METHOD_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType15_t, log_header_format, LOG_HEADER_FORMAT, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType15_t, number_of_supported_log_type_descriptors, NUMBER_OF_SUPPORTED_LOG_TYPE_DESCRIPTORS, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType15_t, length_of_each_log_type_descriptor, LENGTH_OF_EACH_LOG_TYPE_DESCRIPTOR, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType15(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType15_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType15Fields, cursor);
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
+		if (LAZYBIOS_FIELD_STATUS(current, number_of_supported_log_type_descriptors) == LAZYBIOS_FIELD_PRESENT &&
+			LAZYBIOS_FIELD_STATUS(current, length_of_each_log_type_descriptor) == LAZYBIOS_FIELD_PRESENT) {
+			const size_t descriptor_bytes = (size_t)current->number_of_supported_log_type_descriptors *
+				current->length_of_each_log_type_descriptor;
+			const int descriptor_layout_valid = current->length_of_each_log_type_descriptor >= MINIMUM_DESCRIPTOR_LENGTH &&
+				(size_t)len >= SUPPORTED_LOG_TYPE_DESCRIPTORS + descriptor_bytes;
+
+			if (current->number_of_supported_log_type_descriptors == 0) {
+				LAZYBIOS_MARK_PRESENT(current, supported_log_type_descriptors);
+			} else if (descriptor_layout_valid) {
+				current->supported_log_type_descriptors = lazybiosStructCursorAlloc(cursor,
+					current->number_of_supported_log_type_descriptors,
+					sizeof(lazybiosType15LogTypeDescriptor_t));
+				if (!current->supported_log_type_descriptors) {
+					return -1;
+				}
+
+				for (size_t i = 0; i < current->number_of_supported_log_type_descriptors; i++) {
+					const size_t descriptor_offset = SUPPORTED_LOG_TYPE_DESCRIPTORS +
+						(i * current->length_of_each_log_type_descriptor);
+					lazybiosType15LogTypeDescriptor_t* descriptor =
+						&current->supported_log_type_descriptors[i];
+					descriptor->log_type = p[descriptor_offset + DESCRIPTOR_LOG_TYPE];
+					descriptor->variable_data_format_type =
+						p[descriptor_offset + DESCRIPTOR_VARIABLE_DATA_FORMAT_TYPE];
+					LAZYBIOS_MARK_PRESENT(descriptor, log_type);
+					LAZYBIOS_MARK_PRESENT(descriptor, variable_data_format_type);
+				}
+				LAZYBIOS_MARK_PRESENT(current, supported_log_type_descriptors);
+			} else {
+				current->supported_log_type_descriptors = NULL;
+				LAZYBIOS_MARK_UNREACHABLE(current, supported_log_type_descriptors);
+				LAZYBIOS_MARK_ABSENT(current, supported_log_type_descriptors);
+			}
+		}
+	} else {
+		current->supported_log_type_descriptors = NULL;
+		LAZYBIOS_MARK_UNREACHABLE(current, supported_log_type_descriptors);
+	}
+
+	return 0;
+}
+
 lazybiosType15_t* lazybiosGetType15(lazybiosType15_t* Type15, size_t* type15_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_EVENT_LOG);
 	size_t index = 0;
 
-	Type15 = calloc(count, sizeof(lazybiosType15_t));
+	Type15 = lazybiosCalloc(count, sizeof(lazybiosType15_t));
 	if (!Type15) return NULL;
 	if (count == 0) {
 		*type15_count = 0;
 		return Type15;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_EVENT_LOG) {
-			if (index >= count) break;
-			lazybiosType15_t* current = &Type15[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU16(current, log_area_length, len, LOG_AREA_LENGTH, p);
-			READU16(current, log_header_start_offset, len, LOG_HEADER_START_OFFSET, p);
-			READU16(current, log_data_start_offset, len, LOG_DATA_START_OFFSET, p);
-			READU8(current, access_method, len, ACCESS_METHOD, p);
-			READU8(current, log_status, len, LOG_STATUS, p);
-			READU32(current, log_change_token, len, LOG_CHANGE_TOKEN, p);
-			READU32(current, access_method_address, len, ACCESS_METHOD_ADDRESS, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU8(current, log_header_format, len, LOG_HEADER_FORMAT, p);
-				READU8(current, number_of_supported_log_type_descriptors, len,
-					NUMBER_OF_SUPPORTED_LOG_TYPE_DESCRIPTORS, p);
-				READU8(current, length_of_each_log_type_descriptor, len,
-					LENGTH_OF_EACH_LOG_TYPE_DESCRIPTOR, p);
-
-				if (LAZYBIOS_FIELD_STATUS(current, number_of_supported_log_type_descriptors) == LAZYBIOS_FIELD_PRESENT &&
-					LAZYBIOS_FIELD_STATUS(current, length_of_each_log_type_descriptor) == LAZYBIOS_FIELD_PRESENT) {
-					const size_t descriptor_bytes = (size_t)current->number_of_supported_log_type_descriptors *
-						current->length_of_each_log_type_descriptor;
-					const int descriptor_layout_valid = current->length_of_each_log_type_descriptor >= MINIMUM_DESCRIPTOR_LENGTH &&
-						(size_t)len >= SUPPORTED_LOG_TYPE_DESCRIPTORS + descriptor_bytes;
-
-					if (current->number_of_supported_log_type_descriptors == 0) {
-						LAZYBIOS_MARK_PRESENT(current, supported_log_type_descriptors);
-					} else if (descriptor_layout_valid) {
-						current->supported_log_type_descriptors = calloc(
-							current->number_of_supported_log_type_descriptors,
-							sizeof(lazybiosType15LogTypeDescriptor_t));
-						if (!current->supported_log_type_descriptors) {
-							lazybiosFreeType15(Type15, index + 1);
-							return NULL;
-						}
-
-						for (size_t i = 0; i < current->number_of_supported_log_type_descriptors; i++) {
-							const size_t descriptor_offset = SUPPORTED_LOG_TYPE_DESCRIPTORS +
-								(i * current->length_of_each_log_type_descriptor);
-							lazybiosType15LogTypeDescriptor_t* descriptor =
-								&current->supported_log_type_descriptors[i];
-							descriptor->log_type = p[descriptor_offset + DESCRIPTOR_LOG_TYPE];
-							descriptor->variable_data_format_type =
-								p[descriptor_offset + DESCRIPTOR_VARIABLE_DATA_FORMAT_TYPE];
-							LAZYBIOS_MARK_PRESENT(descriptor, log_type);
-							LAZYBIOS_MARK_PRESENT(descriptor, variable_data_format_type);
-						}
-						LAZYBIOS_MARK_PRESENT(current, supported_log_type_descriptors);
-					} else {
-						current->supported_log_type_descriptors = NULL;
-						LAZYBIOS_MARK_UNREACHABLE(current, supported_log_type_descriptors);
-						LAZYBIOS_MARK_ABSENT(current, supported_log_type_descriptors);
-					}
-				}
-			} else {
-				current->log_header_format = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, log_header_format);
-				current->number_of_supported_log_type_descriptors = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, number_of_supported_log_type_descriptors);
-				current->length_of_each_log_type_descriptor = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, length_of_each_log_type_descriptor);
-				current->supported_log_type_descriptors = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, supported_log_type_descriptors);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_EVENT_LOG);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType15(&Type15[index], &cursor) != 0) {
+			lazybiosFreeType15(Type15, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type15_count = index;
 	return Type15;
@@ -321,8 +322,8 @@ void lazybiosFreeType15(lazybiosType15_t* Type15, size_t type15_count) {
     if (!Type15) return;
 
     for (size_t i = 0; i < type15_count; i++) {
-        free(Type15[i].supported_log_type_descriptors);
+        lazybiosFree(Type15[i].supported_log_type_descriptors);
     }
 
-    free(Type15);
+    lazybiosFree(Type15);
 }
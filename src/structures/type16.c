@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType16FieldStatus_t, lazybiosType16FieldIndex_t, 7);
+
 // Fields
 #define LOCATION 0x04
 #define USE 0x05
@@ -71,52 +73,49 @@
 #define ERROR_CORRECTION_MULTI_BIT_ECC 0x06
 #define ERROR_CORRECTION_CRC 0x07
 
+const lazybiosFieldDesc lazybiosType16Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType16_t, location, LOCATION, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType16_t, use, USE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType16_t, memory_error_correction, MEMORY_ERROR_CORRECTION, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType16_t, maximum_capacity, MAXIMUM_CAPACITY, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType16_t, memory_error_information_handle, MEMORY_ERROR_INFORMATION_HANDLE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType16_t, number_of_memory_devices, NUMBER_OF_MEMORY_DEVICES, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType16_t, extended_maximum_capacity, EXTENDED_MAXIMUM_CAPACITY, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType16(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType16_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType16Fields, cursor);
+
+	if (current->memory_error_information_handle == 0xFFFE ||
+		current->memory_error_information_handle == 0xFFFF) {
+		LAZYBIOS_MARK_ABSENT(current, memory_error_information_handle);
+	}
+
+	return 0;
+}
+
 lazybiosType16_t* lazybiosGetType16(lazybiosType16_t* Type16, size_t* type16_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_PHYSICAL_MEMORY_ARRAY);
 	size_t index = 0;
 
-	Type16 = calloc(count, sizeof(lazybiosType16_t));
+	Type16 = lazybiosCalloc(count, sizeof(lazybiosType16_t));
 	if (!Type16) return NULL;
 	if (count == 0) {
 		*type16_count = 0;
 		return Type16;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_PHYSICAL_MEMORY_ARRAY) {
-			if (index >= count) break;
-			lazybiosType16_t* current = &Type16[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, location, len, LOCATION, p);
-			READU8(current, use, len, USE, p);
-			READU8(current, memory_error_correction, len, MEMORY_ERROR_CORRECTION, p);
-			READU32(current, maximum_capacity, len, MAXIMUM_CAPACITY, p);
-			READU16(current, memory_error_information_handle, len, MEMORY_ERROR_INFORMATION_HANDLE, p);
-			if (current->memory_error_information_handle == 0xFFFE ||
-				current->memory_error_information_handle == 0xFFFF) {
-				LAZYBIOS_MARK_ABSENT(current, memory_error_information_handle);
-			}
-			READU16(current, number_of_memory_devices, len, NUMBER_OF_MEMORY_DEVICES, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 7)) {
-				READU64(current, extended_maximum_capacity, len, EXTENDED_MAXIMUM_CAPACITY, p);
-			} else {
-				current->extended_maximum_capacity = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_maximum_capacity);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_PHYSICAL_MEMORY_ARRAY);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType16(&Type16[index], &cursor);
+		index++;
 	}
 	*type16_count = index;
 	return Type16;
@@ -210,5 +209,5 @@ void lazybiosFreeType16(lazybiosType16_t* Type16, size_t type16_count) {
     (void)type16_count;
     if (!Type16) return;
 
-    free(Type16);
+    lazybiosFree(Type16);
 }
@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType17FieldStatus_t, lazybiosType17FieldIndex_t, 39);
+
 // Fields
 #define PHYSICAL_MEMORY_ARRAY_HANDLE 0x04
 #define MEMORY_ERROR_INFORMATION_HANDLE 0x06
@@ -135,220 +137,86 @@
 #define INTEL_OPTANE_PERSISTENT_MEMORY 0x07
 #define MRDIMM_DEPRECATED 0x08
 
+const lazybiosFieldDesc lazybiosType17Fields[] = {
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, physical_memory_array_handle, PHYSICAL_MEMORY_ARRAY_HANDLE, 2, 1, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, memory_error_information_handle, MEMORY_ERROR_INFORMATION_HANDLE, 2, 1, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, total_width, TOTAL_WIDTH, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, data_width, DATA_WIDTH, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, size, SIZE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType17_t, form_factor, FORM_FACTOR, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType17_t, device_set, DEVICE_SET, 2, 1, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, device_locator, DEVICE_LOCATOR, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, bank_locator, BANK_LOCATOR, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType17_t, memory_type, MEMORY_TYPE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, type_detail, TYPE_DETAIL, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, speed, SPEED, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, manufacturer, MANUFACTURER, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, serial_number, SERIAL_NUMBER, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, asset_tag, ASSET_TAG, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, part_number, PART_NUMBER, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType17_t, attributes, ATTRIBUTES, 2, 6, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U32(lazybiosType17_t, extended_size, EXTENDED_SIZE, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, configured_memory_speed, CONFIGURED_MEMORY_SPEED, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, minimum_voltage, MINIMUM_VOLTAGE, 2, 8, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, maximum_voltage, MAXIMUM_VOLTAGE, 2, 8, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, configured_voltage, CONFIGURED_VOLTAGE, 2, 8, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType17_t, memory_technology, MEMORY_TECHNOLOGY, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, memory_operating_mode_capability, MEMORY_OPERATING_MODE_CAPABILITY, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType17_t, firmware_version, FIRMWARE_VERSION, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, module_manufacturer_id, MODULE_MANUFACTURER_ID, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, module_product_id, MODULE_PRODUCT_ID, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, memory_subsystem_controller_manufacturer_id, MEMORY_SUBSYSTEM_CONTROLLER_MANUFACTURER_ID, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, memory_subsystem_controller_product_id, MEMORY_SUBSYSTEM_CONTROLLER_PRODUCT_ID, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U64(lazybiosType17_t, non_volatile_size, NON_VOLATILE_SIZE, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U64(lazybiosType17_t, volatile_size, VOLATILE_SIZE, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U64(lazybiosType17_t, cache_size, CACHE_SIZE, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U64(lazybiosType17_t, logical_size, LOGICAL_SIZE, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U32(lazybiosType17_t, extended_speed, EXTENDED_SPEED, 3, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U32(lazybiosType17_t, extended_configured_memory_speed, EXTENDED_CONFIGURED_MEMORY_SPEED, 3, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, pmic0_manufacturer_id, PMIC0_MANUFACTURER_ID, 3, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, pmic0_revision_number, PMIC0_REVISION_NUMBER, 3, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, rcd_manufacturer_id, RCD_MANUFACTURER_ID, 3, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType17_t, rcd_revision_number, RCD_REVISION_NUMBER, 3, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType17(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType17_t* current = record;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType17Fields, cursor);
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
+		if (current->physical_memory_array_handle == 0xFFFF) {
+			LAZYBIOS_MARK_ABSENT(current, physical_memory_array_handle);
+		}
+		if (current->memory_error_information_handle == 0xFFFE ||
+			current->memory_error_information_handle == 0xFFFF) {
+			LAZYBIOS_MARK_ABSENT(current, memory_error_information_handle);
+		}
+	}
+
+	return 0;
+}
+
 lazybiosType17_t* lazybiosGetType17(lazybiosType17_t* Type17, size_t* type17_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MEMORY_DEVICE);
 	size_t index = 0;
-	Type17 = calloc(count, sizeof(lazybiosType17_t));
+	Type17 = lazybiosCalloc(count, sizeof(lazybiosType17_t));
 	if (!Type17) return NULL;
 	if (count == 0) {
 		*type17_count = 0;
 		return Type17;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MEMORY_DEVICE) {
-			if (index >= count) break;
-			lazybiosType17_t* current = &Type17[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU16(current, physical_memory_array_handle, len, PHYSICAL_MEMORY_ARRAY_HANDLE, p);
-
-				READU16(current, memory_error_information_handle, len, MEMORY_ERROR_INFORMATION_HANDLE, p);
-				if (current->physical_memory_array_handle == 0xFFFF) {
-					LAZYBIOS_MARK_ABSENT(current, physical_memory_array_handle);
-				}
-				if (current->memory_error_information_handle == 0xFFFE ||
-					current->memory_error_information_handle == 0xFFFF) {
-					LAZYBIOS_MARK_ABSENT(current, memory_error_information_handle);
-				}
-
-				READU16(current, total_width, len, TOTAL_WIDTH, p);
-
-				READU16(current, data_width, len, DATA_WIDTH, p);
-
-				READU16(current, size, len, SIZE, p);
-
-				READU8(current, form_factor, len, FORM_FACTOR, p);
-				READU8(current, device_set, len, DEVICE_SET, p);
-
-				READSTR(current, device_locator, len, DEVICE_LOCATOR, p, structure_end);
-
-				READSTR(current, bank_locator, len, BANK_LOCATOR, p, structure_end);
-
-				READU8(current, memory_type, len, MEMORY_TYPE, p);
-
-				READU16(current, type_detail, len, TYPE_DETAIL, p);
-			} else {
-				current->physical_memory_array_handle = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, physical_memory_array_handle);
-				current->memory_error_information_handle = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, memory_error_information_handle);
-				current->total_width = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, total_width);
-				current->data_width = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, data_width);
-				current->size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, size);
-				current->form_factor = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, form_factor);
-				current->device_set = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, device_set);
-				current->device_locator = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, device_locator);
-				current->bank_locator = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, bank_locator);
-				current->memory_type = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, memory_type);
-				current->type_detail = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, type_detail);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 3)) {
-				READU16(current, speed, len, SPEED, p);
-
-				READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-
-				READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-
-				READSTR(current, asset_tag, len, ASSET_TAG, p, structure_end);
-
-				READSTR(current, part_number, len, PART_NUMBER, p, structure_end);
-			} else {
-				current->speed = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, speed);
-				current->manufacturer = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, manufacturer);
-				current->serial_number = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, serial_number);
-				current->asset_tag = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, asset_tag);
-				current->part_number = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, part_number);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 6)) {
-				READU8(current, attributes, len, ATTRIBUTES, p);
-			} else {
-				current->attributes = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, attributes);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 7)) {
-				READU32(current, extended_size, len, EXTENDED_SIZE, p);
-
-				READU16(current, configured_memory_speed, len, CONFIGURED_MEMORY_SPEED, p);
-			} else {
-				current->extended_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_size);
-				current->configured_memory_speed = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, configured_memory_speed);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 8)) {
-				READU16(current, minimum_voltage, len, MINIMUM_VOLTAGE, p);
-
-				READU16(current, maximum_voltage, len, MAXIMUM_VOLTAGE, p);
-
-				READU16(current, configured_voltage, len, CONFIGURED_VOLTAGE, p);
-			} else {
-				current->minimum_voltage = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, minimum_voltage);
-				current->maximum_voltage = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, maximum_voltage);
-				current->configured_voltage = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, configured_voltage);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 2)) {
-				READU8(current, memory_technology, len, MEMORY_TECHNOLOGY, p);
-
-				READU16(current, memory_operating_mode_capability, len, MEMORY_OPERATING_MODE_CAPABILITY, p);
-
-				READSTR(current, firmware_version, len, FIRMWARE_VERSION, p, structure_end);
-
-				READU16(current, module_manufacturer_id, len, MODULE_MANUFACTURER_ID, p);
-
-				READU16(current, module_product_id, len, MODULE_PRODUCT_ID, p);
-
-				READU16(current, memory_subsystem_controller_manufacturer_id, len, MEMORY_SUBSYSTEM_CONTROLLER_MANUFACTURER_ID, p);
-
-				READU16(current, memory_subsystem_controller_product_id, len, MEMORY_SUBSYSTEM_CONTROLLER_PRODUCT_ID, p);
-
-				READU64(current, non_volatile_size, len, NON_VOLATILE_SIZE, p);
-
-				READU64(current, volatile_size, len, VOLATILE_SIZE, p);
-
-				READU64(current, cache_size, len, CACHE_SIZE, p);
-
-				READU64(current, logical_size, len, LOGICAL_SIZE, p);
-			} else {
-				current->memory_technology = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, memory_technology);
-				current->memory_operating_mode_capability = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, memory_operating_mode_capability);
-				current->firmware_version = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, firmware_version);
-				current->module_manufacturer_id = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, module_manufacturer_id);
-				current->module_product_id = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, module_product_id);
-				current->memory_subsystem_controller_manufacturer_id = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, memory_subsystem_controller_manufacturer_id);
-				current->memory_subsystem_controller_product_id = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, memory_subsystem_controller_product_id);
-				current->non_volatile_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, non_volatile_size);
-				current->volatile_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, volatile_size);
-				current->cache_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, cache_size);
-				current->logical_size = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, logical_size);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 3)) {
-				READU32(current, extended_speed, len, EXTENDED_SPEED, p);
-
-				READU32(current, extended_configured_memory_speed, len, EXTENDED_CONFIGURED_MEMORY_SPEED, p);
-			} else {
-				current->extended_speed = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_speed);
-				current->extended_configured_memory_speed = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_configured_memory_speed);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 7)) {
-				READU16(current, pmic0_manufacturer_id, len, PMIC0_MANUFACTURER_ID, p);
-
-				READU16(current, pmic0_revision_number, len, PMIC0_REVISION_NUMBER, p);
-
-				READU16(current, rcd_manufacturer_id, len, RCD_MANUFACTURER_ID, p);
-
-				READU16(current, rcd_revision_number, len, RCD_REVISION_NUMBER, p);
-			} else {
-				current->pmic0_manufacturer_id = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, pmic0_manufacturer_id);
-				current->pmic0_revision_number = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, pmic0_revision_number);
-				current->rcd_manufacturer_id = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, rcd_manufacturer_id);
-				current->rcd_revision_number = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, rcd_revision_number);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MEMORY_DEVICE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType17(&Type17[index], &cursor);
+		index++;
 	}
 	*type17_count = index;
 	return Type17;
@@ -662,5 +530,5 @@ void lazybiosFreeType17(lazybiosType17_t* Type17, size_t type17_count) {
     (void)type17_count;
     if (!Type17) return;
 
-    free(Type17);
+    lazybiosFree(Type17);
 }
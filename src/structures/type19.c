@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType19FieldStatus_t, lazybiosType19FieldIndex_t, 6);
+
 // Fields
 #define STARTING_ADDRESS 0x04
 #define ENDING_ADDRESS 0x08
@@ -35,50 +37,45 @@
 // Address Selection
 #define USE_EXTENDED_ADDRESS 0xFFFFFFFFU
 
+const lazybiosFieldDesc lazybiosType19Fields[] = {
+	LAZYBIOS_FIELD_U32(lazybiosType19_t, starting_address, STARTING_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType19_t, ending_address, ENDING_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType19_t, memory_array_handle, MEMORY_ARRAY_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType19_t, partition_width, PARTITION_WIDTH, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType19_t, extended_starting_address, EXTENDED_STARTING_ADDRESS, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U64(lazybiosType19_t, extended_ending_address, EXTENDED_ENDING_ADDRESS, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType19(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType19_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType19Fields, cursor);
+
+	if (current->memory_array_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, memory_array_handle);
+
+	return 0;
+}
+
 lazybiosType19_t* lazybiosGetType19(lazybiosType19_t* Type19, size_t* type19_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MEMORY_ARRAY_MAPPED_ADDRESS);
 	size_t index = 0;
 
-	Type19 = calloc(count, sizeof(lazybiosType19_t));
+	Type19 = lazybiosCalloc(count, sizeof(lazybiosType19_t));
 	if (!Type19) return NULL;
 	if (count == 0) {
 		*type19_count = 0;
 		return Type19;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MEMORY_ARRAY_MAPPED_ADDRESS) {
-			if (index >= count) break;
-			lazybiosType19_t* current = &Type19[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU32(current, starting_address, len, STARTING_ADDRESS, p);
-			READU32(current, ending_address, len, ENDING_ADDRESS, p);
-			READU16(current, memory_array_handle, len, MEMORY_ARRAY_HANDLE, p);
-			if (current->memory_array_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, memory_array_handle);
-			READU8(current, partition_width, len, PARTITION_WIDTH, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 7)) {
-				READU64(current, extended_starting_address, len, EXTENDED_STARTING_ADDRESS, p);
-				READU64(current, extended_ending_address, len, EXTENDED_ENDING_ADDRESS, p);
-			} else {
-				current->extended_starting_address = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_starting_address);
-				current->extended_ending_address = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_ending_address);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MEMORY_ARRAY_MAPPED_ADDRESS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType19(&Type19[index], &cursor);
+		index++;
 	}
 	*type19_count = index;
 	return Type19;
@@ -98,5 +95,5 @@ void lazybiosFreeType19(lazybiosType19_t* Type19, size_t type19_count) {
     (void)type19_count;
     if (!Type19) return;
 
-    free(Type19);
+    lazybiosFree(Type19);
 }
@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType2FieldStatus_t, lazybiosType2FieldIndex_t, 11);
+
 // Fields
 #define MANUFACTURER 0x04
 #define PRODUCT 0x05
@@ -55,74 +57,71 @@
 #define BOARD_TYPE_PROCESSOR_IO_MODULE 0x0C
 #define BOARD_TYPE_INTERCONNECT_BOARD 0x0D
 
+const lazybiosFieldDesc lazybiosType2Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType2_t, manufacturer, MANUFACTURER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType2_t, product, PRODUCT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType2_t, version, VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType2_t, serial_number, SERIAL_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType2_t, asset_tag, ASSET_TAG, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType2_t, feature_flags, FEATURE_FLAGS, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType2_t, location_in_chassis, LOCATION_IN_CHASSIS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType2_t, chassis_handle, CHASSIS_HANDLE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType2_t, board_type, BOARD_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType2_t, number_of_contained_object_handles, NUMBER_OF_CONTAINED_OBJECT_HANDLES, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType2(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType2_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType2Fields, cursor);
+
+	
+
+	if (current->chassis_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, chassis_handle);
+
+	if (LAZYBIOS_FIELD_STATUS(current, number_of_contained_object_handles) == LAZYBIOS_FIELD_PRESENT &&
+		current->number_of_contained_object_handles > 0) {
+		const size_t array_bytes = current->number_of_contained_object_handles * sizeof(uint16_t);
+
+		if (len >= CONTAINED_OBJECT_HANDLES + array_bytes) {
+			current->contained_object_handles = lazybiosStructCursorAlloc(cursor, array_bytes, 1);
+			if (current->contained_object_handles) {
+				memcpy(current->contained_object_handles, p + CONTAINED_OBJECT_HANDLES, array_bytes);
+				LAZYBIOS_MARK_PRESENT(current, contained_object_handles);
+			}
+		} else {
+			current->contained_object_handles = NULL;
+			LAZYBIOS_MARK_UNREACHABLE(current, contained_object_handles);
+			LAZYBIOS_MARK_ABSENT(current, contained_object_handles);
+		}
+	} else if (LAZYBIOS_FIELD_STATUS(current, number_of_contained_object_handles) == LAZYBIOS_FIELD_PRESENT) {
+		LAZYBIOS_MARK_ABSENT(current, contained_object_handles);
+	}
+
+	return 0;
+}
+
 lazybiosType2_t* lazybiosGetType2(lazybiosType2_t* Type2, size_t* type2_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_BASEBOARD);
 	size_t index = 0;
-	Type2 = calloc(count, sizeof(lazybiosType2_t));
+	Type2 = lazybiosCalloc(count, sizeof(lazybiosType2_t));
 	if (!Type2) return NULL;
 	if (count == 0) {
 		*type2_count = 0;
 		return Type2;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_BASEBOARD) {
-			if (index >= count) break;
-			lazybiosType2_t* current = &Type2[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-			
-			READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-
-			READSTR(current, product, len, PRODUCT, p, structure_end);
-
-			READSTR(current, version, len, VERSION, p, structure_end);
-
-			READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-
-			READSTR(current, asset_tag, len, ASSET_TAG, p, structure_end);
-
-			READU8(current, feature_flags, len, FEATURE_FLAGS, p);
-
-			READSTR(current, location_in_chassis, len, LOCATION_IN_CHASSIS, p, structure_end);
-
-			READU16(current, chassis_handle, len, CHASSIS_HANDLE, p);
-			if (current->chassis_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, chassis_handle);
-
-			READU8(current, board_type, len, BOARD_TYPE, p);
-
-			READU8(current, number_of_contained_object_handles, len, NUMBER_OF_CONTAINED_OBJECT_HANDLES, p);
-
-			if (LAZYBIOS_FIELD_STATUS(current, number_of_contained_object_handles) == LAZYBIOS_FIELD_PRESENT &&
-				current->number_of_contained_object_handles > 0) {
-				const size_t array_bytes = current->number_of_contained_object_handles * sizeof(uint16_t);
-
-				if (len >= CONTAINED_OBJECT_HANDLES + array_bytes) {
-					current->contained_object_handles = malloc(array_bytes);
-					if (current->contained_object_handles) {
-						memcpy(current->contained_object_handles, p + CONTAINED_OBJECT_HANDLES, array_bytes);
-						LAZYBIOS_MARK_PRESENT(current, contained_object_handles);
-					}
-				} else {
-					current->contained_object_handles = NULL;
-					LAZYBIOS_MARK_UNREACHABLE(current, contained_object_handles);
-					LAZYBIOS_MARK_ABSENT(current, contained_object_handles);
-				}
-			} else if (LAZYBIOS_FIELD_STATUS(current, number_of_contained_object_handles) == LAZYBIOS_FIELD_PRESENT) {
-				LAZYBIOS_MARK_ABSENT(current, contained_object_handles);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_BASEBOARD);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType2(&Type2[index], &cursor);
+		index++;
 	}
 	*type2_count = index;
 	return Type2;
@@ -183,7 +182,7 @@ const char* lazybiosType2BoardTypeStr(uint8_t board_type) {
 
 void lazybiosFreeType2(lazybiosType2_t* Type2, size_t type2_count) {
 	if (!Type2) return;
-	for (size_t i = 0; i < type2_count; i++) free(Type2[i].contained_object_handles);
+	for (size_t i = 0; i < type2_count; i++) lazybiosFree(Type2[i].contained_object_handles);
 
-    free(Type2);
+    lazybiosFree(Type2);
 }
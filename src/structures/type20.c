@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType20FieldStatus_t, lazybiosType20FieldIndex_t, 9);
+
 // Fields
 #define STARTING_ADDRESS 0x04
 #define ENDING_ADDRESS 0x08
@@ -38,56 +40,51 @@
 // Address Selection
 #define USE_EXTENDED_ADDRESS 0xFFFFFFFFU
 
+const lazybiosFieldDesc lazybiosType20Fields[] = {
+	LAZYBIOS_FIELD_U32(lazybiosType20_t, starting_address, STARTING_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType20_t, ending_address, ENDING_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType20_t, memory_device_handle, MEMORY_DEVICE_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType20_t, memory_array_mapped_address_handle, MEMORY_ARRAY_MAPPED_ADDRESS_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType20_t, partition_row_position, PARTITION_ROW_POSITION, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType20_t, interleave_position, INTERLEAVE_POSITION, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType20_t, interleaved_data_depth, INTERLEAVED_DATA_DEPTH, 0, 0, 0),
+	LAZYBIOS_FIELD_U64(lazybiosType20_t, extended_starting_address, EXTENDED_STARTING_ADDRESS, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U64(lazybiosType20_t, extended_ending_address, EXTENDED_ENDING_ADDRESS, 2, 7, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType20(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType20_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType20Fields, cursor);
+
+	if (current->memory_device_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, memory_device_handle);
+	if (current->memory_array_mapped_address_handle == 0xFFFF) {
+		LAZYBIOS_MARK_ABSENT(current, memory_array_mapped_address_handle);
+	}
+
+	return 0;
+}
+
 lazybiosType20_t* lazybiosGetType20(lazybiosType20_t* Type20, size_t* type20_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MEMORY_DEVICE_MAPPED_ADDRESS);
 	size_t index = 0;
 
-	Type20 = calloc(count, sizeof(lazybiosType20_t));
+	Type20 = lazybiosCalloc(count, sizeof(lazybiosType20_t));
 	if (!Type20) return NULL;
 	if (count == 0) {
 		*type20_count = 0;
 		return Type20;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MEMORY_DEVICE_MAPPED_ADDRESS) {
-			if (index >= count) break;
-			lazybiosType20_t* current = &Type20[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU32(current, starting_address, len, STARTING_ADDRESS, p);
-			READU32(current, ending_address, len, ENDING_ADDRESS, p);
-			READU16(current, memory_device_handle, len, MEMORY_DEVICE_HANDLE, p);
-			READU16(current, memory_array_mapped_address_handle, len, MEMORY_ARRAY_MAPPED_ADDRESS_HANDLE, p);
-			if (current->memory_device_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, memory_device_handle);
-			if (current->memory_array_mapped_address_handle == 0xFFFF) {
-				LAZYBIOS_MARK_ABSENT(current, memory_array_mapped_address_handle);
-			}
-			READU8(current, partition_row_position, len, PARTITION_ROW_POSITION, p);
-			READU8(current, interleave_position, len, INTERLEAVE_POSITION, p);
-			READU8(current, interleaved_data_depth, len, INTERLEAVED_DATA_DEPTH, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 7)) {
-				READU64(current, extended_starting_address, len, EXTENDED_STARTING_ADDRESS, p);
-				READU64(current, extended_ending_address, len, EXTENDED_ENDING_ADDRESS, p);
-			} else {
-				current->extended_starting_address = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_starting_address);
-				current->extended_ending_address = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, extended_ending_address);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MEMORY_DEVICE_MAPPED_ADDRESS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType20(&Type20[index], &cursor);
+		index++;
 	}
 	*type20_count = index;
 	return Type20;
@@ -107,5 +104,5 @@ void lazybiosFreeType20(lazybiosType20_t* Type20, size_t type20_count) {
     (void)type20_count;
     if (!Type20) return;
 
-    free(Type20);
+    lazybiosFree(Type20);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType21FieldStatus_t, lazybiosType21FieldIndex_t, 3);
+
 // Fields
 #define POINTING_DEVICE_TYPE 0x04
 #define INTERFACE 0x05
@@ -55,38 +57,40 @@
 #define INTERFACE_I2C 0xA3
 #define INTERFACE_SPI 0xA4
 
+const lazybiosFieldDesc lazybiosType21Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType21_t, pointing_device_type, POINTING_DEVICE_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType21_t, interface, INTERFACE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType21_t, number_of_buttons, NUMBER_OF_BUTTONS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType21(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType21_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType21Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType21_t* lazybiosGetType21(lazybiosType21_t* Type21, size_t* type21_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_BUILT_IN_POINTING_DEVICE);
 	size_t index = 0;
 
-	Type21 = calloc(count, sizeof(lazybiosType21_t));
+	Type21 = lazybiosCalloc(count, sizeof(lazybiosType21_t));
 	if (!Type21) return NULL;
 	if (count == 0) {
 		*type21_count = 0;
 		return Type21;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_BUILT_IN_POINTING_DEVICE) {
-			if (index >= count) break;
-			lazybiosType21_t* current = &Type21[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, pointing_device_type, len, POINTING_DEVICE_TYPE, p);
-			READU8(current, interface, len, INTERFACE, p);
-			READU8(current, number_of_buttons, len, NUMBER_OF_BUTTONS, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_BUILT_IN_POINTING_DEVICE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType21(&Type21[index], &cursor);
+		index++;
 	}
 	*type21_count = index;
 	return Type21;
@@ -154,5 +158,5 @@ void lazybiosFreeType21(lazybiosType21_t* Type21, size_t type21_count) {
     (void)type21_count;
     if (!Type21) return;
 
-    free(Type21);
+    lazybiosFree(Type21);
 }
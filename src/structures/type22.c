@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType22FieldStatus_t, lazybiosType22FieldIndex_t, 15);
+
 // Fields
 #define LOCATION 0x04
 #define MANUFACTURER 0x05
@@ -52,76 +54,68 @@
 #define DEVICE_CHEMISTRY_ZINC_AIR 0x07
 #define DEVICE_CHEMISTRY_LITHIUM_POLYMER 0x08
 
+const lazybiosFieldDesc lazybiosType22Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, location, LOCATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, manufacturer, MANUFACTURER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, manufacture_date, MANUFACTURE_DATE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, serial_number, SERIAL_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, device_name, DEVICE_NAME, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType22_t, device_chemistry, DEVICE_CHEMISTRY, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType22_t, design_capacity, DESIGN_CAPACITY, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType22_t, design_voltage, DESIGN_VOLTAGE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, sbds_version_number, SBDS_VERSION_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType22_t, maximum_error, MAXIMUM_ERROR, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType22_t, sbds_serial_number, SBDS_SERIAL_NUMBER, 2, 2, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType22_t, sbds_manufacture_date, SBDS_MANUFACTURE_DATE, 2, 2, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType22_t, sbds_device_chemistry, SBDS_DEVICE_CHEMISTRY, 2, 2, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType22_t, design_capacity_multiplier, DESIGN_CAPACITY_MULTIPLIER, 2, 2, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType22_t, oem_specific, OEM_SPECIFIC, 2, 2, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType22(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType22_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType22Fields, cursor);
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 2)) {
+		if (len > SERIAL_NUMBER && p[SERIAL_NUMBER] != 0) {
+			LAZYBIOS_MARK_ABSENT(current, sbds_serial_number);
+		}
+		if (len > MANUFACTURE_DATE && p[MANUFACTURE_DATE] != 0) {
+			LAZYBIOS_MARK_ABSENT(current, sbds_manufacture_date);
+		}
+		if (LAZYBIOS_FIELD_STATUS(current, device_chemistry) == LAZYBIOS_FIELD_PRESENT &&
+			current->device_chemistry != 0x02) {
+			LAZYBIOS_MARK_ABSENT(current, sbds_device_chemistry);
+		}
+	}
+
+	return 0;
+}
+
 lazybiosType22_t* lazybiosGetType22(lazybiosType22_t* Type22, size_t* type22_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_PORTABLE_BATTERY);
 	size_t index = 0;
 
-	Type22 = calloc(count, sizeof(lazybiosType22_t));
+	Type22 = lazybiosCalloc(count, sizeof(lazybiosType22_t));
 	if (!Type22) return NULL;
 	if (count == 0) {
 		*type22_count = 0;
 		return Type22;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_PORTABLE_BATTERY) {
-			if (index >= count) break;
-			lazybiosType22_t* current = &Type22[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, location, len, LOCATION, p, structure_end);
-			READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-			READSTR(current, manufacture_date, len, MANUFACTURE_DATE, p, structure_end);
-			READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-			READSTR(current, device_name, len, DEVICE_NAME, p, structure_end);
-			READU8(current, device_chemistry, len, DEVICE_CHEMISTRY, p);
-			READU16(current, design_capacity, len, DESIGN_CAPACITY, p);
-			READU16(current, design_voltage, len, DESIGN_VOLTAGE, p);
-			READSTR(current, sbds_version_number, len, SBDS_VERSION_NUMBER, p, structure_end);
-			READU8(current, maximum_error, len, MAXIMUM_ERROR, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 2)) {
-				READU16(current, sbds_serial_number, len, SBDS_SERIAL_NUMBER, p);
-				READU16(current, sbds_manufacture_date, len, SBDS_MANUFACTURE_DATE, p);
-				READSTR(current, sbds_device_chemistry, len, SBDS_DEVICE_CHEMISTRY, p, structure_end);
-				READU8(current, design_capacity_multiplier, len, DESIGN_CAPACITY_MULTIPLIER, p);
-				READU32(current, oem_specific, len, OEM_SPECIFIC, p);
-
-				if (len > SERIAL_NUMBER && p[SERIAL_NUMBER] != 0) {
-					LAZYBIOS_MARK_ABSENT(current, sbds_serial_number);
-				}
-				if (len > MANUFACTURE_DATE && p[MANUFACTURE_DATE] != 0) {
-					LAZYBIOS_MARK_ABSENT(current, sbds_manufacture_date);
-				}
-				if (current->field_status.device_chemistry == LAZYBIOS_FIELD_PRESENT &&
-					current->device_chemistry != 0x02) {
-					LAZYBIOS_MARK_ABSENT(current, sbds_device_chemistry);
-				}
-			} else {
-				current->sbds_serial_number = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, sbds_serial_number);
-				current->sbds_manufacture_date = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, sbds_manufacture_date);
-				current->sbds_device_chemistry = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, sbds_device_chemistry);
-				current->design_capacity_multiplier = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, design_capacity_multiplier);
-				current->oem_specific = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, oem_specific);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_PORTABLE_BATTERY);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType22(&Type22[index], &cursor);
+		index++;
 	}
 	*type22_count = index;
 	return Type22;
@@ -171,5 +165,5 @@ void lazybiosFreeType22(lazybiosType22_t* Type22, size_t type22_count) {
     (void)type22_count;
     if (!Type22) return;
 
-    free(Type22);
+    lazybiosFree(Type22);
 }
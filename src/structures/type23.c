@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType23FieldStatus_t, lazybiosType23FieldIndex_t, 5);
+
 // Fields
 #define CAPABILITIES 0x04
 #define RESET_COUNT 0x05
@@ -46,40 +48,42 @@
 #define BOOT_OPTION_SYSTEM_UTILITIES 0x02
 #define BOOT_OPTION_DO_NOT_REBOOT 0x03
 
+const lazybiosFieldDesc lazybiosType23Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType23_t, capabilities, CAPABILITIES, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType23_t, reset_count, RESET_COUNT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType23_t, reset_limit, RESET_LIMIT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType23_t, timer_interval, TIMER_INTERVAL, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType23_t, timeout, TIMEOUT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType23(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType23_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType23Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType23_t* lazybiosGetType23(lazybiosType23_t* Type23, size_t* type23_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_RESET);
 	size_t index = 0;
 
-	Type23 = calloc(count, sizeof(lazybiosType23_t));
+	Type23 = lazybiosCalloc(count, sizeof(lazybiosType23_t));
 	if (!Type23) return NULL;
 	if (count == 0) {
 		*type23_count = 0;
 		return Type23;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_RESET) {
-			if (index >= count) break;
-			lazybiosType23_t* current = &Type23[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, capabilities, len, CAPABILITIES, p);
-			READU16(current, reset_count, len, RESET_COUNT, p);
-			READU16(current, reset_limit, len, RESET_LIMIT, p);
-			READU16(current, timer_interval, len, TIMER_INTERVAL, p);
-			READU16(current, timeout, len, TIMEOUT, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_RESET);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType23(&Type23[index], &cursor);
+		index++;
 	}
 	*type23_count = index;
 	return Type23;
@@ -128,5 +132,5 @@ void lazybiosFreeType23(lazybiosType23_t* Type23, size_t type23_count) {
     (void)type23_count;
     if (!Type23) return;
 
-    free(Type23);
+    lazybiosFree(Type23);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType24FieldStatus_t, lazybiosType24FieldIndex_t, 1);
+
 // Fields
 #define HARDWARE_SECURITY_SETTINGS 0x04
 
@@ -42,36 +44,38 @@
 #define SECURITY_STATUS_NOT_IMPLEMENTED 0x02
 #define SECURITY_STATUS_UNKNOWN 0x03
 
+const lazybiosFieldDesc lazybiosType24Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType24_t, hardware_security_settings, HARDWARE_SECURITY_SETTINGS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType24(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType24_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType24Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType24_t* lazybiosGetType24(lazybiosType24_t* Type24, size_t* type24_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_HARDWARE_SECURITY);
 	size_t index = 0;
 
-	Type24 = calloc(count, sizeof(lazybiosType24_t));
+	Type24 = lazybiosCalloc(count, sizeof(lazybiosType24_t));
 	if (!Type24) return NULL;
 	if (count == 0) {
 		*type24_count = 0;
 		return Type24;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_HARDWARE_SECURITY) {
-			if (index >= count) break;
-			lazybiosType24_t* current = &Type24[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, hardware_security_settings, len, HARDWARE_SECURITY_SETTINGS, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_HARDWARE_SECURITY);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType24(&Type24[index], &cursor);
+		index++;
 	}
 	*type24_count = index;
 	return Type24;
@@ -142,5 +146,5 @@ void lazybiosFreeType24(lazybiosType24_t* Type24, size_t type24_count) {
     (void)type24_count;
     if (!Type24) return;
 
-    free(Type24);
+    lazybiosFree(Type24);
 }
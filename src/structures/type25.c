@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType25FieldStatus_t, lazybiosType25FieldIndex_t, 5);
+
 // Fields
 #define NEXT_SCHEDULED_POWER_ON_MONTH 0x04
 #define NEXT_SCHEDULED_POWER_ON_DAY 0x05
@@ -32,40 +34,42 @@
 #define NEXT_SCHEDULED_POWER_ON_MINUTE 0x07
 #define NEXT_SCHEDULED_POWER_ON_SECOND 0x08
 
+const lazybiosFieldDesc lazybiosType25Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType25_t, next_scheduled_power_on_month, NEXT_SCHEDULED_POWER_ON_MONTH, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType25_t, next_scheduled_power_on_day, NEXT_SCHEDULED_POWER_ON_DAY, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType25_t, next_scheduled_power_on_hour, NEXT_SCHEDULED_POWER_ON_HOUR, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType25_t, next_scheduled_power_on_minute, NEXT_SCHEDULED_POWER_ON_MINUTE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType25_t, next_scheduled_power_on_second, NEXT_SCHEDULED_POWER_ON_SECOND, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType25(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType25_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType25Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType25_t* lazybiosGetType25(lazybiosType25_t* Type25, size_t* type25_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_POWER_CONTROLS);
 	size_t index = 0;
 
-	Type25 = calloc(count, sizeof(lazybiosType25_t));
+	Type25 = lazybiosCalloc(count, sizeof(lazybiosType25_t));
 	if (!Type25) return NULL;
 	if (count == 0) {
 		*type25_count = 0;
 		return Type25;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_POWER_CONTROLS) {
-			if (index >= count) break;
-			lazybiosType25_t* current = &Type25[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, next_scheduled_power_on_month, len, NEXT_SCHEDULED_POWER_ON_MONTH, p);
-			READU8(current, next_scheduled_power_on_day, len, NEXT_SCHEDULED_POWER_ON_DAY, p);
-			READU8(current, next_scheduled_power_on_hour, len, NEXT_SCHEDULED_POWER_ON_HOUR, p);
-			READU8(current, next_scheduled_power_on_minute, len, NEXT_SCHEDULED_POWER_ON_MINUTE, p);
-			READU8(current, next_scheduled_power_on_second, len, NEXT_SCHEDULED_POWER_ON_SECOND, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_POWER_CONTROLS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType25(&Type25[index], &cursor);
+		index++;
 	}
 	*type25_count = index;
 	return Type25;
@@ -86,11 +90,11 @@ void lazybiosType25NextScheduledPowerOnStr(const lazybiosType25_t* Type25, char*
 		Type25->next_scheduled_power_on_second
 	};
 	lazybiosFieldStatus_t statuses[5] = {
-		Type25->field_status.next_scheduled_power_on_month,
-		Type25->field_status.next_scheduled_power_on_day,
-		Type25->field_status.next_scheduled_power_on_hour,
-		Type25->field_status.next_scheduled_power_on_minute,
-		Type25->field_status.next_scheduled_power_on_second
+		LAZYBIOS_FIELD_STATUS(Type25, next_scheduled_power_on_month),
+		LAZYBIOS_FIELD_STATUS(Type25, next_scheduled_power_on_day),
+		LAZYBIOS_FIELD_STATUS(Type25, next_scheduled_power_on_hour),
+		LAZYBIOS_FIELD_STATUS(Type25, next_scheduled_power_on_minute),
+		LAZYBIOS_FIELD_STATUS(Type25, next_scheduled_power_on_second)
 	};
 	uint8_t minimums[5] = {1, 1, 0, 0, 0};
 	uint8_t maximums[5] = {12, 31, 23, 59, 59};
@@ -117,5 +121,5 @@ void lazybiosFreeType25(lazybiosType25_t* Type25, size_t type25_count) {
     (void)type25_count;
     if (!Type25) return;
 
-    free(Type25);
+    lazybiosFree(Type25);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType26FieldStatus_t, lazybiosType26FieldIndex_t, 9);
+
 // Fields
 #define DESCRIPTION 0x04
 #define LOCATION_AND_STATUS 0x05
@@ -61,45 +63,46 @@
 #define STATUS_CRITICAL 0x05
 #define STATUS_NON_RECOVERABLE 0x06
 
+const lazybiosFieldDesc lazybiosType26Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType26_t, description, DESCRIPTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType26_t, location_and_status, LOCATION_AND_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType26_t, maximum_value, MAXIMUM_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType26_t, minimum_value, MINIMUM_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType26_t, resolution, RESOLUTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType26_t, tolerance, TOLERANCE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType26_t, accuracy, ACCURACY, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType26_t, oem_defined, OEM_DEFINED, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType26_t, nominal_value, NOMINAL_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType26(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType26_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType26Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType26_t* lazybiosGetType26(lazybiosType26_t* Type26, size_t* type26_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_VOLTAGE_PROBE);
 	size_t index = 0;
 
-	Type26 = calloc(count, sizeof(lazybiosType26_t));
+	Type26 = lazybiosCalloc(count, sizeof(lazybiosType26_t));
 	if (!Type26) return NULL;
 	if (count == 0) {
 		*type26_count = 0;
 		return Type26;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_VOLTAGE_PROBE) {
-			if (index >= count) break;
-			lazybiosType26_t* current = &Type26[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			READU8(current, location_and_status, len, LOCATION_AND_STATUS, p);
-			READU16(current, maximum_value, len, MAXIMUM_VALUE, p);
-			READU16(current, minimum_value, len, MINIMUM_VALUE, p);
-			READU16(current, resolution, len, RESOLUTION, p);
-			READU16(current, tolerance, len, TOLERANCE, p);
-			READU16(current, accuracy, len, ACCURACY, p);
-			READU32(current, oem_defined, len, OEM_DEFINED, p);
-			READU16(current, nominal_value, len, NOMINAL_VALUE, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_VOLTAGE_PROBE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType26(&Type26[index], &cursor);
+		index++;
 	}
 	*type26_count = index;
 	return Type26;
@@ -157,5 +160,5 @@ void lazybiosFreeType26(lazybiosType26_t* Type26, size_t type26_count) {
     (void)type26_count;
     if (!Type26) return;
 
-    free(Type26);
+    lazybiosFree(Type26);
 }
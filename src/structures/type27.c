@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType27FieldStatus_t, lazybiosType27FieldIndex_t, 6);
+
 // Fields
 #define TEMPERATURE_PROBE_HANDLE 0x04
 #define DEVICE_TYPE_AND_STATUS 0x06
@@ -58,48 +60,47 @@
 #define STATUS_CRITICAL 0x05
 #define STATUS_NON_RECOVERABLE 0x06
 
+const lazybiosFieldDesc lazybiosType27Fields[] = {
+	LAZYBIOS_FIELD_U16(lazybiosType27_t, temperature_probe_handle, TEMPERATURE_PROBE_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType27_t, device_type_and_status, DEVICE_TYPE_AND_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType27_t, cooling_unit_group, COOLING_UNIT_GROUP, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType27_t, oem_defined, OEM_DEFINED, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType27_t, nominal_speed, NOMINAL_SPEED, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType27_t, description, DESCRIPTION, 2, 7, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType27(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType27_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType27Fields, cursor);
+
+	if (current->temperature_probe_handle == 0xFFFF) {
+		LAZYBIOS_MARK_ABSENT(current, temperature_probe_handle);
+	}
+
+	return 0;
+}
+
 lazybiosType27_t* lazybiosGetType27(lazybiosType27_t* Type27, size_t* type27_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_COOLING_DEVICE);
 	size_t index = 0;
 
-	Type27 = calloc(count, sizeof(lazybiosType27_t));
+	Type27 = lazybiosCalloc(count, sizeof(lazybiosType27_t));
 	if (!Type27) return NULL;
 	if (count == 0) {
 		*type27_count = 0;
 		return Type27;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_COOLING_DEVICE) {
-			if (index >= count) break;
-			lazybiosType27_t* current = &Type27[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READU16(current, temperature_probe_handle, len, TEMPERATURE_PROBE_HANDLE, p);
-			if (current->temperature_probe_handle == 0xFFFF) {
-				LAZYBIOS_MARK_ABSENT(current, temperature_probe_handle);
-			}
-			READU8(current, device_type_and_status, len, DEVICE_TYPE_AND_STATUS, p);
-			READU8(current, cooling_unit_group, len, COOLING_UNIT_GROUP, p);
-			READU32(current, oem_defined, len, OEM_DEFINED, p);
-			READU16(current, nominal_speed, len, NOMINAL_SPEED, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 7)) {
-				READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_COOLING_DEVICE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType27(&Type27[index], &cursor);
+		index++;
 	}
 	*type27_count = index;
 	return Type27;
@@ -157,5 +158,5 @@ void lazybiosFreeType27(lazybiosType27_t* Type27, size_t type27_count) {
     (void)type27_count;
     if (!Type27) return;
 
-    free(Type27);
+    lazybiosFree(Type27);
 }
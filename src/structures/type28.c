@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType28FieldStatus_t, lazybiosType28FieldIndex_t, 9);
+
 // Fields
 #define DESCRIPTION 0x04
 #define LOCATION_AND_STATUS 0x05
@@ -65,52 +67,56 @@
 #define STATUS_CRITICAL 0x05
 #define STATUS_NON_RECOVERABLE 0x06
 
+const lazybiosFieldDesc lazybiosType28Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType28_t, description, DESCRIPTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType28_t, location_and_status, LOCATION_AND_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType28_t, maximum_value, MAXIMUM_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType28_t, resolution, RESOLUTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType28_t, tolerance, TOLERANCE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType28_t, accuracy, ACCURACY, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType28_t, oem_defined, OEM_DEFINED, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType28_t, nominal_value, NOMINAL_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType28(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType28_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType28Fields, cursor);
+
+	if ((size_t)len >= (size_t)MINIMUM_VALUE + sizeof(current->minimum_value)) {
+		memcpy(&current->minimum_value, p + MINIMUM_VALUE, sizeof(int16_t));
+		LAZYBIOS_MARK_PRESENT(current, minimum_value);
+	} else {
+		current->minimum_value = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, minimum_value);
+		LAZYBIOS_MARK_ABSENT(current, minimum_value);
+	}
+
+	return 0;
+}
+
 lazybiosType28_t* lazybiosGetType28(lazybiosType28_t* Type28, size_t* type28_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_TEMPERATURE_PROBE);
 	size_t index = 0;
 
-	Type28 = calloc(count, sizeof(lazybiosType28_t));
+	Type28 = lazybiosCalloc(count, sizeof(lazybiosType28_t));
 	if (!Type28) return NULL;
 	if (count == 0) {
 		*type28_count = 0;
 		return Type28;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_TEMPERATURE_PROBE) {
-			if (index >= count) break;
-			lazybiosType28_t* current = &Type28[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			READU8(current, location_and_status, len, LOCATION_AND_STATUS, p);
-			READU16(current, maximum_value, len, MAXIMUM_VALUE, p);
-			if ((size_t)len >= (size_t)MINIMUM_VALUE + sizeof(current->minimum_value)) {
-				memcpy(&current->minimum_value, p + MINIMUM_VALUE, sizeof(int16_t));
-				LAZYBIOS_MARK_PRESENT(current, minimum_value);
-			} else {
-				current->minimum_value = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, minimum_value);
-				LAZYBIOS_MARK_ABSENT(current, minimum_value);
-			}
-			READU16(current, resolution, len, RESOLUTION, p);
-			READU16(current, tolerance, len, TOLERANCE, p);
-			READU16(current, accuracy, len, ACCURACY, p);
-			READU32(current, oem_defined, len, OEM_DEFINED, p);
-			READU16(current, nominal_value, len, NOMINAL_VALUE, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_TEMPERATURE_PROBE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType28(&Type28[index], &cursor);
+		index++;
 	}
 	*type28_count = index;
 	return Type28;
@@ -176,5 +182,5 @@ void lazybiosFreeType28(lazybiosType28_t* Type28, size_t type28_count) {
     (void)type28_count;
     if (!Type28) return;
 
-    free(Type28);
+    lazybiosFree(Type28);
 }
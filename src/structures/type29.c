@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType29FieldStatus_t, lazybiosType29FieldIndex_t, 9);
+
 // Fields
 #define DESCRIPTION 0x04
 #define LOCATION_AND_STATUS 0x05
@@ -61,45 +63,46 @@
 #define STATUS_CRITICAL 0x05
 #define STATUS_NON_RECOVERABLE 0x06
 
+const lazybiosFieldDesc lazybiosType29Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType29_t, description, DESCRIPTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType29_t, location_and_status, LOCATION_AND_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType29_t, maximum_value, MAXIMUM_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType29_t, minimum_value, MINIMUM_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType29_t, resolution, RESOLUTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType29_t, tolerance, TOLERANCE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType29_t, accuracy, ACCURACY, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType29_t, oem_defined, OEM_DEFINED, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType29_t, nominal_value, NOMINAL_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType29(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType29_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType29Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType29_t* lazybiosGetType29(lazybiosType29_t* Type29, size_t* type29_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_ELECTRICAL_CURRENT_PROBE);
 	size_t index = 0;
 
-	Type29 = calloc(count, sizeof(lazybiosType29_t));
+	Type29 = lazybiosCalloc(count, sizeof(lazybiosType29_t));
 	if (!Type29) return NULL;
 	if (count == 0) {
 		*type29_count = 0;
 		return Type29;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_ELECTRICAL_CURRENT_PROBE) {
-			if (index >= count) break;
-			lazybiosType29_t* current = &Type29[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			READU8(current, location_and_status, len, LOCATION_AND_STATUS, p);
-			READU16(current, maximum_value, len, MAXIMUM_VALUE, p);
-			READU16(current, minimum_value, len, MINIMUM_VALUE, p);
-			READU16(current, resolution, len, RESOLUTION, p);
-			READU16(current, tolerance, len, TOLERANCE, p);
-			READU16(current, accuracy, len, ACCURACY, p);
-			READU32(current, oem_defined, len, OEM_DEFINED, p);
-			READU16(current, nominal_value, len, NOMINAL_VALUE, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_ELECTRICAL_CURRENT_PROBE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType29(&Type29[index], &cursor);
+		index++;
 	}
 	*type29_count = index;
 	return Type29;
@@ -157,5 +160,5 @@ void lazybiosFreeType29(lazybiosType29_t* Type29, size_t type29_count) {
     (void)type29_count;
     if (!Type29) return;
 
-    free(Type29);
+    lazybiosFree(Type29);
 }
@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType3FieldStatus_t, lazybiosType3FieldIndex_t, 18);
+
 // Fields
 #define MANUFACTURER 0x04
 #define TYPE 0x05
@@ -100,139 +102,112 @@
 #define CHASSIS_SECURITY_STATUS_EXT_INTERFACE_LOCKED_OUT 0x04
 #define CHASSIS_SECURITY_STATUS_EXT_INTERFACE_ENABLED 0x05
 
-lazybiosType3_t* lazybiosGetType3(lazybiosType3_t* Type3, size_t* type3_count, lazybiosDMI_t* DMIData) {
-	if (!DMIData || !DMIData->dmi_data) return NULL;
-
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
-	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_CHASSIS);
-	size_t index = 0;
-	Type3 = calloc(count, sizeof(lazybiosType3_t));
-	if (!Type3) return NULL;
-	if (count == 0) {
-		*type3_count = 0;
-		return Type3;
-	}
-
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_CHASSIS) {
-			if (index >= count) break;
-			lazybiosType3_t* current = &Type3[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-
-			READU8(current, type, len, TYPE, p);
-
-			READSTR(current, version, len, VERSION, p, structure_end);
-
-			READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-
-			READSTR(current, asset_tag, len, ASSET_TAG_NUMBER, p, structure_end);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU8(current, boot_up_state, len, BOOT_UP_STATE, p);
-				READU8(current, power_supply_state, len, POWER_SUPPLY_STATE, p);
-				READU8(current, thermal_state, len, THERMAL_STATE, p);
-				READU8(current, security_status, len, SECURITY_STATUS, p);
+const lazybiosFieldDesc lazybiosType3Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType3_t, manufacturer, MANUFACTURER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, type, TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType3_t, version, VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType3_t, serial_number, SERIAL_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType3_t, asset_tag, ASSET_TAG_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, boot_up_state, BOOT_UP_STATE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, power_supply_state, POWER_SUPPLY_STATE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, thermal_state, THERMAL_STATE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, security_status, SECURITY_STATUS, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U32(lazybiosType3_t, oem_defined, OEM_DEFINED, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, height, HEIGHT, 2, 3, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, number_of_power_cords, NUMBER_OF_POWER_CORDS, 2, 3, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, contained_element_count, CONTAINED_ELEMENT_COUNT, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType3_t, contained_element_record_length, CONTAINED_ELEMENT_RECORD_LENGTH, 2, 3, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType3(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType3_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType3Fields, cursor);
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 3)) {
+		if (current->height == 0 || current->height == 0xFF) LAZYBIOS_MARK_ABSENT(current, height);
+
+		if (current->number_of_power_cords == 0) LAZYBIOS_MARK_ABSENT(current, number_of_power_cords);
+
+		if (LAZYBIOS_FIELD_STATUS(current, contained_element_count) == LAZYBIOS_FIELD_PRESENT &&
+			LAZYBIOS_FIELD_STATUS(current, contained_element_record_length) == LAZYBIOS_FIELD_PRESENT) {
+			const size_t array_bytes = (size_t)current->contained_element_count *
+				current->contained_element_record_length;
+
+			const int contained_layout_valid =
+				(current->contained_element_count == 0 && current->contained_element_record_length == 0) ||
+				(current->contained_element_count > 0 && current->contained_element_record_length >= 3 &&
+				 (size_t)len >= CONTAINED_ELEMENTS + array_bytes);
+
+			if (current->contained_element_count == 0) {
+				LAZYBIOS_MARK_ABSENT(current, contained_elements);
+			} else if (contained_layout_valid) {
+				current->contained_elements = lazybiosStructCursorAlloc(cursor, array_bytes, 1);
+				if (current->contained_elements) {
+					memcpy(current->contained_elements, p + CONTAINED_ELEMENTS, array_bytes);
+					LAZYBIOS_MARK_PRESENT(current, contained_elements);
+				}
 			} else {
-				current->boot_up_state = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, boot_up_state);
-				current->power_supply_state = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, power_supply_state);
-				current->thermal_state = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, thermal_state);
-				current->security_status = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, security_status);
+				LAZYBIOS_MARK_ABSENT(current, contained_elements);
 			}
 
-			if (lazybiosIsVersionPlus(DMIData, 2, 3)) {
-				READU32(current, oem_defined, len, OEM_DEFINED, p);
-
-				READU8(current, height, len, HEIGHT, p);
-				if (current->height == 0 || current->height == 0xFF) LAZYBIOS_MARK_ABSENT(current, height);
-
-				READU8(current, number_of_power_cords, len, NUMBER_OF_POWER_CORDS, p);
-				if (current->number_of_power_cords == 0) LAZYBIOS_MARK_ABSENT(current, number_of_power_cords);
-
-				READU8(current, contained_element_count, len, CONTAINED_ELEMENT_COUNT, p);
-				READU8(current, contained_element_record_length, len, CONTAINED_ELEMENT_RECORD_LENGTH, p);
-
-				if (LAZYBIOS_FIELD_STATUS(current, contained_element_count) == LAZYBIOS_FIELD_PRESENT &&
-					LAZYBIOS_FIELD_STATUS(current, contained_element_record_length) == LAZYBIOS_FIELD_PRESENT) {
-					const size_t array_bytes = (size_t)current->contained_element_count *
-						current->contained_element_record_length;
-
-					const int contained_layout_valid =
-						(current->contained_element_count == 0 && current->contained_element_record_length == 0) ||
-						(current->contained_element_count > 0 && current->contained_element_record_length >= 3 &&
-						 (size_t)len >= CONTAINED_ELEMENTS + array_bytes);
-
-					if (current->contained_element_count == 0) {
-						LAZYBIOS_MARK_ABSENT(current, contained_elements);
-					} else if (contained_layout_valid) {
-						current->contained_elements = malloc(array_bytes);
-						if (current->contained_elements) {
-							memcpy(current->contained_elements, p + CONTAINED_ELEMENTS, array_bytes);
-							LAZYBIOS_MARK_PRESENT(current, contained_elements);
-						}
-					} else {
-						LAZYBIOS_MARK_ABSENT(current, contained_elements);
-					}
-
-					if (contained_layout_valid && lazybiosIsVersionPlus(DMIData, 2, 7)) {
-						READSTR(current, sku_number, len,
-							SKU_NUMBER(current->contained_element_count, current->contained_element_record_length), p, structure_end);
-					} else {
-						current->sku_number = NULL;
-						LAZYBIOS_MARK_UNREACHABLE(current, sku_number);
-					}
-
-					if (contained_layout_valid && lazybiosIsVersionPlus(DMIData, 3, 9)) {
-						READU8(current, rack_type, len,
-							RACK_TYPE(current->contained_element_count, current->contained_element_record_length), p);
-						READU8(current, rack_height, len,
-							RACK_HEIGHT(current->contained_element_count, current->contained_element_record_length), p);
-						if (current->rack_type == 0) {
-							LAZYBIOS_MARK_ABSENT(current, rack_type);
-							LAZYBIOS_MARK_ABSENT(current, rack_height);
-						}
-					} else {
-						current->rack_type = 0;
-						LAZYBIOS_MARK_UNREACHABLE(current, rack_type);
-						current->rack_height = 0;
-						LAZYBIOS_MARK_UNREACHABLE(current, rack_height);
-					}
-				}
+			if (contained_layout_valid && lazybiosIsVersionPlus(DMIData, 2, 7)) {
+				READSTR(current, sku_number, len, SKU_NUMBER(current->contained_element_count, current->contained_element_record_length), p, cursor);
 			} else {
-				current->oem_defined = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, oem_defined);
-				current->height = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, height);
-				current->number_of_power_cords = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, number_of_power_cords);
-				current->contained_element_count = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, contained_element_count);
-				current->contained_element_record_length = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, contained_element_record_length);
-				current->contained_elements = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, contained_elements);
 				current->sku_number = NULL;
 				LAZYBIOS_MARK_UNREACHABLE(current, sku_number);
+			}
+
+			if (contained_layout_valid && lazybiosIsVersionPlus(DMIData, 3, 9)) {
+				READU8(current, rack_type, len, RACK_TYPE(current->contained_element_count, current->contained_element_record_length), p);
+				READU8(current, rack_height, len, RACK_HEIGHT(current->contained_element_count, current->contained_element_record_length), p);
+				if (current->rack_type == 0) {
+					LAZYBIOS_MARK_ABSENT(current, rack_type);
+					LAZYBIOS_MARK_ABSENT(current, rack_height);
+				}
+			} else {
 				current->rack_type = 0;
 				LAZYBIOS_MARK_UNREACHABLE(current, rack_type);
 				current->rack_height = 0;
 				LAZYBIOS_MARK_UNREACHABLE(current, rack_height);
 			}
-
-			index++;
 		}
-		p = DMINext(p, end);
+	} else {
+		current->contained_elements = NULL;
+		LAZYBIOS_MARK_UNREACHABLE(current, contained_elements);
+		current->sku_number = NULL;
+		LAZYBIOS_MARK_UNREACHABLE(current, sku_number);
+		current->rack_type = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, rack_type);
+		current->rack_height = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, rack_height);
+	}
+
+	return 0;
+}
+
+lazybiosType3_t* lazybiosGetType3(lazybiosType3_t* Type3, size_t* type3_count, lazybiosDMI_t* DMIData) {
+	if (!DMIData || !DMIData->dmi_data) return NULL;
+
+	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_CHASSIS);
+	size_t index = 0;
+	Type3 = lazybiosCalloc(count, sizeof(lazybiosType3_t));
+	if (!Type3) return NULL;
+	if (count == 0) {
+		*type3_count = 0;
+		return Type3;
+	}
+
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_CHASSIS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType3(&Type3[index], &cursor);
+		index++;
 	}
 	*type3_count = index;
 	return Type3;
@@ -427,7 +402,7 @@ void lazybiosType3ContainedElementTypeStr(uint8_t contained_elements, char* buf,
 
 void lazybiosFreeType3(lazybiosType3_t* Type3, size_t type3_count) {
 	if (!Type3) return;
-	for (size_t i = 0; i < type3_count; i++) free(Type3[i].contained_elements);
+	for (size_t i = 0; i < type3_count; i++) lazybiosFree(Type3[i].contained_elements);
 
-    free(Type3);
+    lazybiosFree(Type3);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType30FieldStatus_t, lazybiosType30FieldIndex_t, 2);
+
 // Fields
 #define MANUFACTURER_NAME 0x04
 #define CONNECTIONS 0x05
@@ -32,38 +34,39 @@
 #define INBOUND_CONNECTION_ENABLED (1U << 0)
 #define OUTBOUND_CONNECTION_ENABLED (1U << 1)
 
+const lazybiosFieldDesc lazybiosType30Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType30_t, manufacturer_name, MANUFACTURER_NAME, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType30_t, connections, CONNECTIONS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType30(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType30_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType30Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType30_t* lazybiosGetType30(lazybiosType30_t* Type30, size_t* type30_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_OUT_OF_BAND_REMOTE_ACCESS);
 	size_t index = 0;
 
-	Type30 = calloc(count, sizeof(lazybiosType30_t));
+	Type30 = lazybiosCalloc(count, sizeof(lazybiosType30_t));
 	if (!Type30) return NULL;
 	if (count == 0) {
 		*type30_count = 0;
 		return Type30;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_OUT_OF_BAND_REMOTE_ACCESS) {
-			if (index >= count) break;
-			lazybiosType30_t* current = &Type30[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, manufacturer_name, len, MANUFACTURER_NAME, p, structure_end);
-			READU8(current, connections, len, CONNECTIONS, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_OUT_OF_BAND_REMOTE_ACCESS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType30(&Type30[index], &cursor);
+		index++;
 	}
 	*type30_count = index;
 	return Type30;
@@ -81,5 +84,5 @@ void lazybiosFreeType30(lazybiosType30_t* Type30, size_t type30_count) {
     (void)type30_count;
     if (!Type30) return;
 
-    free(Type30);
+    lazybiosFree(Type30);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType31FieldStatus_t, lazybiosType31FieldIndex_t, 8);
+
 // Fields
 #define CHECKSUM 0x04
 #define RESERVED_1 0x05
@@ -35,51 +37,55 @@
 
 #define TYPE31_MINIMUM_LENGTH 0x1C
 
+const lazybiosFieldDesc lazybiosType31Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType31_t, checksum, CHECKSUM, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType31_t, reserved_1, RESERVED_1, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType31_t, reserved_2, RESERVED_2, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType31_t, bis_entry_point_16, BIS_ENTRY_POINT_16, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType31_t, bis_entry_point_32, BIS_ENTRY_POINT_32, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType31_t, reserved_3, RESERVED_3, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType31_t, reserved_4, RESERVED_4, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType31(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType31_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType31Fields, cursor);
+
+	if (len >= TYPE31_MINIMUM_LENGTH) {
+		uint8_t sum = 0;
+		for (size_t i = 0; i < len; i++) {
+			sum = (uint8_t)(sum + p[i]);
+		}
+		current->checksum_valid = (uint8_t)(sum == 0);
+		LAZYBIOS_MARK_PRESENT(current, checksum_valid);
+	}
+
+	return 0;
+}
+
 lazybiosType31_t* lazybiosGetType31(lazybiosType31_t* Type31, size_t* type31_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_BOOT_INTEGRITY_SERVICES_ENTRY_POINT);
 	size_t index = 0;
 
-	Type31 = calloc(count, sizeof(lazybiosType31_t));
+	Type31 = lazybiosCalloc(count, sizeof(lazybiosType31_t));
 	if (!Type31) return NULL;
 	if (count == 0) {
 		*type31_count = 0;
 		return Type31;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_BOOT_INTEGRITY_SERVICES_ENTRY_POINT) {
-			if (index >= count) break;
-			lazybiosType31_t* current = &Type31[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, checksum, len, CHECKSUM, p);
-			READU8(current, reserved_1, len, RESERVED_1, p);
-			READU16(current, reserved_2, len, RESERVED_2, p);
-			READU32(current, bis_entry_point_16, len, BIS_ENTRY_POINT_16, p);
-			READU32(current, bis_entry_point_32, len, BIS_ENTRY_POINT_32, p);
-			READU64(current, reserved_3, len, RESERVED_3, p);
-			READU32(current, reserved_4, len, RESERVED_4, p);
-
-			if (len >= TYPE31_MINIMUM_LENGTH) {
-				uint8_t sum = 0;
-				for (size_t i = 0; i < len; i++) {
-					sum = (uint8_t)(sum + p[i]);
-				}
-				current->checksum_valid = (uint8_t)(sum == 0);
-				LAZYBIOS_MARK_PRESENT(current, checksum_valid);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_BOOT_INTEGRITY_SERVICES_ENTRY_POINT);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType31(&Type31[index], &cursor);
+		index++;
 	}
 	*type31_count = index;
 	return Type31;
@@ -89,5 +95,5 @@ void lazybiosFreeType31(lazybiosType31_t* Type31, size_t type31_count) {
     (void)type31_count;
     if (!Type31) return;
 
-    free(Type31);
+    lazybiosFree(Type31);
 }
@@ -25,6 +25,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType32FieldStatus_t, lazybiosType32FieldIndex_t, 3);
+
 // Fields
 #define RESERVED 0x04
 #define RESERVED_SIZE 6
@@ -42,56 +44,54 @@
 #define BOOT_STATUS_PREVIOUSLY_REQUESTED_IMAGE 0x07
 #define BOOT_STATUS_WATCHDOG_EXPIRED 0x08
 
+const lazybiosFieldDesc lazybiosType32Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType32_t, boot_status, BOOT_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType32(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType32_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType32Fields, cursor);
+
+	if ((size_t)len >= RESERVED + RESERVED_SIZE) {
+		memcpy(current->reserved, p + RESERVED, RESERVED_SIZE);
+		LAZYBIOS_MARK_PRESENT(current, reserved);
+	}
+
+	if (LAZYBIOS_FIELD_STATUS(current, boot_status) == LAZYBIOS_FIELD_PRESENT) {
+		current->additional_data.len = len - ADDITIONAL_DATA;
+		if (current->additional_data.len > 0) current->additional_data.ptr = p + ADDITIONAL_DATA;
+		LAZYBIOS_MARK_PRESENT(current, additional_data);
+	}
+
+	return 0;
+}
+
 lazybiosType32_t* lazybiosGetType32(lazybiosType32_t* Type32, size_t* type32_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION);
 	size_t index = 0;
 
-	Type32 = calloc(count, sizeof(lazybiosType32_t));
+	Type32 = lazybiosCalloc(count, sizeof(lazybiosType32_t));
 	if (!Type32) return NULL;
 	if (count == 0) {
 		*type32_count = 0;
 		return Type32;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType32_t* current = &Type32[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			if ((size_t)len >= RESERVED + RESERVED_SIZE) {
-				memcpy(current->reserved, p + RESERVED, RESERVED_SIZE);
-				LAZYBIOS_MARK_PRESENT(current, reserved);
-			}
-
-			READU8(current, boot_status, len, BOOT_STATUS, p);
-
-			if (LAZYBIOS_FIELD_STATUS(current, boot_status) == LAZYBIOS_FIELD_PRESENT) {
-				current->additional_data_size = len - ADDITIONAL_DATA;
-				LAZYBIOS_MARK_PRESENT(current, additional_data_size);
-
-				if (current->additional_data_size > 0) {
-					current->additional_data = malloc(current->additional_data_size);
-					if (!current->additional_data) {
-						lazybiosFreeType32(Type32, index + 1);
-						return NULL;
-					}
-					memcpy(current->additional_data, p + ADDITIONAL_DATA, current->additional_data_size);
-				}
-				LAZYBIOS_MARK_PRESENT(current, additional_data);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType32(&Type32[index], &cursor) != 0) {
+			lazybiosFreeType32(Type32, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type32_count = index;
 	return Type32;
@@ -127,9 +127,8 @@ const char* lazybiosType32BootStatusStr(uint8_t boot_status) {
 }
 
 void lazybiosFreeType32(lazybiosType32_t* Type32, size_t type32_count) {
+    (void)type32_count;
     if (!Type32) return;
 
-	for (size_t i = 0; i < type32_count; i++) free(Type32[i].additional_data);
-
-    free(Type32);
+    lazybiosFree(Type32);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType33FieldStatus_t, lazybiosType33FieldIndex_t, 7);
+
 // Fields
 #define ERROR_TYPE 0x04
 #define ERROR_GRANULARITY 0x05
@@ -62,42 +64,44 @@
 #define ERROR_OPERATION_WRITE 0x04
 #define ERROR_OPERATION_PARTIAL_WRITE 0x05
 
+const lazybiosFieldDesc lazybiosType33Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType33_t, error_type, ERROR_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType33_t, error_granularity, ERROR_GRANULARITY, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType33_t, error_operation, ERROR_OPERATION, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType33_t, vendor_syndrome, VENDOR_SYNDROME, 0, 0, 0),
+	LAZYBIOS_FIELD_U64(lazybiosType33_t, memory_array_error_address, MEMORY_ARRAY_ERROR_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U64(lazybiosType33_t, device_error_address, DEVICE_ERROR_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType33_t, error_resolution, ERROR_RESOLUTION, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType33(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType33_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType33Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType33_t* lazybiosGetType33(lazybiosType33_t* Type33, size_t* type33_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_64BIT_MEMORY_ERROR_INFORMATION);
 	size_t index = 0;
 
-	Type33 = calloc(count, sizeof(lazybiosType33_t));
+	Type33 = lazybiosCalloc(count, sizeof(lazybiosType33_t));
 	if (!Type33) return NULL;
 	if (count == 0) {
 		*type33_count = 0;
 		return Type33;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_64BIT_MEMORY_ERROR_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType33_t* current = &Type33[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, error_type, len, ERROR_TYPE, p);
-			READU8(current, error_granularity, len, ERROR_GRANULARITY, p);
-			READU8(current, error_operation, len, ERROR_OPERATION, p);
-			READU32(current, vendor_syndrome, len, VENDOR_SYNDROME, p);
-			READU64(current, memory_array_error_address, len, MEMORY_ARRAY_ERROR_ADDRESS, p);
-			READU64(current, device_error_address, len, DEVICE_ERROR_ADDRESS, p);
-			READU32(current, error_resolution, len, ERROR_RESOLUTION, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_64BIT_MEMORY_ERROR_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType33(&Type33[index], &cursor);
+		index++;
 	}
 	*type33_count = index;
 	return Type33;
@@ -174,5 +178,5 @@ void lazybiosFreeType33(lazybiosType33_t* Type33, size_t type33_count) {
     (void)type33_count;
     if (!Type33) return;
 
-    free(Type33);
+    lazybiosFree(Type33);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType34FieldStatus_t, lazybiosType34FieldIndex_t, 4);
+
 // Fields
 #define DESCRIPTION 0x04
 #define DEVICE_TYPE 0x05
@@ -52,40 +54,41 @@
 #define ADDRESS_TYPE_MEMORY 0x04
 #define ADDRESS_TYPE_SM_BUS 0x05
 
+const lazybiosFieldDesc lazybiosType34Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType34_t, description, DESCRIPTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType34_t, device_type, DEVICE_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType34_t, address, ADDRESS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType34_t, address_type, ADDRESS_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType34(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType34_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType34Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType34_t* lazybiosGetType34(lazybiosType34_t* Type34, size_t* type34_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MANAGEMENT_DEVICE);
 	size_t index = 0;
 
-	Type34 = calloc(count, sizeof(lazybiosType34_t));
+	Type34 = lazybiosCalloc(count, sizeof(lazybiosType34_t));
 	if (!Type34) return NULL;
 	if (count == 0) {
 		*type34_count = 0;
 		return Type34;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MANAGEMENT_DEVICE) {
-			if (index >= count) break;
-			lazybiosType34_t* current = &Type34[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			READU8(current, device_type, len, DEVICE_TYPE, p);
-			READU32(current, address, len, ADDRESS, p);
-			READU8(current, address_type, len, ADDRESS_TYPE, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MANAGEMENT_DEVICE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType34(&Type34[index], &cursor);
+		index++;
 	}
 	*type34_count = index;
 	return Type34;
@@ -145,5 +148,5 @@ void lazybiosFreeType34(lazybiosType34_t* Type34, size_t type34_count) {
     (void)type34_count;
     if (!Type34) return;
 
-    free(Type34);
+    lazybiosFree(Type34);
 }
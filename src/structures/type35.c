@@ -24,49 +24,53 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType35FieldStatus_t, lazybiosType35FieldIndex_t, 4);
+
 // Fields
 #define DESCRIPTION 0x04
 #define MANAGEMENT_DEVICE_HANDLE 0x05
 #define COMPONENT_HANDLE 0x07
 #define THRESHOLD_HANDLE 0x09
 
+const lazybiosFieldDesc lazybiosType35Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType35_t, description, DESCRIPTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType35_t, management_device_handle, MANAGEMENT_DEVICE_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType35_t, component_handle, COMPONENT_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType35_t, threshold_handle, THRESHOLD_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType35(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType35_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType35Fields, cursor);
+
+	if (current->management_device_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, management_device_handle);
+	if (current->component_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, component_handle);
+	if (current->threshold_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, threshold_handle);
+
+	return 0;
+}
+
 lazybiosType35_t* lazybiosGetType35(lazybiosType35_t* Type35, size_t* type35_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MANAGEMENT_DEVICE_COMPONENT);
 	size_t index = 0;
 
-	Type35 = calloc(count, sizeof(lazybiosType35_t));
+	Type35 = lazybiosCalloc(count, sizeof(lazybiosType35_t));
 	if (!Type35) return NULL;
 	if (count == 0) {
 		*type35_count = 0;
 		return Type35;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MANAGEMENT_DEVICE_COMPONENT) {
-			if (index >= count) break;
-			lazybiosType35_t* current = &Type35[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			READU16(current, management_device_handle, len, MANAGEMENT_DEVICE_HANDLE, p);
-			READU16(current, component_handle, len, COMPONENT_HANDLE, p);
-			READU16(current, threshold_handle, len, THRESHOLD_HANDLE, p);
-			if (current->management_device_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, management_device_handle);
-			if (current->component_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, component_handle);
-			if (current->threshold_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, threshold_handle);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MANAGEMENT_DEVICE_COMPONENT);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType35(&Type35[index], &cursor);
+		index++;
 	}
 	*type35_count = index;
 	return Type35;
@@ -76,5 +80,5 @@ void lazybiosFreeType35(lazybiosType35_t* Type35, size_t type35_count) {
     (void)type35_count;
     if (!Type35) return;
 
-    free(Type35);
+    lazybiosFree(Type35);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType36FieldStatus_t, lazybiosType36FieldIndex_t, 6);
+
 // Fields
 #define LOWER_THRESHOLD_NON_CRITICAL 0x04
 #define UPPER_THRESHOLD_NON_CRITICAL 0x06
@@ -32,48 +34,50 @@
 #define LOWER_THRESHOLD_NON_RECOVERABLE 0x0C
 #define UPPER_THRESHOLD_NON_RECOVERABLE 0x0E
 
+const lazybiosFieldDesc lazybiosType36Fields[] = {
+	LAZYBIOS_FIELD_U16(lazybiosType36_t, lower_threshold_non_critical, LOWER_THRESHOLD_NON_CRITICAL, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType36_t, upper_threshold_non_critical, UPPER_THRESHOLD_NON_CRITICAL, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType36_t, lower_threshold_critical, LOWER_THRESHOLD_CRITICAL, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType36_t, upper_threshold_critical, UPPER_THRESHOLD_CRITICAL, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType36_t, lower_threshold_non_recoverable, LOWER_THRESHOLD_NON_RECOVERABLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType36_t, upper_threshold_non_recoverable, UPPER_THRESHOLD_NON_RECOVERABLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType36(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType36_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType36Fields, cursor);
+
+	if (current->lower_threshold_non_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, lower_threshold_non_critical);
+	if (current->upper_threshold_non_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, upper_threshold_non_critical);
+	if (current->lower_threshold_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, lower_threshold_critical);
+	if (current->upper_threshold_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, upper_threshold_critical);
+	if (current->lower_threshold_non_recoverable == 0x8000) LAZYBIOS_MARK_ABSENT(current, lower_threshold_non_recoverable);
+	if (current->upper_threshold_non_recoverable == 0x8000) LAZYBIOS_MARK_ABSENT(current, upper_threshold_non_recoverable);
+
+	return 0;
+}
+
 lazybiosType36_t* lazybiosGetType36(lazybiosType36_t* Type36, size_t* type36_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MANAGEMENT_DEVICE_THRESHOLD_DATA);
 	size_t index = 0;
 
-	Type36 = calloc(count, sizeof(lazybiosType36_t));
+	Type36 = lazybiosCalloc(count, sizeof(lazybiosType36_t));
 	if (!Type36) return NULL;
 	if (count == 0) {
 		*type36_count = 0;
 		return Type36;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MANAGEMENT_DEVICE_THRESHOLD_DATA) {
-			if (index >= count) break;
-			lazybiosType36_t* current = &Type36[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU16(current, lower_threshold_non_critical, len, LOWER_THRESHOLD_NON_CRITICAL, p);
-			READU16(current, upper_threshold_non_critical, len, UPPER_THRESHOLD_NON_CRITICAL, p);
-			READU16(current, lower_threshold_critical, len, LOWER_THRESHOLD_CRITICAL, p);
-			READU16(current, upper_threshold_critical, len, UPPER_THRESHOLD_CRITICAL, p);
-			READU16(current, lower_threshold_non_recoverable, len, LOWER_THRESHOLD_NON_RECOVERABLE, p);
-			READU16(current, upper_threshold_non_recoverable, len, UPPER_THRESHOLD_NON_RECOVERABLE, p);
-
-			if (current->lower_threshold_non_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, lower_threshold_non_critical);
-			if (current->upper_threshold_non_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, upper_threshold_non_critical);
-			if (current->lower_threshold_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, lower_threshold_critical);
-			if (current->upper_threshold_critical == 0x8000) LAZYBIOS_MARK_ABSENT(current, upper_threshold_critical);
-			if (current->lower_threshold_non_recoverable == 0x8000) LAZYBIOS_MARK_ABSENT(current, lower_threshold_non_recoverable);
-			if (current->upper_threshold_non_recoverable == 0x8000) LAZYBIOS_MARK_ABSENT(current, upper_threshold_non_recoverable);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MANAGEMENT_DEVICE_THRESHOLD_DATA);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType36(&Type36[index], &cursor);
+		index++;
 	}
 	*type36_count = index;
 	return Type36;
@@ -83,5 +87,5 @@ void lazybiosFreeType36(lazybiosType36_t* Type36, size_t type36_count) {
     (void)type36_count;
     if (!Type36) return;
 
-    free(Type36);
+    lazybiosFree(Type36);
 }
@@ -25,6 +25,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType37MemoryDeviceFieldStatus_t, lazybiosType37MemoryDeviceFieldIndex_t, 2);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType37FieldStatus_t, lazybiosType37FieldIndex_t, 4);
+
 // Fields
 #define CHANNEL_TYPE 0x04
 #define MAXIMUM_CHANNEL_LOAD 0x05
@@ -38,63 +41,69 @@
 #define CHANNEL_TYPE_RAMBUS 0x03
 #define CHANNEL_TYPE_SYNCLINK 0x04
 
+const lazybiosFieldDesc lazybiosType37Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType37_t, channel_type, CHANNEL_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType37_t, maximum_channel_load, MAXIMUM_CHANNEL_LOAD, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType37_t, memory_device_count, MEMORY_DEVICE_COUNT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType37(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType37_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType37Fields, cursor);
+
+	if (LAZYBIOS_FIELD_STATUS(current, memory_device_count) == LAZYBIOS_FIELD_PRESENT) {
+		size_t memory_devices_length = (size_t)current->memory_device_count * MEMORY_DEVICE_ENTRY_LENGTH;
+		if ((size_t)len >= MEMORY_DEVICES + memory_devices_length) {
+			if (current->memory_device_count > 0) {
+				current->memory_devices = lazybiosStructCursorAlloc(cursor, current->memory_device_count, sizeof(lazybiosType37MemoryDevice_t));
+				if (!current->memory_devices) {
+					return -1;
+				}
+
+				for (size_t i = 0; i < current->memory_device_count; i++) {
+					const uint8_t* entry = p + MEMORY_DEVICES + (i * MEMORY_DEVICE_ENTRY_LENGTH);
+					current->memory_devices[i].load = entry[0];
+					memcpy(&current->memory_devices[i].handle, entry + 1, sizeof(uint16_t));
+					LAZYBIOS_MARK_PRESENT(&current->memory_devices[i], load);
+					LAZYBIOS_MARK_PRESENT(&current->memory_devices[i], handle);
+					if (current->memory_devices[i].handle == 0xFFFF) {
+						LAZYBIOS_MARK_ABSENT(&current->memory_devices[i], handle);
+					}
+				}
+			}
+			LAZYBIOS_MARK_PRESENT(current, memory_devices);
+		}
+	}
+
+	return 0;
+}
+
 lazybiosType37_t* lazybiosGetType37(lazybiosType37_t* Type37, size_t* type37_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MEMORY_CHANNEL);
 	size_t index = 0;
 
-	Type37 = calloc(count, sizeof(lazybiosType37_t));
+	Type37 = lazybiosCalloc(count, sizeof(lazybiosType37_t));
 	if (!Type37) return NULL;
 	if (count == 0) {
 		*type37_count = 0;
 		return Type37;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MEMORY_CHANNEL) {
-			if (index >= count) break;
-			lazybiosType37_t* current = &Type37[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, channel_type, len, CHANNEL_TYPE, p);
-			READU8(current, maximum_channel_load, len, MAXIMUM_CHANNEL_LOAD, p);
-			READU8(current, memory_device_count, len, MEMORY_DEVICE_COUNT, p);
-
-			if (current->field_status.memory_device_count == LAZYBIOS_FIELD_PRESENT) {
-				size_t memory_devices_length = (size_t)current->memory_device_count * MEMORY_DEVICE_ENTRY_LENGTH;
-				if ((size_t)len >= MEMORY_DEVICES + memory_devices_length) {
-					if (current->memory_device_count > 0) {
-						current->memory_devices = calloc(current->memory_device_count, sizeof(lazybiosType37MemoryDevice_t));
-						if (!current->memory_devices) {
-							lazybiosFreeType37(Type37, index + 1);
-							return NULL;
-						}
-
-						for (size_t i = 0; i < current->memory_device_count; i++) {
-							const uint8_t* entry = p + MEMORY_DEVICES + (i * MEMORY_DEVICE_ENTRY_LENGTH);
-							current->memory_devices[i].load = entry[0];
-							memcpy(&current->memory_devices[i].handle, entry + 1, sizeof(uint16_t));
-							current->memory_devices[i].field_status.load = LAZYBIOS_FIELD_PRESENT;
-							current->memory_devices[i].field_status.handle = LAZYBIOS_FIELD_PRESENT;
-							if (current->memory_devices[i].handle == 0xFFFF) {
-								current->memory_devices[i].field_status.handle = LAZYBIOS_FIELD_ABSENT;
-							}
-						}
-					}
-					current->field_status.memory_devices = LAZYBIOS_FIELD_PRESENT;
-				}
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MEMORY_CHANNEL);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType37(&Type37[index], &cursor) != 0) {
+			lazybiosFreeType37(Type37, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type37_count = index;
 	return Type37;
@@ -118,7 +127,7 @@ const char* lazybiosType37ChannelTypeStr(uint8_t channel_type) {
 void lazybiosFreeType37(lazybiosType37_t* Type37, size_t type37_count) {
     if (!Type37) return;
 
-    for (size_t i = 0; i < type37_count; i++) free(Type37[i].memory_devices);
+    for (size_t i = 0; i < type37_count; i++) lazybiosFree(Type37[i].memory_devices);
 
-    free(Type37);
+    lazybiosFree(Type37);
 }
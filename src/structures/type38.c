@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType38FieldStatus_t, lazybiosType38FieldIndex_t, 7);
+
 // Fields
 #define INTERFACE_TYPE 0x04
 #define IPMI_SPECIFICATION_REVISION 0x05
@@ -41,45 +43,48 @@
 #define INTERFACE_TYPE_BT 0x03
 #define INTERFACE_TYPE_SSIF 0x04
 
+const lazybiosFieldDesc lazybiosType38Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType38_t, interface_type, INTERFACE_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType38_t, ipmi_specification_revision, IPMI_SPECIFICATION_REVISION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType38_t, i2c_target_address, I2C_TARGET_ADDRESS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType38_t, nv_storage_device_address, NV_STORAGE_DEVICE_ADDRESS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType38_t, base_address, BASE_ADDRESS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType38_t, base_address_modifier_interrupt_info, BASE_ADDRESS_MODIFIER_INTERRUPT_INFO, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType38_t, interrupt_number, INTERRUPT_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType38(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType38_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType38Fields, cursor);
+
+	if (current->nv_storage_device_address == 0xFF) {
+		LAZYBIOS_MARK_ABSENT(current, nv_storage_device_address);
+	}
+
+	return 0;
+}
+
 lazybiosType38_t* lazybiosGetType38(lazybiosType38_t* Type38, size_t* type38_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_IPMI_DEVICE_INFORMATION);
 	size_t index = 0;
 
-	Type38 = calloc(count, sizeof(lazybiosType38_t));
+	Type38 = lazybiosCalloc(count, sizeof(lazybiosType38_t));
 	if (!Type38) return NULL;
 	if (count == 0) {
 		*type38_count = 0;
 		return Type38;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_IPMI_DEVICE_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType38_t* current = &Type38[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, interface_type, len, INTERFACE_TYPE, p);
-			READU8(current, ipmi_specification_revision, len, IPMI_SPECIFICATION_REVISION, p);
-			READU8(current, i2c_target_address, len, I2C_TARGET_ADDRESS, p);
-			READU8(current, nv_storage_device_address, len, NV_STORAGE_DEVICE_ADDRESS, p);
-			if (current->nv_storage_device_address == 0xFF) {
-				LAZYBIOS_MARK_ABSENT(current, nv_storage_device_address);
-			}
-			READU64(current, base_address, len, BASE_ADDRESS, p);
-			READU8(current, base_address_modifier_interrupt_info, len, BASE_ADDRESS_MODIFIER_INTERRUPT_INFO, p);
-			READU8(current, interrupt_number, len, INTERRUPT_NUMBER, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_IPMI_DEVICE_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType38(&Type38[index], &cursor);
+		index++;
 	}
 	*type38_count = index;
 	return Type38;
@@ -152,5 +157,5 @@ void lazybiosFreeType38(lazybiosType38_t* Type38, size_t type38_count) {
     (void)type38_count;
     if (!Type38) return;
 
-    free(Type38);
+    lazybiosFree(Type38);
 }
@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType39FieldStatus_t, lazybiosType39FieldIndex_t, 13);
+
 // Fields
 #define POWER_UNIT_GROUP 0x04
 #define LOCATION 0x05
@@ -76,52 +78,54 @@
 #define INPUT_VOLTAGE_RANGE_SWITCHING_WIDE_RANGE 0x05
 #define INPUT_VOLTAGE_RANGE_SWITCHING_NOT_APPLICABLE 0x06
 
+const lazybiosFieldDesc lazybiosType39Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType39_t, power_unit_group, POWER_UNIT_GROUP, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, location, LOCATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, device_name, DEVICE_NAME, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, manufacturer, MANUFACTURER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, serial_number, SERIAL_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, asset_tag_number, ASSET_TAG_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, model_part_number, MODEL_PART_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType39_t, revision_level, REVISION_LEVEL, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType39_t, max_power_capacity, MAX_POWER_CAPACITY, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType39_t, power_supply_characteristics, POWER_SUPPLY_CHARACTERISTICS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType39_t, input_voltage_probe_handle, INPUT_VOLTAGE_PROBE_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType39_t, cooling_device_handle, COOLING_DEVICE_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType39_t, input_current_probe_handle, INPUT_CURRENT_PROBE_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType39(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType39_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType39Fields, cursor);
+
+	if (current->input_voltage_probe_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, input_voltage_probe_handle);
+	if (current->cooling_device_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, cooling_device_handle);
+	if (current->input_current_probe_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, input_current_probe_handle);
+
+	return 0;
+}
+
 lazybiosType39_t* lazybiosGetType39(lazybiosType39_t* Type39, size_t* type39_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_POWER_SUPPLY);
 	size_t index = 0;
 
-	Type39 = calloc(count, sizeof(lazybiosType39_t));
+	Type39 = lazybiosCalloc(count, sizeof(lazybiosType39_t));
 	if (!Type39) return NULL;
 	if (count == 0) {
 		*type39_count = 0;
 		return Type39;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_POWER_SUPPLY) {
-			if (index >= count) break;
-			lazybiosType39_t* current = &Type39[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READU8(current, power_unit_group, len, POWER_UNIT_GROUP, p);
-			READSTR(current, location, len, LOCATION, p, structure_end);
-			READSTR(current, device_name, len, DEVICE_NAME, p, structure_end);
-			READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-			READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-			READSTR(current, asset_tag_number, len, ASSET_TAG_NUMBER, p, structure_end);
-			READSTR(current, model_part_number, len, MODEL_PART_NUMBER, p, structure_end);
-			READSTR(current, revision_level, len, REVISION_LEVEL, p, structure_end);
-			READU16(current, max_power_capacity, len, MAX_POWER_CAPACITY, p);
-			READU16(current, power_supply_characteristics, len, POWER_SUPPLY_CHARACTERISTICS, p);
-			READU16(current, input_voltage_probe_handle, len, INPUT_VOLTAGE_PROBE_HANDLE, p);
-			READU16(current, cooling_device_handle, len, COOLING_DEVICE_HANDLE, p);
-			READU16(current, input_current_probe_handle, len, INPUT_CURRENT_PROBE_HANDLE, p);
-			if (current->input_voltage_probe_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, input_voltage_probe_handle);
-			if (current->cooling_device_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, cooling_device_handle);
-			if (current->input_current_probe_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, input_current_probe_handle);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_POWER_SUPPLY);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType39(&Type39[index], &cursor);
+		index++;
 	}
 	*type39_count = index;
 	return Type39;
@@ -199,5 +203,5 @@ void lazybiosFreeType39(lazybiosType39_t* Type39, size_t type39_count) {
     (void)type39_count;
     if (!Type39) return;
 
-    free(Type39);
+    lazybiosFree(Type39);
 }
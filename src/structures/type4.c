@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType4FieldStatus_t, lazybiosType4FieldIndex_t, 28);
+
 // Fields
 #define SOCKET_DESIGNATION 0x04
 #define PROCESSOR_TYPE 0x05
@@ -401,143 +403,71 @@
 #define PROC_TYPE_VIDEO_PROCESSOR 0x06
 
 
+const lazybiosFieldDesc lazybiosType4Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, socket_designation, SOCKET_DESIGNATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, processor_type, PROCESSOR_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, processor_family, PROCESSOR_FAMILY, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, processor_manufacturer, PROCESSOR_MANUFACTURER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType4_t, processor_id, PROCESSOR_ID, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, processor_version, PROCESSOR_VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, voltage, VOLTAGE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, external_clock, EXTERNAL_CLOCK, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, max_speed, MAX_SPEED, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, current_speed, CURRENT_SPEED, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, status, STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, processor_upgrade, PROCESSOR_UPGRADE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, l1_cache_handle, L1_CACHE_HANDLE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, l2_cache_handle, L2_CACHE_HANDLE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, l3_cache_handle, L3_CACHE_HANDLE, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, serial_number, SERIAL_NUMBER, 2, 3, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, asset_tag, ASSET_TAG, 2, 3, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, part_number, PART_NUMBER, 2, 3, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, core_count, CORE_COUNT, 2, 5, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, core_enabled, CORE_ENABLED, 2, 5, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType4_t, thread_count, THREAD_COUNT, 2, 5, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, processor_characteristics, PROCESSOR_CHARACTERISTICS, 2, 5, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, processor_family_2, PROCESSOR_FAMILY_2, 2, 6, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, core_count_2, CORE_COUNT_2, 3, 0, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, core_enabled_2, CORE_ENABLED_2, 3, 0, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, thread_count_2, THREAD_COUNT_2, 3, 0, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType4_t, thread_enabled, THREAD_ENABLED, 3, 6, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType4_t, socket_type, SOCKET_TYPE, 3, 8, LAZYBIOS_FIELD_GATED | LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType4(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType4_t* current = record;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType4Fields, cursor);
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
+		if (current->l1_cache_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, l1_cache_handle);
+		if (current->l2_cache_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, l2_cache_handle);
+		if (current->l3_cache_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, l3_cache_handle);
+	}
+
+	return 0;
+}
+
 lazybiosType4_t* lazybiosGetType4(lazybiosType4_t* Type4, size_t* type4_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_PROCESSOR);
 	size_t index = 0;
-	Type4 = calloc(count, sizeof(lazybiosType4_t));
+	Type4 = lazybiosCalloc(count, sizeof(lazybiosType4_t));
 	if (!Type4) return NULL;
 	if (count == 0) {
 		*type4_count = 0;
 		return Type4;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_PROCESSOR) {
-			if (index >= count) break;
-
-			lazybiosType4_t* current = &Type4[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, socket_designation, len, SOCKET_DESIGNATION, p, structure_end);
-
-			READU8(current, processor_type, len, PROCESSOR_TYPE, p);
-			READU8(current, processor_family, len, PROCESSOR_FAMILY, p);
-
-			READSTR(current, processor_manufacturer, len, PROCESSOR_MANUFACTURER, p, structure_end);
-
-			READU64(current, processor_id, len, PROCESSOR_ID, p);
-
-			READSTR(current, processor_version, len, PROCESSOR_VERSION, p, structure_end);
-
-			READU8(current, voltage, len, VOLTAGE, p);
-
-			READU16(current, external_clock, len, EXTERNAL_CLOCK, p);
-
-			READU16(current, max_speed, len, MAX_SPEED, p);
-
-			READU16(current, current_speed, len, CURRENT_SPEED, p);
-
-			READU8(current, status, len, STATUS, p);
-			READU8(current, processor_upgrade, len, PROCESSOR_UPGRADE, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU16(current, l1_cache_handle, len, L1_CACHE_HANDLE, p);
-
-				READU16(current, l2_cache_handle, len, L2_CACHE_HANDLE, p);
-
-				READU16(current, l3_cache_handle, len, L3_CACHE_HANDLE, p);
-				if (current->l1_cache_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, l1_cache_handle);
-				if (current->l2_cache_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, l2_cache_handle);
-				if (current->l3_cache_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, l3_cache_handle);
-			} else {
-				current->l1_cache_handle = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, l1_cache_handle);
-				current->l2_cache_handle = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, l2_cache_handle);
-				current->l3_cache_handle = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, l3_cache_handle);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 3)) {
-				READSTR(current, serial_number, len, SERIAL_NUMBER, p, structure_end);
-
-				READSTR(current, asset_tag, len, ASSET_TAG, p, structure_end);
-
-				READSTR(current, part_number, len, PART_NUMBER, p, structure_end);
-			} else {
-				current->serial_number = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, serial_number);
-				current->asset_tag = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, asset_tag);
-				current->part_number = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, part_number);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 5)) {
-				READU8(current, core_count, len, CORE_COUNT, p);
-				READU8(current, core_enabled, len, CORE_ENABLED, p);
-				READU8(current, thread_count, len, THREAD_COUNT, p);
-
-				READU16(current, processor_characteristics, len, PROCESSOR_CHARACTERISTICS, p);
-			} else {
-				current->core_count = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, core_count);
-				current->core_enabled = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, core_enabled);
-				current->thread_count = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, thread_count);
-				current->processor_characteristics = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, processor_characteristics);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 6)) {
-				READU16(current, processor_family_2, len, PROCESSOR_FAMILY_2, p);
-			} else {
-				current->processor_family_2 = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, processor_family_2);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 0)) {
-				READU16(current, core_count_2, len, CORE_COUNT_2, p);
-
-				READU16(current, core_enabled_2, len, CORE_ENABLED_2, p);
-
-				READU16(current, thread_count_2, len, THREAD_COUNT_2, p);
-			} else {
-				current->core_count_2 = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, core_count_2);
-				current->core_enabled_2 = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, core_enabled_2);
-				current->thread_count_2 = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, thread_count_2);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 6)) {
-				READU16(current, thread_enabled, len, THREAD_ENABLED, p);
-			} else {
-				current->thread_enabled = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, thread_enabled);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 8)) {
-				READSTR(current, socket_type, len, SOCKET_TYPE, p, structure_end);
-			} else {
-				current->socket_type = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, socket_type);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_PROCESSOR);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType4(&Type4[index], &cursor);
+		index++;
 	}
 	*type4_count = index;
 	return Type4;
@@ -1340,5 +1270,5 @@ void lazybiosFreeType4(lazybiosType4_t* Type4, size_t type4_count) {
     (void)type4_count;
     if (!Type4) return;
 
-    free(Type4);
+    lazybiosFree(Type4);
 }
@@ -25,6 +25,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType40EntryFieldStatus_t, lazybiosType40EntryFieldIndex_t, 5);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType40FieldStatus_t, lazybiosType40FieldIndex_t, 2);
+
 // Fields
 #define ADDITIONAL_INFORMATION_ENTRY_COUNT 0x04
 #define ADDITIONAL_INFORMATION_ENTRIES 0x05
@@ -37,104 +40,102 @@
 #define ENTRY_VALUE 0x05
 #define MINIMUM_ENTRY_LENGTH 0x06
 
-lazybiosType40_t* lazybiosGetType40(lazybiosType40_t* Type40, size_t* type40_count, lazybiosDMI_t* DMIData) {
-	if (!DMIData || !DMIData->dmi_data) return NULL;
+const lazybiosFieldDesc lazybiosType40Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType40_t, additional_information_entry_count, ADDITIONAL_INFORMATION_ENTRY_COUNT, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
+int lazybiosDecodeType40(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType40_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
 
-	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_ADDITIONAL_INFORMATION);
-	size_t index = 0;
+	lazybiosDecodeFields(current, lazybiosType40Fields, cursor);
 
-	Type40 = calloc(count, sizeof(lazybiosType40_t));
-	if (!Type40) return NULL;
-	if (count == 0) {
-		*type40_count = 0;
-		return Type40;
-	}
+	if (LAZYBIOS_FIELD_STATUS(current, additional_information_entry_count) == LAZYBIOS_FIELD_PRESENT) {
+		size_t entry_offset = ADDITIONAL_INFORMATION_ENTRIES;
+		int entries_valid = 1;
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_ADDITIONAL_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType40_t* current = &Type40[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
+		for (size_t i = 0; i < current->additional_information_entry_count; i++) {
+			if (entry_offset >= len) {
+				entries_valid = 0;
+				break;
+			}
 
-			READU8(current, additional_information_entry_count, len, ADDITIONAL_INFORMATION_ENTRY_COUNT, p);
+			uint8_t entry_length = p[entry_offset + ENTRY_LENGTH];
+			if (entry_length < MINIMUM_ENTRY_LENGTH || (size_t)entry_length > (size_t)len - entry_offset) {
+				entries_valid = 0;
+				break;
+			}
+			entry_offset += entry_length;
+		}
 
-			if (current->field_status.additional_information_entry_count == LAZYBIOS_FIELD_PRESENT) {
-				size_t entry_offset = ADDITIONAL_INFORMATION_ENTRIES;
-				int entries_valid = 1;
+		if (entries_valid) {
+			if (current->additional_information_entry_count > 0) {
+				current->additional_information_entries = lazybiosStructCursorAlloc(cursor,
+					current->additional_information_entry_count, sizeof(lazybiosType40Entry_t));
+				if (!current->additional_information_entries) {
+					return -1;
+				}
 
+				entry_offset = ADDITIONAL_INFORMATION_ENTRIES;
 				for (size_t i = 0; i < current->additional_information_entry_count; i++) {
-					if (entry_offset >= len) {
-						entries_valid = 0;
-						break;
+					lazybiosType40Entry_t* entry = &current->additional_information_entries[i];
+					entry->entry_length = p[entry_offset + ENTRY_LENGTH];
+					memcpy(&entry->referenced_handle, p + entry_offset + ENTRY_REFERENCED_HANDLE,
+						   sizeof(uint16_t));
+					entry->referenced_offset = p[entry_offset + ENTRY_REFERENCED_OFFSET];
+					uint8_t string_number = p[entry_offset + ENTRY_STRING];
+					entry->string = lazybiosStructCursorString(cursor, string_number);
+					entry->value.len = entry->entry_length - ENTRY_VALUE;
+					if (entry->value.len > 0) entry->value.ptr = p + entry_offset + ENTRY_VALUE;
+
+					LAZYBIOS_MARK_PRESENT(entry, entry_length);
+					LAZYBIOS_MARK_PRESENT(entry, referenced_handle);
+					if (entry->referenced_handle == 0xFFFF) {
+						LAZYBIOS_MARK_ABSENT(entry, referenced_handle);
 					}
-
-					uint8_t entry_length = p[entry_offset + ENTRY_LENGTH];
-					if (entry_length < MINIMUM_ENTRY_LENGTH || (size_t)entry_length > (size_t)len - entry_offset) {
-						entries_valid = 0;
-						break;
-					}
-					entry_offset += entry_length;
-				}
-
-				if (entries_valid) {
-					if (current->additional_information_entry_count > 0) {
-						current->additional_information_entries = calloc(
-							current->additional_information_entry_count, sizeof(lazybiosType40Entry_t));
-						if (!current->additional_information_entries) {
-							lazybiosFreeType40(Type40, index + 1);
-							return NULL;
-						}
-
-						entry_offset = ADDITIONAL_INFORMATION_ENTRIES;
-						for (size_t i = 0; i < current->additional_information_entry_count; i++) {
-							lazybiosType40Entry_t* entry = &current->additional_information_entries[i];
-							entry->entry_length = p[entry_offset + ENTRY_LENGTH];
-							memcpy(&entry->referenced_handle, p + entry_offset + ENTRY_REFERENCED_HANDLE,
-								   sizeof(uint16_t));
-							entry->referenced_offset = p[entry_offset + ENTRY_REFERENCED_OFFSET];
-							uint8_t string_number = p[entry_offset + ENTRY_STRING];
-							entry->string = DMIString(p, len, string_number, structure_end);
-							entry->value_length = entry->entry_length - ENTRY_VALUE;
-							if (entry->value_length > 0) {
-								entry->value = malloc(entry->value_length);
-								if (!entry->value) {
-									lazybiosFreeType40(Type40, index + 1);
-									return NULL;
-								}
-								memcpy(entry->value, p + entry_offset + ENTRY_VALUE, entry->value_length);
-							}
-
-							LAZYBIOS_MARK_PRESENT(entry, entry_length);
-							LAZYBIOS_MARK_PRESENT(entry, referenced_handle);
-							if (entry->referenced_handle == 0xFFFF) {
-								LAZYBIOS_MARK_ABSENT(entry, referenced_handle);
-							}
-							LAZYBIOS_MARK_PRESENT(entry, referenced_offset);
-							if (entry->string) {
-								LAZYBIOS_MARK_PRESENT(entry, string);
-							} else {
-								LAZYBIOS_MARK_ABSENT(entry, string);
-							}
-							LAZYBIOS_MARK_PRESENT(entry, value);
-							entry_offset += entry->entry_length;
-						}
+					LAZYBIOS_MARK_PRESENT(entry, referenced_offset);
+					if (entry->string) {
+						LAZYBIOS_MARK_PRESENT(entry, string);
+					} else {
+						LAZYBIOS_MARK_ABSENT(entry, string);
 					}
-					LAZYBIOS_MARK_PRESENT(current, additional_information_entries);
-				} else {
-					LAZYBIOS_MARK_ABSENT(current, additional_information_entries);
+					LAZYBIOS_MARK_PRESENT(entry, value);
+					entry_offset += entry->entry_length;
 				}
 			}
+			LAZYBIOS_MARK_PRESENT(current, additional_information_entries);
+		} else {
+			LAZYBIOS_MARK_ABSENT(current, additional_information_entries);
+		}
+	}
+
+	return 0;
+}
+
+lazybiosType40_t* lazybiosGetType40(lazybiosType40_t* Type40, size_t* type40_count, lazybiosDMI_t* DMIData) {
+	if (!DMIData || !DMIData->dmi_data) return NULL;
+
+	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_ADDITIONAL_INFORMATION);
+	size_t index = 0;
 
-			index++;
+	Type40 = lazybiosCalloc(count, sizeof(lazybiosType40_t));
+	if (!Type40) return NULL;
+	if (count == 0) {
+		*type40_count = 0;
+		return Type40;
+	}
+
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_ADDITIONAL_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType40(&Type40[index], &cursor) != 0) {
+			lazybiosFreeType40(Type40, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type40_count = index;
 	return Type40;
@@ -143,13 +144,6 @@ lazybiosType40_t* lazybiosGetType40(lazybiosType40_t* Type40, size_t* type40_cou
 void lazybiosFreeType40(lazybiosType40_t* Type40, size_t type40_count) {
 	if (!Type40) return;
 
-	for (size_t i = 0; i < type40_count; i++) {
-		if (Type40[i].additional_information_entries) {
-			for (size_t j = 0; j < Type40[i].additional_information_entry_count; j++) {
-				free(Type40[i].additional_information_entries[j].value);
-			}
-		}
-		free(Type40[i].additional_information_entries);
-	}
-	free(Type40);
+	for (size_t i = 0; i < type40_count; i++) lazybiosFree(Type40[i].additional_information_entries);
+	lazybiosFree(Type40);
 }
@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType41FieldStatus_t, lazybiosType41FieldIndex_t, 6);
+
 // Fields
 #define REFERENCE_DESIGNATION 0x04
 #define DEVICE_TYPE_AND_STATUS 0x05
@@ -55,42 +57,43 @@
 #define DEVICE_TYPE_NVME_CONTROLLER 0x0F
 #define DEVICE_TYPE_UFS_CONTROLLER 0x10
 
+const lazybiosFieldDesc lazybiosType41Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType41_t, reference_designation, REFERENCE_DESIGNATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType41_t, device_type_and_status, DEVICE_TYPE_AND_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType41_t, device_type_instance, DEVICE_TYPE_INSTANCE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType41_t, segment_group_number, SEGMENT_GROUP_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType41_t, bus_number, BUS_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType41_t, device_function_number, DEVICE_FUNCTION_NUMBER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType41(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType41_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType41Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType41_t* lazybiosGetType41(lazybiosType41_t* Type41, size_t* type41_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_ONBOARD_DEVICES_EXTENDED_INFORMATION);
 	size_t index = 0;
 
-	Type41 = calloc(count, sizeof(lazybiosType41_t));
+	Type41 = lazybiosCalloc(count, sizeof(lazybiosType41_t));
 	if (!Type41) return NULL;
 	if (count == 0) {
 		*type41_count = 0;
 		return Type41;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_ONBOARD_DEVICES_EXTENDED_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType41_t* current = &Type41[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, reference_designation, len, REFERENCE_DESIGNATION, p, structure_end);
-			READU8(current, device_type_and_status, len, DEVICE_TYPE_AND_STATUS, p);
-			READU8(current, device_type_instance, len, DEVICE_TYPE_INSTANCE, p);
-			READU16(current, segment_group_number, len, SEGMENT_GROUP_NUMBER, p);
-			READU8(current, bus_number, len, BUS_NUMBER, p);
-			READU8(current, device_function_number, len, DEVICE_FUNCTION_NUMBER, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_ONBOARD_DEVICES_EXTENDED_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType41(&Type41[index], &cursor);
+		index++;
 	}
 	*type41_count = index;
 	return Type41;
@@ -156,5 +159,5 @@ void lazybiosFreeType41(lazybiosType41_t* Type41, size_t type41_count) {
     (void)type41_count;
     if (!Type41) return;
 
-    free(Type41);
+    lazybiosFree(Type41);
 }
@@ -25,6 +25,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType42ProtocolRecordFieldStatus_t, lazybiosType42ProtocolRecordFieldIndex_t, 3);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType42FieldStatus_t, lazybiosType42FieldIndex_t, 5);
+
 // Fields
 #define INTERFACE_TYPE 0x04
 #define INTERFACE_TYPE_SPECIFIC_DATA_LENGTH 0x05
@@ -45,132 +48,118 @@
 #define PROTOCOL_TYPE_REDFISH_OVER_IP 0x04
 #define PROTOCOL_TYPE_OEM 0xF0
 
-lazybiosType42_t* lazybiosGetType42(lazybiosType42_t* Type42, size_t* type42_count, lazybiosDMI_t* DMIData) {
-	if (!DMIData || !DMIData->dmi_data) return NULL;
+const lazybiosFieldDesc lazybiosType42Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType42_t, interface_type, INTERFACE_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
+int lazybiosDecodeType42(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType42_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
 
-	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE);
-	size_t index = 0;
+	lazybiosDecodeFields(current, lazybiosType42Fields, cursor);
 
-	Type42 = calloc(count, sizeof(lazybiosType42_t));
-	if (!Type42) return NULL;
-	if (count == 0) {
-		*type42_count = 0;
-		return Type42;
-	}
+	if (lazybiosIsVersionPlus(DMIData, 3, 2)) {
+		READU8(current, interface_type_specific_data_length, len, INTERFACE_TYPE_SPECIFIC_DATA_LENGTH, p);
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
+		if (LAZYBIOS_FIELD_STATUS(current, interface_type_specific_data_length) == LAZYBIOS_FIELD_PRESENT) {
+			const size_t interface_data_end = INTERFACE_TYPE_SPECIFIC_DATA +
+				current->interface_type_specific_data_length;
 
-		if (type == SMBIOS_TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE) {
-			if (index >= count) break;
-			lazybiosType42_t* current = &Type42[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
+			if ((size_t)len >= interface_data_end) {
+				current->interface_type_specific_data.len = current->interface_type_specific_data_length;
+				if (current->interface_type_specific_data.len > 0)
+					current->interface_type_specific_data.ptr = p + INTERFACE_TYPE_SPECIFIC_DATA;
+				LAZYBIOS_MARK_PRESENT(current, interface_type_specific_data);
 
-			READU8(current, interface_type, len, INTERFACE_TYPE, p);
+				if ((size_t)len > interface_data_end) {
+					current->number_of_protocol_records = p[interface_data_end];
+					LAZYBIOS_MARK_PRESENT(current, number_of_protocol_records);
 
-			if (lazybiosIsVersionPlus(DMIData, 3, 2)) {
-				READU8(current, interface_type_specific_data_length, len,
-					   INTERFACE_TYPE_SPECIFIC_DATA_LENGTH, p);
+					size_t protocol_offset = interface_data_end + 1;
+					int protocols_valid = current->interface_type_specific_data_length >=
+						MINIMUM_INTERFACE_TYPE_SPECIFIC_DATA_LENGTH;
 
-				if (current->field_status.interface_type_specific_data_length == LAZYBIOS_FIELD_PRESENT) {
-					const size_t interface_data_end = INTERFACE_TYPE_SPECIFIC_DATA +
-						current->interface_type_specific_data_length;
+					for (size_t i = 0; protocols_valid && i < current->number_of_protocol_records; i++) {
+						if (protocol_offset + 2 > len) {
+							protocols_valid = 0;
+							break;
+						}
 
-					if ((size_t)len >= interface_data_end) {
-						current->interface_type_specific_data_size = current->interface_type_specific_data_length;
-						if (current->interface_type_specific_data_size > 0) {
-							current->interface_type_specific_data = malloc(current->interface_type_specific_data_size);
-							if (!current->interface_type_specific_data) {
-								lazybiosFreeType42(Type42, index + 1);
-								return NULL;
-							}
-							memcpy(current->interface_type_specific_data, p + INTERFACE_TYPE_SPECIFIC_DATA,
-								   current->interface_type_specific_data_size);
+						uint8_t protocol_data_length = p[protocol_offset + 1];
+						if ((size_t)protocol_data_length > (size_t)len - protocol_offset - 2) {
+							protocols_valid = 0;
+							break;
 						}
-						LAZYBIOS_MARK_PRESENT(current, interface_type_specific_data);
-
-						if ((size_t)len > interface_data_end) {
-							current->number_of_protocol_records = p[interface_data_end];
-							LAZYBIOS_MARK_PRESENT(current, number_of_protocol_records);
-
-							size_t protocol_offset = interface_data_end + 1;
-							int protocols_valid = current->interface_type_specific_data_length >=
-								MINIMUM_INTERFACE_TYPE_SPECIFIC_DATA_LENGTH;
-
-							for (size_t i = 0; protocols_valid && i < current->number_of_protocol_records; i++) {
-								if (protocol_offset + 2 > len) {
-									protocols_valid = 0;
-									break;
-								}
-
-								uint8_t protocol_data_length = p[protocol_offset + 1];
-								if ((size_t)protocol_data_length > (size_t)len - protocol_offset - 2) {
-									protocols_valid = 0;
-									break;
-								}
-								protocol_offset += 2 + protocol_data_length;
+						protocol_offset += 2 + protocol_data_length;
+					}
+
+					if (protocols_valid) {
+						if (current->number_of_protocol_records > 0) {
+							current->protocol_records = lazybiosStructCursorAlloc(cursor,
+								current->number_of_protocol_records, sizeof(lazybiosType42ProtocolRecord_t));
+							if (!current->protocol_records) {
+								return -1;
 							}
 
-							if (protocols_valid) {
-								if (current->number_of_protocol_records > 0) {
-									current->protocol_records = calloc(current->number_of_protocol_records,
-																	   sizeof(lazybiosType42ProtocolRecord_t));
-									if (!current->protocol_records) {
-										lazybiosFreeType42(Type42, index + 1);
-										return NULL;
-									}
-
-									protocol_offset = interface_data_end + 1;
-									for (size_t i = 0; i < current->number_of_protocol_records; i++) {
-										lazybiosType42ProtocolRecord_t* protocol = &current->protocol_records[i];
-										protocol->protocol_type = p[protocol_offset];
-										protocol->protocol_type_specific_data_length = p[protocol_offset + 1];
-										if (protocol->protocol_type_specific_data_length > 0) {
-											protocol->protocol_type_specific_data = malloc(
-												protocol->protocol_type_specific_data_length);
-											if (!protocol->protocol_type_specific_data) {
-											lazybiosFreeType42(Type42, index + 1);
-												return NULL;
-											}
-											memcpy(protocol->protocol_type_specific_data, p + protocol_offset + 2,
-												   protocol->protocol_type_specific_data_length);
-										}
-										LAZYBIOS_MARK_PRESENT(protocol, protocol_type);
-										LAZYBIOS_MARK_PRESENT(protocol, protocol_type_specific_data_length);
-										LAZYBIOS_MARK_PRESENT(protocol, protocol_type_specific_data);
-										protocol_offset += 2 + protocol->protocol_type_specific_data_length;
-									}
-								}
-								LAZYBIOS_MARK_PRESENT(current, protocol_records);
-							} else {
-								LAZYBIOS_MARK_ABSENT(current, protocol_records);
+							protocol_offset = interface_data_end + 1;
+							for (size_t i = 0; i < current->number_of_protocol_records; i++) {
+								lazybiosType42ProtocolRecord_t* protocol = &current->protocol_records[i];
+								protocol->protocol_type = p[protocol_offset];
+								protocol->protocol_type_specific_data_length = p[protocol_offset + 1];
+								protocol->protocol_type_specific_data.len = protocol->protocol_type_specific_data_length;
+								if (protocol->protocol_type_specific_data_length > 0)
+									protocol->protocol_type_specific_data.ptr = p + protocol_offset + 2;
+								LAZYBIOS_MARK_PRESENT(protocol, protocol_type);
+								LAZYBIOS_MARK_PRESENT(protocol, protocol_type_specific_data_length);
+								LAZYBIOS_MARK_PRESENT(protocol, protocol_type_specific_data);
+								protocol_offset += 2 + protocol->protocol_type_specific_data_length;
 							}
 						}
+						LAZYBIOS_MARK_PRESENT(current, protocol_records);
 					} else {
-						LAZYBIOS_MARK_ABSENT(current, interface_type_specific_data);
+						LAZYBIOS_MARK_ABSENT(current, protocol_records);
 					}
 				}
-			} else if (current->field_status.interface_type == LAZYBIOS_FIELD_PRESENT &&
-					   current->interface_type == INTERFACE_TYPE_OEM &&
-					   (size_t)len >= INTERFACE_TYPE_SPECIFIC_DATA_LENGTH + PRE_3_2_OEM_DATA_LENGTH) {
-				current->interface_type_specific_data_size = PRE_3_2_OEM_DATA_LENGTH;
-				current->interface_type_specific_data = malloc(current->interface_type_specific_data_size);
-				if (!current->interface_type_specific_data) {
-					lazybiosFreeType42(Type42, index + 1);
-					return NULL;
-				}
-				memcpy(current->interface_type_specific_data, p + INTERFACE_TYPE_SPECIFIC_DATA_LENGTH,
-					   current->interface_type_specific_data_size);
-				LAZYBIOS_MARK_PRESENT(current, interface_type_specific_data);
+			} else {
+				LAZYBIOS_MARK_ABSENT(current, interface_type_specific_data);
 			}
+		}
+	} else if (LAZYBIOS_FIELD_STATUS(current, interface_type) == LAZYBIOS_FIELD_PRESENT &&
+			   current->interface_type == INTERFACE_TYPE_OEM &&
+			   (size_t)len >= INTERFACE_TYPE_SPECIFIC_DATA_LENGTH + PRE_3_2_OEM_DATA_LENGTH) {
+		current->interface_type_specific_data.ptr = p + INTERFACE_TYPE_SPECIFIC_DATA_LENGTH;
+		current->interface_type_specific_data.len = PRE_3_2_OEM_DATA_LENGTH;
+		LAZYBIOS_MARK_PRESENT(current, interface_type_specific_data);
+	}
+
+	return 0;
+}
+
+lazybiosType42_t* lazybiosGetType42(lazybiosType42_t* Type42, size_t* type42_count, lazybiosDMI_t* DMIData) {
+	if (!DMIData || !DMIData->dmi_data) return NULL;
+
+	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE);
+	size_t index = 0;
 
-			index++;
+	Type42 = lazybiosCalloc(count, sizeof(lazybiosType42_t));
+	if (!Type42) return NULL;
+	if (count == 0) {
+		*type42_count = 0;
+		return Type42;
+	}
+
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType42(&Type42[index], &cursor) != 0) {
+			lazybiosFreeType42(Type42, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type42_count = index;
 	return Type42;
@@ -210,14 +199,6 @@ const char* lazybiosType42ProtocolTypeStr(uint8_t protocol_type) {
 void lazybiosFreeType42(lazybiosType42_t* Type42, size_t type42_count) {
 	if (!Type42) return;
 
-	for (size_t i = 0; i < type42_count; i++) {
-		free(Type42[i].interface_type_specific_data);
-		if (Type42[i].protocol_records) {
-			for (size_t j = 0; j < Type42[i].number_of_protocol_records; j++) {
-				free(Type42[i].protocol_records[j].protocol_type_specific_data);
-			}
-		}
-		free(Type42[i].protocol_records);
-	}
-	free(Type42);
+	for (size_t i = 0; i < type42_count; i++) lazybiosFree(Type42[i].protocol_records);
+	lazybiosFree(Type42);
 }
@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType43FieldStatus_t, lazybiosType43FieldIndex_t, 8);
+
 // Fields
 #define VENDOR_ID 0x04
 #define VENDOR_ID_LENGTH 0x04
@@ -43,52 +45,55 @@
 #define FAMILY_CONFIGURABLE_PLATFORM_SOFTWARE_MASK (1ULL << 4)
 #define FAMILY_CONFIGURABLE_OEM_MASK (1ULL << 5)
 
+const lazybiosFieldDesc lazybiosType43Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType43_t, major_spec_version, MAJOR_SPEC_VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType43_t, minor_spec_version, MINOR_SPEC_VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType43_t, firmware_version_1, FIRMWARE_VERSION_1, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U32(lazybiosType43_t, firmware_version_2, FIRMWARE_VERSION_2, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType43_t, description, DESCRIPTION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType43_t, characteristics, CHARACTERISTICS, 0, 0, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType43_t, oem_defined, OEM_DEFINED, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType43(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType43_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType43Fields, cursor);
+
+	if ((size_t)len >= VENDOR_ID + VENDOR_ID_LENGTH) {
+		memcpy(current->vendor_id, p + VENDOR_ID, VENDOR_ID_LENGTH);
+		current->vendor_id[VENDOR_ID_LENGTH] = '\0';
+		LAZYBIOS_MARK_PRESENT(current, vendor_id);
+	} else {
+		memset(current->vendor_id, 0, sizeof(current->vendor_id));
+		LAZYBIOS_MARK_ABSENT(current, vendor_id);
+	}
+
+	return 0;
+}
+
 lazybiosType43_t* lazybiosGetType43(lazybiosType43_t* Type43, size_t* type43_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_TPM_DEVICE);
 	size_t index = 0;
 
-	Type43 = calloc(count, sizeof(lazybiosType43_t));
+	Type43 = lazybiosCalloc(count, sizeof(lazybiosType43_t));
 	if (!Type43) return NULL;
 	if (count == 0) {
 		*type43_count = 0;
 		return Type43;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_TPM_DEVICE) {
-			if (index >= count) break;
-			lazybiosType43_t* current = &Type43[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			if ((size_t)len >= VENDOR_ID + VENDOR_ID_LENGTH) {
-				memcpy(current->vendor_id, p + VENDOR_ID, VENDOR_ID_LENGTH);
-				current->vendor_id[VENDOR_ID_LENGTH] = '\0';
-				LAZYBIOS_MARK_PRESENT(current, vendor_id);
-			} else {
-				memset(current->vendor_id, 0, sizeof(current->vendor_id));
-				LAZYBIOS_MARK_ABSENT(current, vendor_id);
-			}
-
-			READU8(current, major_spec_version, len, MAJOR_SPEC_VERSION, p);
-			READU8(current, minor_spec_version, len, MINOR_SPEC_VERSION, p);
-			READU32(current, firmware_version_1, len, FIRMWARE_VERSION_1, p);
-			READU32(current, firmware_version_2, len, FIRMWARE_VERSION_2, p);
-			READSTR(current, description, len, DESCRIPTION, p, structure_end);
-			READU64(current, characteristics, len, CHARACTERISTICS, p);
-			READU32(current, oem_defined, len, OEM_DEFINED, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_TPM_DEVICE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType43(&Type43[index], &cursor);
+		index++;
 	}
 	*type43_count = index;
 	return Type43;
@@ -127,5 +132,5 @@ void lazybiosFreeType43(lazybiosType43_t* Type43, size_t type43_count) {
     (void)type43_count;
     if (!Type43) return;
 
-    free(Type43);
+    lazybiosFree(Type43);
 }
@@ -23,7 +23,8 @@
  */
 #include "lazybios_internal.h"
 #include <stdlib.h>
-#include <string.h>
+
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType44FieldStatus_t, lazybiosType44FieldIndex_t, 4);
 
 // Fields
 #define REFERENCED_HANDLE 0x04
@@ -44,53 +45,55 @@
 #define PROCESSOR_TYPE_LOONGARCH32 0x09
 #define PROCESSOR_TYPE_LOONGARCH64 0x0A
 
+const lazybiosFieldDesc lazybiosType44Fields[] = {
+	LAZYBIOS_FIELD_U16(lazybiosType44_t, referenced_handle, REFERENCED_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType44_t, block_length, BLOCK_LENGTH, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType44_t, processor_type, PROCESSOR_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType44(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType44_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType44Fields, cursor);
+
+	if (current->referenced_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, referenced_handle);
+
+	if (LAZYBIOS_FIELD_STATUS(current, block_length) == LAZYBIOS_FIELD_PRESENT &&
+		LAZYBIOS_FIELD_STATUS(current, processor_type) == LAZYBIOS_FIELD_PRESENT &&
+		(size_t)len >= (size_t)PROCESSOR_SPECIFIC_DATA + current->block_length) {
+		current->processor_specific_data.len = current->block_length;
+		if (current->block_length > 0) current->processor_specific_data.ptr = p + PROCESSOR_SPECIFIC_DATA;
+		LAZYBIOS_MARK_PRESENT(current, processor_specific_data);
+	}
+
+	return 0;
+}
+
 lazybiosType44_t* lazybiosGetType44(lazybiosType44_t* Type44, size_t* type44_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_PROCESSOR_ADDITIONAL_INFORMATION);
 	size_t index = 0;
 
-	Type44 = calloc(count, sizeof(lazybiosType44_t));
+	Type44 = lazybiosCalloc(count, sizeof(lazybiosType44_t));
 	if (!Type44) return NULL;
 	if (count == 0) {
 		*type44_count = 0;
 		return Type44;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_PROCESSOR_ADDITIONAL_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType44_t* current = &Type44[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU16(current, referenced_handle, len, REFERENCED_HANDLE, p);
-			if (current->referenced_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, referenced_handle);
-			READU8(current, block_length, len, BLOCK_LENGTH, p);
-			READU8(current, processor_type, len, PROCESSOR_TYPE, p);
-
-			if (current->field_status.block_length == LAZYBIOS_FIELD_PRESENT &&
-				current->field_status.processor_type == LAZYBIOS_FIELD_PRESENT &&
-				(size_t)len >= (size_t)PROCESSOR_SPECIFIC_DATA + current->block_length) {
-				if (current->block_length > 0) {
-					current->processor_specific_data = malloc(current->block_length);
-					if (!current->processor_specific_data) {
-						lazybiosFreeType44(Type44, index + 1);
-						return NULL;
-					}
-					memcpy(current->processor_specific_data, p + PROCESSOR_SPECIFIC_DATA, current->block_length);
-				}
-				LAZYBIOS_MARK_PRESENT(current, processor_specific_data);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_PROCESSOR_ADDITIONAL_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType44(&Type44[index], &cursor) != 0) {
+			lazybiosFreeType44(Type44, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type44_count = index;
 	return Type44;
@@ -126,9 +129,8 @@ const char* lazybiosType44ProcessorTypeStr(uint8_t processor_type) {
 }
 
 void lazybiosFreeType44(lazybiosType44_t* Type44, size_t type44_count) {
+    (void)type44_count;
     if (!Type44) return;
 
-	for (size_t i = 0; i < type44_count; i++) free(Type44[i].processor_specific_data);
-
-    free(Type44);
+    lazybiosFree(Type44);
 }
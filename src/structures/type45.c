@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType45FieldStatus_t, lazybiosType45FieldIndex_t, 13);
+
 // Fields
 #define FIRMWARE_COMPONENT_NAME 0x04
 #define FIRMWARE_VERSION 0x05
@@ -65,68 +67,72 @@
 #define STATE_STANDBY_SPARE 0x07
 #define STATE_UNAVAILABLE_OFFLINE 0x08
 
+const lazybiosFieldDesc lazybiosType45Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType45_t, firmware_component_name, FIRMWARE_COMPONENT_NAME, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType45_t, firmware_version, FIRMWARE_VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType45_t, version_format, VERSION_FORMAT, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType45_t, firmware_id, FIRMWARE_ID, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType45_t, firmware_id_format, FIRMWARE_ID_FORMAT, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType45_t, release_date, RELEASE_DATE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType45_t, manufacturer, MANUFACTURER, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_STR(lazybiosType45_t, lowest_supported_firmware_version, LOWEST_SUPPORTED_FIRMWARE_VERSION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U64(lazybiosType45_t, image_size, IMAGE_SIZE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType45_t, characteristics, CHARACTERISTICS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType45_t, state, STATE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType45_t, number_of_associated_components, NUMBER_OF_ASSOCIATED_COMPONENTS, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType45(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType45_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType45Fields, cursor);
+
+	if (LAZYBIOS_FIELD_STATUS(current, number_of_associated_components) == LAZYBIOS_FIELD_PRESENT) {
+		const size_t associated_handles_size =
+			(size_t)current->number_of_associated_components * sizeof(uint16_t);
+		if ((size_t)len >= ASSOCIATED_COMPONENT_HANDLES + associated_handles_size) {
+			if (current->number_of_associated_components > 0) {
+				current->associated_component_handles = lazybiosStructCursorAlloc(cursor, associated_handles_size, 1);
+				if (!current->associated_component_handles) {
+					return -1;
+				}
+				memcpy(current->associated_component_handles, p + ASSOCIATED_COMPONENT_HANDLES,
+					associated_handles_size);
+			}
+			LAZYBIOS_MARK_PRESENT(current, associated_component_handles);
+		} else {
+			LAZYBIOS_MARK_ABSENT(current, associated_component_handles);
+		}
+	}
+
+	return 0;
+}
+
 lazybiosType45_t* lazybiosGetType45(lazybiosType45_t* Type45, size_t* type45_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_FIRMWARE_INVENTORY_INFORMATION);
 	size_t index = 0;
 
-	Type45 = calloc(count, sizeof(lazybiosType45_t));
+	Type45 = lazybiosCalloc(count, sizeof(lazybiosType45_t));
 	if (!Type45) return NULL;
 	if (count == 0) {
 		*type45_count = 0;
 		return Type45;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_FIRMWARE_INVENTORY_INFORMATION) {
-			if (index >= count) break;
-			lazybiosType45_t* current = &Type45[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, firmware_component_name, len, FIRMWARE_COMPONENT_NAME, p, structure_end);
-			READSTR(current, firmware_version, len, FIRMWARE_VERSION, p, structure_end);
-			READU8(current, version_format, len, VERSION_FORMAT, p);
-			READSTR(current, firmware_id, len, FIRMWARE_ID, p, structure_end);
-			READU8(current, firmware_id_format, len, FIRMWARE_ID_FORMAT, p);
-			READSTR(current, release_date, len, RELEASE_DATE, p, structure_end);
-			READSTR(current, manufacturer, len, MANUFACTURER, p, structure_end);
-			READSTR(current, lowest_supported_firmware_version, len, LOWEST_SUPPORTED_FIRMWARE_VERSION, p,
-					structure_end);
-			READU64(current, image_size, len, IMAGE_SIZE, p);
-			READU16(current, characteristics, len, CHARACTERISTICS, p);
-			READU8(current, state, len, STATE, p);
-			READU8(current, number_of_associated_components, len, NUMBER_OF_ASSOCIATED_COMPONENTS, p);
-
-			if (current->field_status.number_of_associated_components == LAZYBIOS_FIELD_PRESENT) {
-				const size_t associated_handles_size =
-					(size_t)current->number_of_associated_components * sizeof(uint16_t);
-				if ((size_t)len >= ASSOCIATED_COMPONENT_HANDLES + associated_handles_size) {
-					if (current->number_of_associated_components > 0) {
-						current->associated_component_handles = malloc(associated_handles_size);
-						if (!current->associated_component_handles) {
-							lazybiosFreeType45(Type45, index + 1);
-							return NULL;
-						}
-						memcpy(current->associated_component_handles, p + ASSOCIATED_COMPONENT_HANDLES,
-							associated_handles_size);
-					}
-					LAZYBIOS_MARK_PRESENT(current, associated_component_handles);
-				} else {
-					LAZYBIOS_MARK_ABSENT(current, associated_component_handles);
-				}
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_FIRMWARE_INVENTORY_INFORMATION);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType45(&Type45[index], &cursor) != 0) {
+			lazybiosFreeType45(Type45, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type45_count = index;
 	return Type45;
@@ -193,7 +199,7 @@ const char* lazybiosType45StateStr(uint8_t state) {
 
 void lazybiosFreeType45(lazybiosType45_t* Type45, size_t type45_count) {
 	if (!Type45) return;
-	for (size_t i = 0; i < type45_count; i++) free(Type45[i].associated_component_handles);
+	for (size_t i = 0; i < type45_count; i++) lazybiosFree(Type45[i].associated_component_handles);
 
-    free(Type45);
+    lazybiosFree(Type45);
 }
@@ -24,6 +24,8 @@
 #include "lazybios_internal.h"
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType46FieldStatus_t, lazybiosType46FieldIndex_t, 3);
+
 // Fields
 #define STRING_PROPERTY_ID 0x04
 #define STRING_PROPERTY_VALUE 0x06
@@ -35,40 +37,42 @@
 #define STRING_PROPERTY_ID_DMTF_MAX 0x7FFF
 #define STRING_PROPERTY_ID_FIRMWARE_VENDOR_MAX 0xBFFF
 
+const lazybiosFieldDesc lazybiosType46Fields[] = {
+	LAZYBIOS_FIELD_U16(lazybiosType46_t, string_property_id, STRING_PROPERTY_ID, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType46_t, string_property_value, STRING_PROPERTY_VALUE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType46_t, parent_handle, PARENT_HANDLE, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType46(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType46_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType46Fields, cursor);
+
+	if (current->parent_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, parent_handle);
+
+	return 0;
+}
+
 lazybiosType46_t* lazybiosGetType46(lazybiosType46_t* Type46, size_t* type46_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_STRING_PROPERTY);
 	size_t index = 0;
 
-	Type46 = calloc(count, sizeof(lazybiosType46_t));
+	Type46 = lazybiosCalloc(count, sizeof(lazybiosType46_t));
 	if (!Type46) return NULL;
 	if (count == 0) {
 		*type46_count = 0;
 		return Type46;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_STRING_PROPERTY) {
-			if (index >= count) break;
-			lazybiosType46_t* current = &Type46[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READU16(current, string_property_id, len, STRING_PROPERTY_ID, p);
-			READSTR(current, string_property_value, len, STRING_PROPERTY_VALUE, p, structure_end);
-			READU16(current, parent_handle, len, PARENT_HANDLE, p);
-			if (current->parent_handle == 0xFFFF) LAZYBIOS_MARK_ABSENT(current, parent_handle);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_STRING_PROPERTY);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType46(&Type46[index], &cursor);
+		index++;
 	}
 	*type46_count = index;
 	return Type46;
@@ -86,5 +90,5 @@ void lazybiosFreeType46(lazybiosType46_t* Type46, size_t type46_count) {
     (void)type46_count;
     if (!Type46) return;
 
-    free(Type46);
+    lazybiosFree(Type46);
 }
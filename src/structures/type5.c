@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType5FieldStatus_t, lazybiosType5FieldIndex_t, 11);
+
 // Fields
 #define ERROR_DETECTING_METHOD 0x04
 #define ERROR_CORRECTING_CAPABILITY 0x05
@@ -58,74 +60,80 @@
 #define INTERLEAVE_EIGHT_WAY 0x06
 #define INTERLEAVE_SIXTEEN_WAY 0x07
 
+const lazybiosFieldDesc lazybiosType5Fields[] = {
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, error_detecting_method, ERROR_DETECTING_METHOD, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, error_correcting_capability, ERROR_CORRECTING_CAPABILITY, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, supported_interleave, SUPPORTED_INTERLEAVE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, current_interleave, CURRENT_INTERLEAVE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, maximum_memory_module_size, MAXIMUM_MEMORY_MODULE_SIZE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType5_t, supported_speeds, SUPPORTED_SPEEDS, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType5_t, supported_memory_types, SUPPORTED_MEMORY_TYPES, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, memory_module_voltage, MEMORY_MODULE_VOLTAGE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType5_t, number_of_associated_memory_slots, NUMBER_OF_ASSOCIATED_MEMORY_SLOTS, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType5(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType5_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType5Fields, cursor);
+
+	if (LAZYBIOS_FIELD_STATUS(current, number_of_associated_memory_slots) == LAZYBIOS_FIELD_PRESENT) {
+		size_t handle_bytes = (size_t)current->number_of_associated_memory_slots * sizeof(uint16_t);
+		if ((size_t)len >= MEMORY_MODULE_CONFIGURATION_HANDLES + handle_bytes) {
+			if (current->number_of_associated_memory_slots > 0) {
+				current->memory_module_configuration_handles =
+					lazybiosStructCursorAlloc(cursor, current->number_of_associated_memory_slots, sizeof(uint16_t));
+				if (!current->memory_module_configuration_handles) {
+					return -1;
+				}
+				for (size_t i = 0; i < current->number_of_associated_memory_slots; i++) {
+					memcpy(&current->memory_module_configuration_handles[i],
+						p + MEMORY_MODULE_CONFIGURATION_HANDLES + (i * sizeof(uint16_t)), sizeof(uint16_t));
+				}
+			}
+			LAZYBIOS_MARK_PRESENT(current, memory_module_configuration_handles);
+		} else {
+			LAZYBIOS_MARK_ABSENT(current, memory_module_configuration_handles);
+		}
+	}
+
+	if (lazybiosIsVersionPlus(DMIData, 2, 1) &&
+		LAZYBIOS_FIELD_STATUS(current, number_of_associated_memory_slots) == LAZYBIOS_FIELD_PRESENT) {
+		READU8(current, enabled_error_correcting_capabilities, len, ENABLED_ERROR_CORRECTING_CAPABILITIES(current->number_of_associated_memory_slots), p);
+	} else {
+		current->enabled_error_correcting_capabilities = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, enabled_error_correcting_capabilities);
+	}
+
+	return 0;
+}
+
 lazybiosType5_t* lazybiosGetType5(lazybiosType5_t* Type5, size_t* type5_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MEMORY_CONTROLLER);
 	size_t index = 0;
 
-	Type5 = calloc(count, sizeof(lazybiosType5_t));
+	Type5 = lazybiosCalloc(count, sizeof(lazybiosType5_t));
 	if (!Type5) return NULL;
 	if (count == 0) {
 		*type5_count = 0;
 		return Type5;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_MEMORY_CONTROLLER) {
-			if (index >= count) break;
-			lazybiosType5_t* current = &Type5[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-
-			READU8(current, error_detecting_method, len, ERROR_DETECTING_METHOD, p);
-			READU8(current, error_correcting_capability, len, ERROR_CORRECTING_CAPABILITY, p);
-			READU8(current, supported_interleave, len, SUPPORTED_INTERLEAVE, p);
-			READU8(current, current_interleave, len, CURRENT_INTERLEAVE, p);
-			READU8(current, maximum_memory_module_size, len, MAXIMUM_MEMORY_MODULE_SIZE, p);
-			READU16(current, supported_speeds, len, SUPPORTED_SPEEDS, p);
-			READU16(current, supported_memory_types, len, SUPPORTED_MEMORY_TYPES, p);
-			READU8(current, memory_module_voltage, len, MEMORY_MODULE_VOLTAGE, p);
-			READU8(current, number_of_associated_memory_slots, len, NUMBER_OF_ASSOCIATED_MEMORY_SLOTS, p);
-
-			if (LAZYBIOS_FIELD_STATUS(current, number_of_associated_memory_slots) == LAZYBIOS_FIELD_PRESENT) {
-				size_t handle_bytes = (size_t)current->number_of_associated_memory_slots * sizeof(uint16_t);
-				if ((size_t)len >= MEMORY_MODULE_CONFIGURATION_HANDLES + handle_bytes) {
-					if (current->number_of_associated_memory_slots > 0) {
-						current->memory_module_configuration_handles =
-							calloc(current->number_of_associated_memory_slots, sizeof(uint16_t));
-						if (!current->memory_module_configuration_handles) {
-							lazybiosFreeType5(Type5, index + 1);
-							return NULL;
-						}
-						for (size_t i = 0; i < current->number_of_associated_memory_slots; i++) {
-							memcpy(&current->memory_module_configuration_handles[i],
-								p + MEMORY_MODULE_CONFIGURATION_HANDLES + (i * sizeof(uint16_t)), sizeof(uint16_t));
-						}
-					}
-					LAZYBIOS_MARK_PRESENT(current, memory_module_configuration_handles);
-				} else {
-					LAZYBIOS_MARK_ABSENT(current, memory_module_configuration_handles);
-				}
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1) &&
-				LAZYBIOS_FIELD_STATUS(current, number_of_associated_memory_slots) == LAZYBIOS_FIELD_PRESENT) {
-				READU8(current, enabled_error_correcting_capabilities, len,
-					ENABLED_ERROR_CORRECTING_CAPABILITIES(current->number_of_associated_memory_slots), p);
-			} else {
-				current->enabled_error_correcting_capabilities = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, enabled_error_correcting_capabilities);
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MEMORY_CONTROLLER);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType5(&Type5[index], &cursor) != 0) {
+			lazybiosFreeType5(Type5, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type5_count = index;
 	return Type5;
@@ -217,7 +225,7 @@ void lazybiosType5MemoryModuleVoltageStr(uint8_t memory_module_voltage, char* bu
 
 void lazybiosFreeType5(lazybiosType5_t* Type5, size_t type5_count) {
 	if (!Type5) return;
-	for (size_t i = 0; i < type5_count; i++) free(Type5[i].memory_module_configuration_handles);
+	for (size_t i = 0; i < type5_count; i++) lazybiosFree(Type5[i].memory_module_configuration_handles);
 
-	free(Type5);
+	lazybiosFree(Type5);
 }
@@ -25,6 +25,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType6FieldStatus_t, lazybiosType6FieldIndex_t, 7);
+
 // Fields
 #define SOCKET_DESIGNATION 0x04
 #define BANK_CONNECTIONS 0x05
@@ -42,36 +44,42 @@
 #define SIZE_NOT_INSTALLED 0x7F
 /* --- */
 
+const lazybiosFieldDesc lazybiosType6Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType6_t, socket_designation, SOCKET_DESIGNATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType6_t, bank_connections, BANK_CONNECTIONS, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType6_t, current_speed, CURRENT_SPEED, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType6_t, current_memory_type, CURRENT_MEMORY_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType6_t, installed_size, INSTALLED_SIZE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType6_t, enabled_size, ENABLED_SIZE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType6_t, error_status, ERROR_STATUS, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType6(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType6_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType6Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType6_t* lazybiosGetType6(lazybiosType6_t* Type6, size_t* type6_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_MEMORY_MODULE);
 	size_t index = 0;
-	Type6 = calloc(count, sizeof(lazybiosType6_t));
+	Type6 = lazybiosCalloc(count, sizeof(lazybiosType6_t));
 	if (!Type6) return NULL;
 	if (count == 0) {
 		*type6_count = 0;
 		return Type6;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-		if (type == SMBIOS_TYPE_MEMORY_MODULE) {
-			lazybiosType6_t* current = &Type6[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-			READSTR(current, socket_designation, len, SOCKET_DESIGNATION, p, structure_end);
-			READU8(current, bank_connections, len, BANK_CONNECTIONS, p);
-			READU8(current, current_speed, len, CURRENT_SPEED, p);
-			READU16(current, current_memory_type, len, CURRENT_MEMORY_TYPE, p);
-			READU8(current, installed_size, len, INSTALLED_SIZE, p);
-			READU8(current, enabled_size, len, ENABLED_SIZE, p);
-			READU8(current, error_status, len, ERROR_STATUS, p);
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_MEMORY_MODULE);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType6(&Type6[index], &cursor);
+		index++;
 	}
 	*type6_count = index;
 	return Type6;
@@ -145,5 +153,5 @@ void lazybiosFreeType6(lazybiosType6_t* Type6, size_t type6_count) {
     (void)type6_count;
     if (!Type6) return;
 
-    free(Type6);
+    lazybiosFree(Type6);
 }
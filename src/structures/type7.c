@@ -26,6 +26,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType7FieldStatus_t, lazybiosType7FieldIndex_t, 12);
+
 // Fields
 #define SOCKET_DESIGNATION 0x04
 #define CACHE_CONFIGURATION 0x05
@@ -72,52 +74,49 @@
 #define _64_WAY_SET_ASSOCIATIVE 0x0D
 #define _20_WAY_SET_ASSOCIATIVE 0x0E
 
+const lazybiosFieldDesc lazybiosType7Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType7_t, socket_designation, SOCKET_DESIGNATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U16(lazybiosType7_t, cache_configuration, CACHE_CONFIGURATION, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType7_t, maximum_cache_size, MAXIMUM_CACHE_SIZE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType7_t, installed_size, INSTALLED_SIZE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType7_t, supported_sram_type, SUPPORTED_SRAM_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType7_t, current_sram_type, CURRENT_SRAM_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType7_t, cache_speed, CACHE_SPEED, 2, 1, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType7_t, error_correction_type, ERROR_CORRECTION_TYPE, 2, 1, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType7_t, system_cache_type, SYSTEM_CACHE_TYPE, 2, 1, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType7_t, associativity, ASSOCIATIVITY, 2, 1, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType7_t, maximum_cache_size_2, MAXIMUM_CACHE_SIZE_2, 3, 1, 0),
+	LAZYBIOS_FIELD_U32(lazybiosType7_t, installed_cache_size_2, INSTALLED_CACHE_SIZE_2, 3, 1, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType7(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType7_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType7Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType7_t* lazybiosGetType7(lazybiosType7_t* Type7, size_t* type7_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_CACHES);
 	size_t index = 0;
 
-	Type7 = calloc(count, sizeof(lazybiosType7_t));
+	Type7 = lazybiosCalloc(count, sizeof(lazybiosType7_t));
 	if (!Type7) return NULL;
 	if (count == 0) {
 		*type7_count = 0;
 		return Type7;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_CACHES) {
-			if (index >= count) break;
-			lazybiosType7_t* current = &Type7[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, socket_designation, len, SOCKET_DESIGNATION, p, structure_end);
-			READU16(current, cache_configuration, len, CACHE_CONFIGURATION, p);
-			READU16(current, maximum_cache_size, len, MAXIMUM_CACHE_SIZE, p);
-			READU16(current, installed_size, len, INSTALLED_SIZE, p);
-			READU16(current, supported_sram_type, len, SUPPORTED_SRAM_TYPE, p);
-			READU16(current, current_sram_type, len, CURRENT_SRAM_TYPE, p);
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU8(current, cache_speed, len, CACHE_SPEED, p);
-				READU8(current, error_correction_type, len, ERROR_CORRECTION_TYPE, p);
-				READU8(current, system_cache_type, len, SYSTEM_CACHE_TYPE, p);
-				READU8(current, associativity, len, ASSOCIATIVITY, p);
-			}
-			if (lazybiosIsVersionPlus(DMIData, 3, 1)) {
-				READU32(current, maximum_cache_size_2, len, MAXIMUM_CACHE_SIZE_2, p);
-				READU32(current, installed_cache_size_2, len, INSTALLED_CACHE_SIZE_2, p);
-			}
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_CACHES);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType7(&Type7[index], &cursor);
+		index++;
 	}
 	*type7_count = index;
 	return Type7;
@@ -302,5 +301,5 @@ void lazybiosFreeType7(lazybiosType7_t* Type7, size_t type7_count) {
     (void)type7_count;
     if (!Type7) return;
 
-    free(Type7);
+    lazybiosFree(Type7);
 }
@@ -25,6 +25,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType8FieldStatus_t, lazybiosType8FieldIndex_t, 5);
+
 // Fields
 #define INTERNAL_REFERENCE_DESIGNATOR 0x04
 #define INTERNAL_CONNECTOR_TYPE 0x05
@@ -118,41 +120,42 @@
 #define PORT_TYPE_8251_FIFO_COMPATIBLE 0xA1
 #define PORT_TYPE_OTHER 0xFF
 
+const lazybiosFieldDesc lazybiosType8Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType8_t, internal_reference_designator, INTERNAL_REFERENCE_DESIGNATOR, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType8_t, internal_connector_type, INTERNAL_CONNECTOR_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_STR(lazybiosType8_t, external_reference_designator, EXTERNAL_REFERENCE_DESIGNATOR, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType8_t, external_connector_type, EXTERNAL_CONNECTOR_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType8_t, port_type, PORT_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType8(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType8_t* current = record;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType8Fields, cursor);
+
+	return 0;
+}
+
 lazybiosType8_t* lazybiosGetType8(lazybiosType8_t* Type8, size_t* type8_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_PORT_CONNECTOR);
 	size_t index = 0;
 
-	Type8 = calloc(count, sizeof(lazybiosType8_t));
+	Type8 = lazybiosCalloc(count, sizeof(lazybiosType8_t));
 	if (!Type8) return NULL;
 	if (count == 0) {
 		*type8_count = 0;
 		return Type8;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_PORT_CONNECTOR) {
-			if (index >= count) break;
-			lazybiosType8_t* current = &Type8[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, internal_reference_designator, len, INTERNAL_REFERENCE_DESIGNATOR, p, structure_end);
-			READU8(current, internal_connector_type, len, INTERNAL_CONNECTOR_TYPE, p);
-			READSTR(current, external_reference_designator, len, EXTERNAL_REFERENCE_DESIGNATOR, p, structure_end);
-			READU8(current, external_connector_type, len, EXTERNAL_CONNECTOR_TYPE, p);
-			READU8(current, port_type, len, PORT_TYPE, p);
-
-			index++;
-		}
-		p = DMINext(p, end);
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_PORT_CONNECTOR);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		lazybiosDecodeType8(&Type8[index], &cursor);
+		index++;
 	}
 	*type8_count = index;
 	return Type8;
@@ -341,5 +344,5 @@ void lazybiosFreeType8(lazybiosType8_t* Type8, size_t type8_count) {
     (void)type8_count;
     if (!Type8) return;
 
-    free(Type8);
+    lazybiosFree(Type8);
 }
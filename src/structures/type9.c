@@ -26,6 +26,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType9PeerGroupFieldStatus_t, lazybiosType9PeerGroupFieldIndex_t, 4);
+LAZYBIOS_CHECK_FIELD_INDEX(lazybiosType9FieldStatus_t, lazybiosType9FieldIndex_t, 18);
+
 // Fields
 #define SLOT_DESIGNATION 0x04
 #define SLOT_TYPE 0x05
@@ -167,138 +170,124 @@
 #define SLOT_HEIGHT_FULL 0x03
 #define SLOT_HEIGHT_LOW_PROFILE 0x04
 
+const lazybiosFieldDesc lazybiosType9Fields[] = {
+	LAZYBIOS_FIELD_STR(lazybiosType9_t, slot_designation, SLOT_DESIGNATION, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, slot_type, SLOT_TYPE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, slot_data_bus_width, SLOT_DATA_BUS_WIDTH, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, current_usage, CURRENT_USAGE, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, slot_length, SLOT_LENGTH, 0, 0, 0),
+	LAZYBIOS_FIELD_U16(lazybiosType9_t, slot_id, SLOT_ID, 0, 0, LAZYBIOS_FIELD_JSON),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, slot_characteristics_1, SLOT_CHARACTERISTICS_1, 0, 0, 0),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, slot_characteristics_2, SLOT_CHARACTERISTICS_2, 2, 1, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U16(lazybiosType9_t, segment_group_number, SEGMENT_GROUP_NUMBER, 2, 6, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, bus_number, BUS_NUMBER, 2, 6, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, device_function_number, DEVICE_FUNCTION_NUMBER, 2, 6, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, data_bus_width, DATA_BUS_WIDTH, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_U8(lazybiosType9_t, peer_grouping_count, PEER_GROUPING_COUNT, 3, 2, LAZYBIOS_FIELD_GATED),
+	LAZYBIOS_FIELD_END
+};
+
+int lazybiosDecodeType9(void* record, const lazybiosStructCursor* cursor) {
+	lazybiosType9_t* current = record;
+	const uint8_t* p = cursor->p;
+	uint8_t len = cursor->length;
+	const lazybiosDMI_t* DMIData = cursor->DMIData;
+	current->handle = cursor->handle;
+
+	lazybiosDecodeFields(current, lazybiosType9Fields, cursor);
+
+	uint8_t declared_peer_grouping_count = 0;
+	int peer_layout_valid = 0;
+	if (lazybiosIsVersionPlus(DMIData, 3, 2)) {
+		declared_peer_grouping_count = current->peer_grouping_count;
+
+		if (LAZYBIOS_FIELD_STATUS(current, peer_grouping_count) == LAZYBIOS_FIELD_PRESENT) {
+			const size_t peer_bytes = (size_t)declared_peer_grouping_count * PEER_GROUP_SIZE;
+			peer_layout_valid = len >= PEER_GROUPS + peer_bytes;
+
+			if (peer_layout_valid && declared_peer_grouping_count > 0) {
+				current->peer_groups = lazybiosStructCursorAlloc(cursor, declared_peer_grouping_count, sizeof(lazybiosType9PeerGroup_t));
+				if (current->peer_groups) {
+					for (size_t i = 0; i < declared_peer_grouping_count; i++) {
+						const size_t peer_offset = PEER_GROUPS + (i * PEER_GROUP_SIZE);
+						memcpy(&current->peer_groups[i].segment_group_number, p + peer_offset, sizeof(uint16_t));
+						current->peer_groups[i].bus_number = p[peer_offset + 2];
+						current->peer_groups[i].device_function_number = p[peer_offset + 3];
+						current->peer_groups[i].data_bus_width = p[peer_offset + 4];
+						LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], segment_group_number);
+						LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], bus_number);
+						LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], device_function_number);
+						LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], data_bus_width);
+					}
+					LAZYBIOS_MARK_PRESENT(current, peer_groups);
+				} else {
+					return -1;
+				}
+			} else if (!peer_layout_valid) {
+				LAZYBIOS_MARK_ABSENT(current, peer_groups);
+			} else {
+				LAZYBIOS_MARK_PRESENT(current, peer_groups);
+			}
+		}
+	} else {
+		current->peer_groups = NULL;
+		LAZYBIOS_MARK_UNREACHABLE(current, peer_groups);
+	}
+
+	if (lazybiosIsVersionPlus(DMIData, 3, 4) && peer_layout_valid) {
+		READU8(current, slot_information, len, SLOT_INFORMATION(declared_peer_grouping_count), p);
+		READU8(current, slot_physical_width, len, SLOT_PHYSICAL_WIDTH(declared_peer_grouping_count), p);
+		READU16(current, slot_pitch, len, SLOT_PITCH(declared_peer_grouping_count), p);
+	} else {
+		current->slot_information = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, slot_information);
+		current->slot_physical_width = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, slot_physical_width);
+		current->slot_pitch = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, slot_pitch);
+		if (lazybiosIsVersionPlus(DMIData, 3, 4) &&
+			LAZYBIOS_FIELD_STATUS(current, peer_grouping_count) == LAZYBIOS_FIELD_PRESENT) {
+			LAZYBIOS_MARK_ABSENT(current, slot_information);
+			LAZYBIOS_MARK_ABSENT(current, slot_physical_width);
+			LAZYBIOS_MARK_ABSENT(current, slot_pitch);
+		}
+	}
+
+	if (lazybiosIsVersionPlus(DMIData, 3, 5) && peer_layout_valid) {
+		READU8(current, slot_height, len, SLOT_HEIGHT(declared_peer_grouping_count), p);
+	} else {
+		current->slot_height = 0;
+		LAZYBIOS_MARK_UNREACHABLE(current, slot_height);
+		if (lazybiosIsVersionPlus(DMIData, 3, 5) &&
+			LAZYBIOS_FIELD_STATUS(current, peer_grouping_count) == LAZYBIOS_FIELD_PRESENT) {
+			LAZYBIOS_MARK_ABSENT(current, slot_height);
+		}
+	}
+
+	return 0;
+}
+
 lazybiosType9_t* lazybiosGetType9(lazybiosType9_t* Type9, size_t* type9_count, lazybiosDMI_t* DMIData) {
 	if (!DMIData || !DMIData->dmi_data) return NULL;
 
-	const uint8_t* p = DMIData->dmi_data;
-	const uint8_t* end = DMIData->dmi_data + DMIData->dmi_len;
-
 	size_t count = lazybiosCountStructsByType(DMIData, SMBIOS_TYPE_SYSTEM_SLOTS);
 	size_t index = 0;
 
-	Type9 = calloc(count, sizeof(lazybiosType9_t));
+	Type9 = lazybiosCalloc(count, sizeof(lazybiosType9_t));
 	if (!Type9) return NULL;
 	if (count == 0) {
 		*type9_count = 0;
 		return Type9;
 	}
 
-	while (p + SMBIOS_HEADER_SIZE <= end && index < count) {
-		uint8_t type = p[0];
-		uint8_t len = p[1];
-
-		if (type == SMBIOS_TYPE_SYSTEM_SLOTS) {
-			if (index >= count) break;
-			lazybiosType9_t* current = &Type9[index];
-			LAZYBIOS_CLAMP_STRUCTURE_LENGTH(len, p, end);
-			const uint8_t* structure_end = DMINext(p, end);
-
-			READSTR(current, slot_designation, len, SLOT_DESIGNATION, p, structure_end);
-			READU8(current, slot_type, len, SLOT_TYPE, p);
-			READU8(current, slot_data_bus_width, len, SLOT_DATA_BUS_WIDTH, p);
-			READU8(current, current_usage, len, CURRENT_USAGE, p);
-			READU8(current, slot_length, len, SLOT_LENGTH, p);
-			READU16(current, slot_id, len, SLOT_ID, p);
-			READU8(current, slot_characteristics_1, len, SLOT_CHARACTERISTICS_1, p);
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 1)) {
-				READU8(current, slot_characteristics_2, len, SLOT_CHARACTERISTICS_2, p);
-			} else {
-				current->slot_characteristics_2 = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, slot_characteristics_2);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 2, 6)) {
-				READU16(current, segment_group_number, len, SEGMENT_GROUP_NUMBER, p);
-				READU8(current, bus_number, len, BUS_NUMBER, p);
-				READU8(current, device_function_number, len, DEVICE_FUNCTION_NUMBER, p);
-			} else {
-				current->segment_group_number = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, segment_group_number);
-				current->bus_number = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, bus_number);
-				current->device_function_number = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, device_function_number);
-			}
-
-			uint8_t declared_peer_grouping_count = 0;
-			int peer_layout_valid = 0;
-			if (lazybiosIsVersionPlus(DMIData, 3, 2)) {
-				READU8(current, data_bus_width, len, DATA_BUS_WIDTH, p);
-				READU8(current, peer_grouping_count, len, PEER_GROUPING_COUNT, p);
-				declared_peer_grouping_count = current->peer_grouping_count;
-
-				if (LAZYBIOS_FIELD_STATUS(current, peer_grouping_count) == LAZYBIOS_FIELD_PRESENT) {
-					const size_t peer_bytes = (size_t)declared_peer_grouping_count * PEER_GROUP_SIZE;
-					peer_layout_valid = len >= PEER_GROUPS + peer_bytes;
-
-					if (peer_layout_valid && declared_peer_grouping_count > 0) {
-						current->peer_groups = calloc(declared_peer_grouping_count, sizeof(lazybiosType9PeerGroup_t));
-						if (current->peer_groups) {
-							for (size_t i = 0; i < declared_peer_grouping_count; i++) {
-								const size_t peer_offset = PEER_GROUPS + (i * PEER_GROUP_SIZE);
-								memcpy(&current->peer_groups[i].segment_group_number, p + peer_offset, sizeof(uint16_t));
-								current->peer_groups[i].bus_number = p[peer_offset + 2];
-								current->peer_groups[i].device_function_number = p[peer_offset + 3];
-								current->peer_groups[i].data_bus_width = p[peer_offset + 4];
-								LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], segment_group_number);
-								LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], bus_number);
-								LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], device_function_number);
-								LAZYBIOS_MARK_PRESENT(&current->peer_groups[i], data_bus_width);
-							}
-							LAZYBIOS_MARK_PRESENT(current, peer_groups);
-						} else {
-							lazybiosFreeType9(Type9, index + 1);
-							return NULL;
-						}
-					} else if (!peer_layout_valid) {
-						LAZYBIOS_MARK_ABSENT(current, peer_groups);
-					} else {
-						LAZYBIOS_MARK_PRESENT(current, peer_groups);
-					}
-				}
-			} else {
-				current->data_bus_width = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, data_bus_width);
-				current->peer_grouping_count = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, peer_grouping_count);
-				current->peer_groups = NULL;
-				LAZYBIOS_MARK_UNREACHABLE(current, peer_groups);
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 4) && peer_layout_valid) {
-				READU8(current, slot_information, len, SLOT_INFORMATION(declared_peer_grouping_count), p);
-				READU8(current, slot_physical_width, len, SLOT_PHYSICAL_WIDTH(declared_peer_grouping_count), p);
-				READU16(current, slot_pitch, len, SLOT_PITCH(declared_peer_grouping_count), p);
-			} else {
-				current->slot_information = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, slot_information);
-				current->slot_physical_width = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, slot_physical_width);
-				current->slot_pitch = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, slot_pitch);
-				if (lazybiosIsVersionPlus(DMIData, 3, 4) &&
-					LAZYBIOS_FIELD_STATUS(current, peer_grouping_count) == LAZYBIOS_FIELD_PRESENT) {
-					LAZYBIOS_MARK_ABSENT(current, slot_information);
-					LAZYBIOS_MARK_ABSENT(current, slot_physical_width);
-					LAZYBIOS_MARK_ABSENT(current, slot_pitch);
-				}
-			}
-
-			if (lazybiosIsVersionPlus(DMIData, 3, 5) && peer_layout_valid) {
-				READU8(current, slot_height, len, SLOT_HEIGHT(declared_peer_grouping_count), p);
-			} else {
-				current->slot_height = 0;
-				LAZYBIOS_MARK_UNREACHABLE(current, slot_height);
-				if (lazybiosIsVersionPlus(DMIData, 3, 5) &&
-					LAZYBIOS_FIELD_STATUS(current, peer_grouping_count) == LAZYBIOS_FIELD_PRESENT) {
-					LAZYBIOS_MARK_ABSENT(current, slot_height);
-				}
-			}
-
-			index++;
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, DMIData, SMBIOS_TYPE_SYSTEM_SLOTS);
+	while (index < count && lazybiosStructCursorNext(&cursor)) {
+		if (lazybiosDecodeType9(&Type9[index], &cursor) != 0) {
+			lazybiosFreeType9(Type9, index + 1);
+			return NULL;
 		}
-		p = DMINext(p, end);
+		index++;
 	}
 	*type9_count = index;
 	return Type9;
@@ -509,7 +498,7 @@ const char* lazybiosType9SlotHeightStr(uint8_t slot_height) {
 void lazybiosFreeType9(lazybiosType9_t* Type9, size_t type9_count) {
     if (!Type9) return;
 
-    for (size_t i = 0; i < type9_count; i++) free(Type9[i].peer_groups);
+    for (size_t i = 0; i < type9_count; i++) lazybiosFree(Type9[i].peer_groups);
 
-    free(Type9);
+    lazybiosFree(Type9);
 }
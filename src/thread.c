@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+/**
+ * @file thread.c
+ * @brief Starts and joins the worker threads of batch loads and parallel parses.
+ * @author LazySeldi
+ */
+#include "lazybios_internal.h"
+
+#if defined(_WIN32)
+#	define THREAD_WIN32 1
+#	include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__) || defined(__HAIKU__)
+#	define THREAD_PTHREAD 1
+#	include <pthread.h>
+#	include <unistd.h>
+#endif
+
+struct lazybiosThread {
+	void (*fn)(void* arg);
+	void* arg;
+#if defined(THREAD_WIN32)
+	HANDLE handle;
+#elif defined(THREAD_PTHREAD)
+	pthread_t handle;
+#endif
+};
+
+#if defined(THREAD_WIN32)
+static DWORD WINAPI thread_main(LPVOID arg) {
+	lazybiosThread* thread = arg;
+	thread->fn(thread->arg);
+	return 0;
+}
+
+unsigned lazybiosCPUCount(void) {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors ? (unsigned)info.dwNumberOfProcessors : 1;
+}
+
+static int thread_create(lazybiosThread* thread) {
+	thread->handle = CreateThread(NULL, 0, thread_main, thread, 0, NULL);
+	return thread->handle ? 0 : -1;
+}
+
+static void thread_wait(lazybiosThread* thread) {
+	WaitForSingleObject(thread->handle, INFINITE);
+	CloseHandle(thread->handle);
+}
+#elif defined(THREAD_PTHREAD)
+static void* thread_main(void* arg) {
+	lazybiosThread* thread = arg;
+	thread->fn(thread->arg);
+	return NULL;
+}
+
+unsigned lazybiosCPUCount(void) {
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (unsigned)n : 1;
+}
+
+static int thread_create(lazybiosThread* thread) {
+	return pthread_create(&thread->handle, NULL, thread_main, thread) == 0 ? 0 : -1;
+}
+
+static void thread_wait(lazybiosThread* thread) {
+	pthread_join(thread->handle, NULL);
+}
+#else
+unsigned lazybiosCPUCount(void) {
+	return 1;
+}
+
+static int thread_create(lazybiosThread* thread) {
+	(void)thread;
+	return -1;
+}
+
+static void thread_wait(lazybiosThread* thread) {
+	(void)thread;
+}
+#endif
+
+lazybiosThread* lazybiosThreadStart(void (*fn)(void* arg), void* arg) {
+	lazybiosThread* thread = lazybiosCalloc(1, sizeof(*thread));
+	if (!thread) return NULL;
+
+	thread->fn = fn;
+	thread->arg = arg;
+	if (thread_create(thread) != 0) {
+		lazybiosFree(thread);
+		return NULL;
+	}
+	return thread;
+}
+
+void lazybiosThreadJoin(lazybiosThread* thread) {
+	if (!thread) return;
+	thread_wait(thread);
+	lazybiosFree(thread);
+}
@@ -22,11 +22,17 @@
  */
 
 #include "lazybios_internal.h"
+#include "lazybios/json/cJSON.h"
 
+#include <errno.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if !defined(_WIN32)
+#include <pthread.h>
+#include <sys/stat.h>
+#endif
 
 #define CHECK(condition) do { \
 	if (!(condition)) { \
@@ -238,6 +244,709 @@ static int test_type0_type1_counts(void) {
 	return 0;
 }
 
+static int test_structure_index(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/* Type 11, two Type 17s, the end marker, and a Type 17 past the end. */
+	const uint8_t table[] = {
+		11, 5, 0x00, 0x01, 1, 'o', 'e', 'm', 0, 0,
+		17, 0x12, 0x10, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		17, 0x12, 0x11, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '1', 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0,
+		17, 0x12, 0x12, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'X', 0, 0
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	CHECK(ctx->DMIData->index != NULL);
+	CHECK(ctx->DMIData->index->count == 3);
+	CHECK(ctx->DMIData->index->entries[1].handle == 0x0110);
+	CHECK(ctx->DMIData->index->entries[1].offset == 10);
+	CHECK(ctx->DMIData->index->entries[1].next == 32);
+	CHECK(lazybiosCountStructsByType(ctx->DMIData, SMBIOS_TYPE_MEMORY_DEVICE) == 2);
+	CHECK(lazybiosCountStructsByType(ctx->DMIData, SMBIOS_TYPE_END) == 0);
+
+	/* The same table without an index must parse identically. */
+	lazybiosDMI_t walked = *ctx->DMIData;
+	walked.index = NULL;
+	CHECK(lazybiosCountStructsByType(&walked, SMBIOS_TYPE_MEMORY_DEVICE) == 2);
+
+	size_t indexed_count = 0;
+	size_t walked_count = 0;
+	lazybiosType17_t* indexed = lazybiosGetType17(NULL, &indexed_count, ctx->DMIData);
+	lazybiosType17_t* plain = lazybiosGetType17(NULL, &walked_count, &walked);
+	CHECK(indexed != NULL && plain != NULL);
+	CHECK(indexed_count == 2 && walked_count == 2);
+	for (size_t i = 0; i < 2; i++) {
+		CHECK(indexed[i].device_locator && plain[i].device_locator);
+		CHECK(strcmp(indexed[i].device_locator, plain[i].device_locator) == 0);
+	}
+	CHECK(strcmp(indexed[1].device_locator, "A1") == 0);
+	lazybiosFreeType17(indexed, indexed_count);
+	lazybiosFreeType17(plain, walked_count);
+
+	CHECK(lazybiosCleanup(ctx) == 0);
+	return 0;
+}
+
+static int test_string_slots(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/*
+	 * Three strings, no strings, a leading empty string, and a final
+	 * structure whose string-set runs off the end of the table.
+	 */
+	const uint8_t table[] = {
+		11, 5, 0x00, 0x00, 3, 'a', 0, 'b', 'c', 0, 'd', 0, 0,
+		11, 5, 0x01, 0x00, 0, 0, 0,
+		11, 5, 0x02, 0x00, 1, 0, 'x', 0, 0,
+		11, 5, 0x03, 0x00, 1, 'y', 0, 'z'
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	CHECK(ctx->DMIData->index != NULL);
+
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, ctx->DMIData, SMBIOS_TYPE_OEM_STRINGS);
+	size_t structures = 0;
+	while (lazybiosStructCursorNext(&cursor)) {
+		CHECK(cursor.entry != NULL);
+		for (unsigned n = 0; n <= UINT8_MAX; n++) {
+			const char* slot = lazybiosStructCursorString(&cursor, (uint8_t)n);
+			const char* scanned = DMIString(cursor.p, cursor.length, (uint8_t)n, cursor.structure_end);
+			CHECK(slot == scanned);
+		}
+		structures++;
+	}
+	CHECK(structures == 4);
+
+	lazybiosStructCursorInit(&cursor, ctx->DMIData, SMBIOS_TYPE_OEM_STRINGS);
+	CHECK(lazybiosStructCursorNext(&cursor));
+	CHECK(cursor.entry->string_count == 3);
+	CHECK(strcmp(lazybiosStructCursorString(&cursor, 2), "bc") == 0);
+
+	CHECK(lazybiosCleanup(ctx) == 0);
+	return 0;
+}
+
+static int test_find_by_handle(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/* A Type 17 referencing a Type 16 through sparse handles, then dense ones. */
+	const uint8_t sparse[] = {
+		17, 0x12, 0x00, 0xDA, 0x00, 0x10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		16, 0x0F, 0x00, 0x10, 3, 3, 3, 0, 0, 0, 0, 0xFE, 0xFF, 2, 0,
+		0, 0,
+		17, 0x12, 0x00, 0xDA, 0x00, 0x10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'D', 'u', 'p', 0, 0
+	};
+	const uint8_t dense[] = {
+		11, 5, 0x00, 0x00, 0, 0, 0,
+		11, 5, 0x01, 0x00, 0, 0, 0
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), sparse, sizeof(sparse)) == 0);
+	CHECK(ctx->DMIData->index != NULL);
+	CHECK(ctx->DMIData->index->handles_hashed);
+
+	lazybiosHandleRef_t ref;
+	CHECK(lazybiosFindByHandle(ctx, 0x1000, &ref) == 0);
+	CHECK(ref.type == SMBIOS_TYPE_PHYSICAL_MEMORY_ARRAY);
+	CHECK(ref.length == 0x0F);
+	CHECK(ref.raw == ctx->DMIData->dmi_data + 22);
+	CHECK(ref.record == NULL);
+	CHECK(lazybiosFindByHandle(ctx, 0x1001, &ref) == -1);
+
+	ctx->Type16 = lazybiosGetType16(NULL, &ctx->type16_count, ctx->DMIData);
+	ctx->Type17 = lazybiosGetType17(NULL, &ctx->type17_count, ctx->DMIData);
+	CHECK(ctx->Type16 != NULL && ctx->Type17 != NULL);
+	CHECK(ctx->Type17[0].handle == 0xDA00 && ctx->Type17[1].handle == 0xDA00);
+
+	/* Follow the memory device's array handle; duplicated handles resolve to the first. */
+	CHECK(lazybiosFindByHandle(ctx, ctx->Type17[0].physical_memory_array_handle, &ref) == 0);
+	CHECK(ref.record == &ctx->Type16[0]);
+	CHECK(lazybiosFindByHandle(ctx, 0xDA00, &ref) == 0);
+	CHECK(ref.record == &ctx->Type17[0]);
+
+	/* Without an index the table is walked and resolves to the same records. */
+	lazybiosDMIIndex_t* index = ctx->DMIData->index;
+	ctx->DMIData->index = NULL;
+	CHECK(lazybiosFindByHandle(ctx, 0x1000, &ref) == 0);
+	CHECK(ref.record == &ctx->Type16[0]);
+	CHECK(lazybiosFindByHandle(ctx, 0xDA00, &ref) == 0);
+	CHECK(ref.record == &ctx->Type17[0]);
+	ctx->DMIData->index = index;
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), dense, sizeof(dense)) == 0);
+	CHECK(!ctx->DMIData->index->handles_hashed);
+	CHECK(lazybiosFindByHandle(ctx, 0x0001, &ref) == 0);
+	CHECK(ref.raw == ctx->DMIData->dmi_data + 7);
+	CHECK(lazybiosFindByHandle(ctx, 0x0002, &ref) == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	return 0;
+}
+
+static int test_double_nul_scan(void) {
+	uint8_t buffer[160];
+
+	/*
+	 * Sweep one pair, a lone NUL just before it, and every start offset so
+	 * each vector width meets the terminator in its body and in its tail.
+	 */
+	for (size_t pair = 0; pair + 1 < sizeof(buffer); pair++) {
+		memset(buffer, 'x', sizeof(buffer));
+		buffer[pair] = 0;
+		buffer[pair + 1] = 0;
+		if (pair >= 2) buffer[pair - 2] = 0;
+
+		for (size_t start = 0; start < 40 && start < sizeof(buffer); start++) {
+			for (size_t trim = 0; trim < 3; trim++) {
+				const uint8_t* end = buffer + sizeof(buffer) - trim;
+				CHECK(lazybiosFindDoubleNul(buffer + start, end) ==
+					lazybiosFindDoubleNulScalar(buffer + start, end));
+			}
+		}
+	}
+
+	memset(buffer, 'x', sizeof(buffer));
+	buffer[sizeof(buffer) - 1] = 0;
+	CHECK(lazybiosFindDoubleNul(buffer, buffer + sizeof(buffer)) == NULL);
+	CHECK(lazybiosFindDoubleNul(buffer, buffer) == NULL);
+	return 0;
+}
+
+static int test_parse_all(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/* Two Type 17s around a Type 11 and an OEM Type 177, then the end marker. */
+	const uint8_t table[] = {
+		17, 0x12, 0x10, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		11, 5, 0x00, 0x01, 1, 'o', 'e', 'm', 0, 0,
+		177, 0x0C, 0x20, 0x01, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0,
+		17, 0x12, 0x11, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '1', 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	for (int indexed = 0; indexed < 2; indexed++) {
+		lazybiosCTX_t* ctx = lazybiosCTXNew();
+		CHECK(ctx != NULL);
+		CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+		lazybiosDMIIndex_t* index = ctx->DMIData->index;
+		if (!indexed) ctx->DMIData->index = NULL;
+
+		/* An array the caller already holds is kept as it is. */
+		size_t held_count = 0;
+		ctx->Type11 = lazybiosGetType11(NULL, &held_count, ctx->DMIData);
+		ctx->type11_count = held_count;
+		lazybiosType11_t* held = ctx->Type11;
+
+		CHECK(lazybiosParseAll(ctx, 0) == 0);
+		CHECK(ctx->Type11 == held && ctx->type11_count == 1);
+		CHECK(ctx->type17_count == 2);
+		CHECK(ctx->Type17[0].handle == 0x0110 && ctx->Type17[1].handle == 0x0111);
+		CHECK(strcmp(ctx->Type17[1].device_locator, "A1") == 0);
+		CHECK(lazybiosArenaOwns(ctx->arena, ctx->Type17));
+		CHECK(!lazybiosArenaOwns(ctx->arena, held));
+		CHECK(ctx->Type0 == NULL && ctx->type0_count == 0);
+		CHECK(ctx->DellType177 == NULL);
+
+		size_t walked_count = 0;
+		lazybiosType17_t* walked = lazybiosGetType17(NULL, &walked_count, ctx->DMIData);
+		CHECK(walked != NULL && walked_count == ctx->type17_count);
+		for (size_t i = 0; i < walked_count; i++) {
+			CHECK(strcmp(walked[i].device_locator, ctx->Type17[i].device_locator) == 0);
+			CHECK(memcmp(&walked[i].field_status, &ctx->Type17[i].field_status,
+				sizeof(walked[i].field_status)) == 0);
+		}
+		lazybiosFreeType17(walked, walked_count);
+
+		CHECK(lazybiosParseAll(ctx, LAZYBIOS_PARSE_OEM) == 0);
+		CHECK(ctx->delltype177_count == 1 && ctx->DellType177[0].handle == 0x0120);
+
+		ctx->DMIData->index = index;
+		CHECK(lazybiosCleanup(ctx) == 0);
+	}
+	return 0;
+}
+
+static int test_ctx_get_type(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	const uint8_t table[] = {
+		17, 0x12, 0x10, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		17, 0x12, 0x11, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '1', 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+
+	size_t count = 0;
+	lazybiosType17_t* devices = lazybiosCTXGetType17(ctx, &count);
+	CHECK(devices != NULL && count == 2);
+	CHECK(devices == ctx->Type17 && ctx->type17_count == 2);
+	CHECK(strcmp(devices[1].device_locator, "A1") == 0);
+
+	/* Later calls return the cached array, even after the table changes. */
+	ctx->DMIData->dmi_data[18] = 'Z';
+	CHECK(lazybiosCTXGetType(ctx, SMBIOS_TYPE_MEMORY_DEVICE, &count) == devices && count == 2);
+	CHECK(devices[0].device_locator[0] == 'Z');
+
+	/* A missing type is remembered as parsed and empty. */
+	CHECK(lazybiosCTXGetType1(ctx, &count) == NULL && count == 0);
+	CHECK(ctx->parsed_types[0] & (UINT64_C(1) << SMBIOS_TYPE_SYSTEM));
+	CHECK(lazybiosCTXGetType(ctx, 100, &count) == NULL && count == 0);
+
+	/* lazybiosParseAll leaves cached types alone. */
+	CHECK(lazybiosParseAll(ctx, 0) == 0);
+	CHECK(ctx->Type17 == devices);
+
+	CHECK(lazybiosCleanup(ctx) == 0);
+	return 0;
+}
+
+static int test_byte_views(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/* A Type 32 with two bytes of additional data, then the end marker. */
+	const uint8_t table[] = {
+		32, 0x0D, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 7, 0xAB, 0xCD,
+		0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+
+	size_t count = 0;
+	lazybiosType32_t* boot = lazybiosCTXGetType32(ctx, &count);
+	CHECK(boot != NULL && count == 1);
+	CHECK(LAZYBIOS_FIELD_STATUS(boot, additional_data) == LAZYBIOS_FIELD_PRESENT);
+	CHECK(boot->additional_data.len == 2);
+	CHECK(boot->additional_data.ptr == ctx->DMIData->dmi_data + 11);
+
+	uint8_t* copy = lazybiosBytesCopy(boot->additional_data);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(copy != NULL && copy[0] == 0xAB && copy[1] == 0xCD);
+	free(copy);
+
+	lazybiosBytes_t empty = {NULL, 0};
+	CHECK(lazybiosBytesCopy(empty) == NULL);
+	return 0;
+}
+
+static int test_iterator(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/* Two Type 14 groups around a Type 32, then the end marker. */
+	const uint8_t table[] = {
+		14, 0x0B, 0x40, 0x00, 1, 0x11, 0x20, 0x00, 0x11, 0x21, 0x00, 'G', 'r', 'p', 0, 0,
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		14, 0x08, 0x41, 0x00, 0, 0x04, 0x30, 0x00, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	lazybiosIter_t it;
+	CHECK(lazybiosIterBegin(&it, NULL, LAZYBIOS_ITER_ALL_TYPES) == -1);
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosIterBegin(&it, ctx, LAZYBIOS_ITER_ALL_TYPES) == -1);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	CHECK(lazybiosIterBegin(&it, ctx, 256) == -1);
+	CHECK(lazybiosIterBegin(&it, ctx, -2) == -1);
+
+	size_t seen = 0;
+	CHECK(lazybiosIterBegin(&it, ctx, LAZYBIOS_ITER_ALL_TYPES) == 0);
+	while (lazybiosIterNext(&it)) seen++;
+	CHECK(seen == 3);
+	CHECK(lazybiosIterNext(&it) == 0);
+
+	CHECK(lazybiosIterBegin(&it, ctx, 14) == 0);
+	CHECK(lazybiosIterNext(&it) == 1);
+	CHECK(it.type == 14 && it.length == 0x0B && it.handle == 0x0040);
+	CHECK(it.header == ctx->DMIData->dmi_data && it.size == 16);
+
+	const lazybiosType14_t* group = lazybiosIterRecord(&it);
+	CHECK(group != NULL && group == lazybiosIterRecord(&it));
+	CHECK(group->handle == 0x0040 && strcmp(group->group_name, "Grp") == 0);
+	CHECK(group->item_count == 2 && group->items != NULL);
+	CHECK(group->items[0].item_handle == 0x0020 && group->items[1].item_handle == 0x0021);
+	CHECK(ctx->arena == NULL);
+
+	CHECK(lazybiosIterNext(&it) == 1);
+	group = lazybiosIterRecord(&it);
+	CHECK(group != NULL && group->handle == 0x0041);
+	CHECK(group->item_count == 1 && group->items[0].item_type == 0x04);
+	CHECK(lazybiosIterNext(&it) == 0);
+	CHECK(lazybiosIterRecord(&it) == NULL);
+
+	CHECK(lazybiosIterBegin(&it, ctx, 32) == 0);
+	CHECK(lazybiosIterNext(&it) == 1 && it.handle == 0x0020);
+	const lazybiosType32_t* boot = lazybiosIterRecord(&it);
+	CHECK(boot != NULL && boot->handle == 0x0020);
+	CHECK(lazybiosIterNext(&it) == 0);
+
+	CHECK(lazybiosCleanup(ctx) == 0);
+	return 0;
+}
+
+typedef struct {
+	size_t groups;
+	size_t boots;
+	size_t items;
+	size_t stop_after;
+} visit_tally;
+
+static int tally_visit(const lazybiosIter_t* it, const void* record, void* user) {
+	visit_tally* tally = user;
+	if (it->type == 14) {
+		tally->groups++;
+		tally->items += ((const lazybiosType14_t*)record)->item_count;
+	} else if (it->type == 32) {
+		tally->boots++;
+	}
+	return tally->stop_after && tally->groups + tally->boots == tally->stop_after ? 7 : 0;
+}
+
+static int test_for_each(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	const uint8_t table[] = {
+		14, 0x08, 0x40, 0x00, 0, 0x11, 0x20, 0x00, 0, 0,
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0x08, 0x01, 0x00, 0, 0, 0, 0, 0, 0,
+		14, 0x0B, 0x41, 0x00, 0, 0x04, 0x30, 0x00, 0x04, 0x31, 0x00, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+
+	uint64_t mask[4] = {0};
+	LAZYBIOS_TYPE_MASK_SET(mask, 14);
+	LAZYBIOS_TYPE_MASK_SET(mask, 32);
+
+	visit_tally tally = {0};
+	CHECK(lazybiosForEach(ctx, mask, NULL, &tally) == -1);
+	CHECK(lazybiosForEach(NULL, mask, tally_visit, &tally) == -1);
+	CHECK(lazybiosForEach(ctx, mask, tally_visit, &tally) == 0);
+	CHECK(tally.groups == 2 && tally.boots == 1 && tally.items == 3);
+
+	memset(&tally, 0, sizeof(tally));
+	tally.stop_after = 2;
+	CHECK(lazybiosForEach(ctx, mask, tally_visit, &tally) == 7);
+	CHECK(tally.groups == 1 && tally.boots == 1);
+
+	memset(&tally, 0, sizeof(tally));
+	CHECK(lazybiosForEach(ctx, NULL, tally_visit, &tally) == 0);
+	CHECK(tally.groups == 2 && tally.boots == 1);
+
+	CHECK(lazybiosCleanup(ctx) == 0);
+	return 0;
+}
+
+static int test_stream(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	const uint8_t table[] = {
+		14, 0x08, 0x40, 0x00, 1, 0x11, 0x20, 0x00, 'G', 0, 0,
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		14, 0x0B, 0x41, 0x00, 0, 0x04, 0x30, 0x00, 0x04, 0x31, 0x00, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0,
+		1, 0x08, 0x01, 0x00, 0, 0, 0, 0, 0, 0
+	};
+
+	CHECK(lazybiosStreamNew(entry, sizeof(entry), NULL, NULL) == NULL);
+	CHECK(lazybiosStreamNew(entry, 4, tally_visit, NULL) == NULL);
+
+	/* Every chunk size must yield the same structures, including one byte at a time. */
+	for (size_t chunk = 1; chunk <= sizeof(table); chunk++) {
+		visit_tally tally = {0};
+		lazybiosStream_t* stream = lazybiosStreamNew(entry, sizeof(entry), tally_visit, &tally);
+		CHECK(stream != NULL);
+
+		int rc = 0;
+		size_t offset = 0;
+		while (rc == 0 && offset < sizeof(table)) {
+			size_t n = sizeof(table) - offset < chunk ? sizeof(table) - offset : chunk;
+			rc = lazybiosStreamFeed(stream, table + offset, n);
+			offset += n;
+		}
+		CHECK(rc == 1);
+		CHECK(tally.groups == 2 && tally.boots == 1 && tally.items == 3);
+		CHECK(lazybiosStreamFeed(stream, table, sizeof(table)) == 1);
+		lazybiosStreamFree(stream);
+	}
+
+	visit_tally tally = {0};
+	tally.stop_after = 1;
+	lazybiosStream_t* stream = lazybiosStreamNew(entry, sizeof(entry), tally_visit, &tally);
+	CHECK(stream != NULL);
+	CHECK(lazybiosStreamFeed(stream, table, 11) == 1);
+	CHECK(tally.groups == 1 && tally.boots == 0);
+	lazybiosStreamFree(stream);
+
+	const uint8_t short_header[] = {1, 2, 0, 0, 0, 0};
+	stream = lazybiosStreamNew(entry, sizeof(entry), tally_visit, &tally);
+	CHECK(stream != NULL);
+	CHECK(lazybiosStreamFeed(stream, short_header, sizeof(short_header)) == -1);
+	CHECK(lazybiosStreamFeed(stream, table, sizeof(table)) == -1);
+	lazybiosStreamFree(stream);
+
+	/* A string-set that never terminates cannot outgrow the stream's buffer. */
+	uint8_t unterminated[LAZYBIOS_STREAM_MAX_STRUCTURE + 64];
+	memset(unterminated, 'x', sizeof(unterminated));
+	unterminated[0] = 1;
+	unterminated[1] = 4;
+	stream = lazybiosStreamNew(entry, sizeof(entry), tally_visit, &tally);
+	CHECK(stream != NULL);
+	CHECK(lazybiosStreamFeed(stream, unterminated, 64) == 0);
+	CHECK(lazybiosStreamFeed(stream, unterminated + 64, sizeof(unterminated) - 64) == -1);
+	lazybiosStreamFree(stream);
+	lazybiosStreamFree(NULL);
+	return 0;
+}
+
+static int test_arena(void) {
+	lazybiosArena_t* arena = lazybiosArenaNew(NULL, 16);
+	CHECK(arena != NULL);
+
+	uint8_t* small = lazybiosArenaAlloc(arena, 3, 1);
+	uint64_t* words = lazybiosArenaAlloc(arena, 4, sizeof(uint64_t));
+	CHECK(small != NULL && words != NULL);
+	CHECK((uintptr_t)words % sizeof(uint64_t) == 0);
+	CHECK(small[0] == 0 && words[3] == 0);
+
+	/* Requests past the chunk size get a chunk of their own. */
+	uint8_t* large = lazybiosArenaAlloc(arena, 1, 64 * 1024);
+	CHECK(large != NULL && large[64 * 1024 - 1] == 0);
+	CHECK(lazybiosArenaOwns(arena, large + 100) && lazybiosArenaOwns(arena, words));
+	CHECK(lazybiosArenaAlloc(arena, 0, 8) != NULL);
+	CHECK(lazybiosArenaAlloc(arena, SIZE_MAX, 2) == NULL);
+
+	int outside = 0;
+	CHECK(!lazybiosArenaOwns(arena, &outside));
+	CHECK(!lazybiosArenaOwns(NULL, small));
+
+	lazybiosArenaFree(arena);
+	lazybiosArenaFree(NULL);
+	return 0;
+}
+
+typedef struct {
+	size_t allocs;
+	size_t frees;
+} alloc_counter;
+
+static void* counting_alloc(size_t size, void* user) {
+	((alloc_counter*)user)->allocs++;
+	return malloc(size);
+}
+
+static void counting_free(void* ptr, void* user) {
+	((alloc_counter*)user)->frees++;
+	free(ptr);
+}
+
+#if !defined(_WIN32)
+/* Hooks that are not thread-safe: they count their calls, and those from any thread but the one that installed them. */
+typedef struct {
+	pthread_t owner;
+	size_t calls;
+	volatile size_t foreign;
+} owner_hooks;
+
+static void owner_hooks_init(owner_hooks* hooks) {
+	hooks->owner = pthread_self();
+	hooks->calls = 0;
+	hooks->foreign = 0;
+}
+
+static void* owner_alloc(size_t size, void* user) {
+	owner_hooks* hooks = user;
+	if (pthread_equal(pthread_self(), hooks->owner)) hooks->calls++;
+	else hooks->foreign++;
+	return malloc(size);
+}
+
+static void owner_free(void* ptr, void* user) {
+	owner_hooks* hooks = user;
+	if (pthread_equal(pthread_self(), hooks->owner)) hooks->calls++;
+	else hooks->foreign++;
+	free(ptr);
+}
+#endif
+
+static int test_allocator_hooks(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	const uint8_t table[] = {
+		17, 0x12, 0x10, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	CHECK(lazybiosSetAllocator(NULL, counting_alloc, NULL, NULL) == -1);
+
+	/* Context hooks serve the table copies, index and arena. */
+	alloc_counter local = {0, 0};
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosSetAllocator(ctx, counting_alloc, counting_free, &local) == 0);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	CHECK(lazybiosSetAllocator(ctx, NULL, NULL, NULL) == -1);
+	CHECK(lazybiosParseAll(ctx, 0) == 0 && ctx->type17_count == 1);
+	CHECK(local.allocs > 0);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(local.allocs == local.frees);
+
+	/* Global hooks serve new contexts, the getters and cJSON. */
+	alloc_counter global = {0, 0};
+	CHECK(lazybiosSetAllocator(NULL, counting_alloc, counting_free, &global) == 0);
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	size_t count = 0;
+	lazybiosType17_t* devices = lazybiosGetType17(NULL, &count, ctx->DMIData);
+	CHECK(devices != NULL && count == 1);
+	lazybiosFreeType17(devices, count);
+	cJSON* object = cJSON_CreateObject();
+	CHECK(object != NULL);
+	cJSON_Delete(object);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(lazybiosSetAllocator(NULL, NULL, NULL, NULL) == 0);
+	CHECK(global.allocs > 0 && global.allocs == global.frees);
+	return 0;
+}
+
+static int test_snapshot(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	const uint8_t table[] = {
+		17, 0x12, 0x10, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	CHECK(lazybiosSnapshotNew(NULL) == NULL);
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosSnapshotNew(ctx) == NULL);
+
+	alloc_counter local = {0, 0};
+	CHECK(lazybiosSetAllocator(ctx, counting_alloc, counting_free, &local) == 0);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	lazybiosSnapshot_t* snapshot = lazybiosSnapshotNew(ctx);
+	CHECK(snapshot != NULL && lazybiosSnapshotCTX(snapshot) == ctx);
+
+	/* Everything, OEM types and absent types included, is parsed before sharing. */
+	for (unsigned t = 0; t < 256; t++) {
+		if (lazybiosTypeTable[t].decode)
+			CHECK(ctx->parsed_types[t / 64] & (UINT64_C(1) << (t % 64)));
+	}
+	size_t count = 0;
+	const lazybiosType17_t* devices = lazybiosSnapshotGetType(snapshot, SMBIOS_TYPE_MEMORY_DEVICE, &count);
+	CHECK(devices == ctx->Type17 && count == 1);
+	CHECK(strcmp(devices[0].device_locator, "A0") == 0);
+	CHECK(lazybiosSnapshotGetType(snapshot, SMBIOS_OEM_DELL_TYPE177, &count) == NULL && count == 0);
+	CHECK(lazybiosSnapshotGetType(NULL, SMBIOS_TYPE_MEMORY_DEVICE, &count) == NULL && count == 0);
+
+	/* The last of three references releases the context and the snapshot. */
+	size_t allocs = local.allocs;
+	CHECK(lazybiosSnapshotRetain(snapshot) == snapshot);
+	CHECK(lazybiosSnapshotRetain(snapshot) == snapshot);
+	lazybiosSnapshotRelease(snapshot);
+	lazybiosSnapshotRelease(snapshot);
+	CHECK(lazybiosSnapshotGetType(snapshot, SMBIOS_TYPE_MEMORY_DEVICE, &count) == devices);
+	CHECK(local.allocs == allocs && local.frees == 0);
+	lazybiosSnapshotRelease(snapshot);
+	CHECK(local.allocs == local.frees);
+
+	CHECK(lazybiosSnapshotRetain(NULL) == NULL);
+	lazybiosSnapshotRelease(NULL);
+	CHECK(lazybiosSnapshotCTX(NULL) == NULL);
+	return 0;
+}
+
+static int test_field_descriptors(void) {
+	/* Every table stays inside its record and reads no wider than the member. */
+	for (size_t type = 0; type < 256; type++) {
+		const lazybiosTypeInfo* info = &lazybiosTypeTable[type];
+		if (!info->decode) continue;
+		CHECK(info->fields != NULL);
+		for (const lazybiosFieldDesc* field = info->fields; field->name; field++) {
+			CHECK(field->record + field->size <= info->size);
+			CHECK(field->status + (field->index / 32 + 1) * sizeof(uint64_t) <= info->size);
+			CHECK(field->kind == LAZYBIOS_FIELD_STRING ? field->size == sizeof(char*) : field->width <= field->size);
+		}
+	}
+
+	/* A 2.3 table: 2.6+ fields are unreachable, and fields past the length are absent. */
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 2, 3, 0);
+	uint8_t table[] = {
+		17, 0x18, 0x20, 0x00, 0x34, 0x12, 0xFE, 0xFF, 0x48, 0x00, 0x40, 0x00,
+		0x00, 0x40, 0x09, 0x00, 1, 2, 0x1A, 0x80, 0x00, 0x80, 0x0C, 3,
+		'D', 0, 'B', 0, 'M', 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+	lazybiosDMI_t dmi = {
+		.dmi_data = table,
+		.dmi_len = sizeof(table)
+	};
+	lazybiosCTX_t ctx = {.DMIData = &dmi};
+	CHECK(lazybiosParseEntry(&ctx, entry, sizeof(entry)) == 0);
+
+	lazybiosStructCursor cursor;
+	lazybiosStructCursorInit(&cursor, &dmi, SMBIOS_TYPE_MEMORY_DEVICE);
+	CHECK(lazybiosStructCursorNext(&cursor));
+	lazybiosType17_t device = {0};
+	CHECK(lazybiosDecodeType17(&device, &cursor) == 0);
+
+	CHECK(device.physical_memory_array_handle == 0x1234);
+	CHECK(LAZYBIOS_FIELD_STATUS(&device, memory_error_information_handle) == LAZYBIOS_FIELD_ABSENT);
+	CHECK(device.total_width == 72 && device.size == 0x4000 && device.memory_type == 0x1A);
+	CHECK(strcmp(device.bank_locator, "B") == 0);
+	CHECK(device.speed == 3200 && LAZYBIOS_FIELD_STATUS(&device, speed) == LAZYBIOS_FIELD_PRESENT);
+	CHECK(strcmp(device.manufacturer, "M") == 0);
+	CHECK(device.serial_number == NULL && LAZYBIOS_FIELD_STATUS(&device, serial_number) == LAZYBIOS_FIELD_ABSENT);
+	CHECK(LAZYBIOS_FIELD_STATUS(&device, attributes) == LAZYBIOS_FIELD_UNREACHABLE);
+	CHECK(LAZYBIOS_FIELD_STATUS(&device, rcd_revision_number) == LAZYBIOS_FIELD_UNREACHABLE);
+	return 0;
+}
+
 static int test_numeric_decoders(void) {
 	CHECK(lazybiosType7CacheU16(0x0001) == 1);
 	CHECK(lazybiosType7CacheU16(0x8001) == 64);
@@ -257,11 +966,11 @@ static int test_numeric_decoders(void) {
 	controls.next_scheduled_power_on_hour = 0x23;
 	controls.next_scheduled_power_on_minute = 0x59;
 	controls.next_scheduled_power_on_second = 0x58;
-	controls.field_status.next_scheduled_power_on_month = LAZYBIOS_FIELD_PRESENT;
-	controls.field_status.next_scheduled_power_on_day = LAZYBIOS_FIELD_PRESENT;
-	controls.field_status.next_scheduled_power_on_hour = LAZYBIOS_FIELD_PRESENT;
-	controls.field_status.next_scheduled_power_on_minute = LAZYBIOS_FIELD_PRESENT;
-	controls.field_status.next_scheduled_power_on_second = LAZYBIOS_FIELD_PRESENT;
+	LAZYBIOS_SET_FIELD_STATUS(&controls, next_scheduled_power_on_month, LAZYBIOS_FIELD_PRESENT);
+	LAZYBIOS_SET_FIELD_STATUS(&controls, next_scheduled_power_on_day, LAZYBIOS_FIELD_PRESENT);
+	LAZYBIOS_SET_FIELD_STATUS(&controls, next_scheduled_power_on_hour, LAZYBIOS_FIELD_PRESENT);
+	LAZYBIOS_SET_FIELD_STATUS(&controls, next_scheduled_power_on_minute, LAZYBIOS_FIELD_PRESENT);
+	LAZYBIOS_SET_FIELD_STATUS(&controls, next_scheduled_power_on_second, LAZYBIOS_FIELD_PRESENT);
 	char decoded[32];
 	lazybiosType25NextScheduledPowerOnStr(&controls, decoded, sizeof(decoded));
 	CHECK(strcmp(decoded, "12-31 23:59:58") == 0);
@@ -398,6 +1107,697 @@ static int test_backend_transformations(void) {
 	return 0;
 }
 
+/* Writes a 0x22-byte Type 17 with an optional manufacturer string; returns its size. */
+static size_t put_memory_device(uint8_t* out, uint16_t handle, uint16_t size, uint16_t speed, const char* manufacturer) {
+	memset(out, 0, 0x22);
+	out[0] = 17;
+	out[1] = 0x22;
+	put_u16_le(out + 2, handle);
+	put_u16_le(out + 0x0C, size);
+	out[0x12] = 0x1A;
+	put_u16_le(out + 0x15, speed);
+	out[0x17] = manufacturer ? 1 : 0;
+	put_u16_le(out + 0x20, speed);
+
+	size_t len = 0x22;
+	if (manufacturer) {
+		size_t name = strlen(manufacturer) + 1;
+		memcpy(out + len, manufacturer, name);
+		len += name;
+	} else {
+		out[len++] = 0;
+	}
+	out[len++] = 0;
+	return len;
+}
+
+static int test_columns(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	lazybiosType17Columns_t memory = {0};
+	lazybiosType4Columns_t cpus = {0};
+	CHECK(lazybiosColumnsType17(&memory, NULL) == -1);
+	CHECK(memory.count == 0 && memory.appends == 0);
+
+	/* Two hosts: the second adds a new manufacturer and a device without one. */
+	for (int host = 0; host < 2; host++) {
+		uint8_t table[512];
+		size_t len = 0;
+		len += put_memory_device(table + len, 0x1100, 0x4000, 4800, "Acme");
+		if (host == 1) {
+			len += put_memory_device(table + len, 0x1101, 0x2000, 5600, "Zeta");
+			len += put_memory_device(table + len, 0x1102, 0, 0, NULL);
+		}
+
+		uint8_t* cpu = table + len;
+		memset(cpu, 0, 0x30);
+		cpu[0] = 4;
+		cpu[1] = 0x30;
+		put_u16_le(cpu + 2, 0x0400);
+		cpu[0x23] = 0xFF;
+		cpu[0x24] = 0xFF;
+		cpu[0x25] = 0xFF;
+		put_u16_le(cpu + 0x2A, (uint16_t)(300 + host));
+		put_u16_le(cpu + 0x2C, 300);
+		put_u16_le(cpu + 0x2E, 600);
+		len += 0x30;
+		table[len++] = 0;
+		table[len++] = 0;
+
+		const uint8_t end[] = {127, 4, 0xFF, 0xFF, 0, 0};
+		memcpy(table + len, end, sizeof(end));
+		len += sizeof(end);
+
+		lazybiosCTX_t* ctx = lazybiosCTXNew();
+		CHECK(ctx != NULL);
+		CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, len) == 0);
+		CHECK(lazybiosColumnsType17(&memory, ctx) == 0);
+		CHECK(lazybiosColumnsType4(&cpus, ctx) == 0);
+		CHECK(lazybiosCleanup(ctx) == 0);
+	}
+
+	CHECK(memory.count == 4 && memory.appends == 2);
+	CHECK(memory.source[0] == 0 && memory.source[1] == 1 && memory.source[3] == 1);
+	CHECK(memory.handle[2] == 0x1101 && memory.size[2] == 0x2000 && memory.speed[2] == 5600);
+	CHECK(memory.memory_type[0] == 0x1A && memory.configured_memory_speed[1] == 4800);
+	CHECK(LAZYBIOS_COLUMN_PRESENT(memory.size_present, 0) && LAZYBIOS_COLUMN_PRESENT(memory.speed_present, 2));
+	CHECK(!LAZYBIOS_COLUMN_PRESENT(memory.manufacturer_present, 3));
+	CHECK(memory.manufacturer_name_count == 2);
+	CHECK(memory.manufacturer[0] == memory.manufacturer[1]);
+	CHECK(strcmp(memory.manufacturer_names[memory.manufacturer[0]], "Acme") == 0);
+	CHECK(strcmp(memory.manufacturer_names[memory.manufacturer[2]], "Zeta") == 0);
+
+	uint64_t total = 0;
+	for (size_t i = 0; i < memory.count; i++)
+		if (LAZYBIOS_COLUMN_PRESENT(memory.size_present, i)) total += memory.size[i];
+	CHECK(total == 0x4000 * 2 + 0x2000);
+
+	CHECK(cpus.count == 2 && cpus.appends == 2);
+	CHECK(cpus.core_count[0] == 0xFF && cpus.core_count_2[0] == 300 && cpus.core_count_2[1] == 301);
+	CHECK(cpus.thread_count_2[1] == 600 && LAZYBIOS_COLUMN_PRESENT(cpus.thread_count_2_present, 1));
+	CHECK(!LAZYBIOS_COLUMN_PRESENT(cpus.thread_enabled_present, 0));
+
+	lazybiosFreeColumnsType17(&memory);
+	lazybiosFreeColumnsType4(&cpus);
+	CHECK(memory.count == 0 && memory.size == NULL && cpus.capacity == 0);
+	lazybiosFreeColumnsType17(NULL);
+	return 0;
+}
+
+static int write_file(const char* path, const uint8_t* data, size_t len) {
+	FILE* f = fopen(path, "wb");
+	if (!f) return -1;
+	size_t written = len ? fwrite(data, 1, len, f) : 0;
+	return fclose(f) == 0 && written == len ? 0 : -1;
+}
+
+static int test_mapped_files(void) {
+	const char* merged_path = "lazybios_mapped_merged.bin";
+	const char* entry_path = "lazybios_mapped_entry.bin";
+	const char* table_path = "lazybios_mapped_table.bin";
+	const uint8_t table[] = {
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	/* A merged dump whose table sits at an advertised offset past some padding. */
+	uint8_t merged[32 + sizeof(table)] = {0};
+	make_entry3(merged, 3, 9, 0);
+	put_u32_le(merged + SMBIOS3_TABLE_MAX_SIZE_OFFSET, (uint32_t)sizeof(table));
+	put_u64_le(merged + SMBIOS3_TABLE_ADDRESS_OFFSET, 32);
+	set_checksum(merged, 0, SMBIOS3_ENTRY_POINT_LENGTH, SMBIOS3_CHECKSUM_OFFSET);
+	memcpy(merged + 32, table, sizeof(table));
+	CHECK(write_file(merged_path, merged, sizeof(merged)) == 0);
+	CHECK(write_file(entry_path, merged, SMBIOS3_ENTRY_POINT_LENGTH) == 0);
+	CHECK(write_file(table_path, table, sizeof(table)) == 0);
+
+	for (int mapped = 0; mapped < 2; mapped++) {
+		lazybiosCTX_t* ctx = lazybiosCTXNew();
+		CHECK(ctx != NULL);
+		CHECK((mapped ? lazybiosSingleFileMapped(ctx, merged_path) : lazybiosSingleFile(ctx, merged_path)) == 0);
+		CHECK(ctx->DMIData->dmi_len == sizeof(table));
+		CHECK(memcmp(ctx->DMIData->dmi_data, table, sizeof(table)) == 0);
+		CHECK(lazybiosIsVersionPlus(ctx->DMIData, 3, 9));
+		if (mapped) {
+#if defined(__linux__)
+			CHECK(ctx->DMIData->mapping != NULL);
+#endif
+			/* Where the platform cannot map files the copy path is used instead. */
+			CHECK(ctx->DMIData->mapping == NULL ||
+				ctx->DMIData->dmi_data == (uint8_t*)ctx->DMIData->mapping + 32);
+		} else {
+			CHECK(ctx->DMIData->mapping == NULL);
+		}
+
+		size_t count = 0;
+		CHECK(lazybiosCTXGetType32(ctx, &count) != NULL && count == 1);
+		CHECK(lazybiosSingleFileMapped(ctx, merged_path) == -1);
+		CHECK(lazybiosCleanup(ctx) == 0);
+	}
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosFileMapped(ctx, entry_path, table_path) == 0);
+	CHECK(ctx->DMIData->mapping == NULL || ctx->DMIData->dmi_data == ctx->DMIData->mapping);
+	CHECK(ctx->DMIData->dmi_len == sizeof(table) && ctx->DMIData->dmi_data[0] == 32);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	/* An empty table file cannot be mapped and is rejected by the read path too. */
+	CHECK(write_file(table_path, table, 0) == 0);
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosFileMapped(ctx, entry_path, table_path) == -1);
+	CHECK(lazybiosSingleFileMapped(ctx, "lazybios_mapped_missing.bin") == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	remove(merged_path);
+	remove(entry_path);
+	remove(table_path);
+	return 0;
+}
+
+static void count_release(void* user) {
+	(*(int*)user)++;
+}
+
+static int test_borrowed_load(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+	const uint8_t table[] = {
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	int released = 0;
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadBorrowed(ctx, entry, sizeof(entry), table, sizeof(table), 0x80, count_release, &released) == -1);
+	CHECK(lazybiosLoadBorrowed(ctx, entry, sizeof(entry), table, sizeof(table), 0, count_release, &released) == 0);
+	CHECK(ctx->DMIData->dmi_data == table && ctx->DMIData->index != NULL);
+	CHECK(ctx->DMIData->entry_data != entry);
+	CHECK(lazybiosLoadBorrowed(ctx, entry, sizeof(entry), table, sizeof(table), 0, count_release, &released) == -1);
+
+	size_t count = 0;
+	lazybiosType32_t* boot = lazybiosCTXGetType32(ctx, &count);
+	CHECK(boot != NULL && count == 1 && boot->handle == 0x0020);
+	CHECK(released == 0);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(released == 1);
+
+	/* A rejected entry point leaves the table with the caller. */
+	uint8_t bad_entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	memset(bad_entry, 0, sizeof(bad_entry));
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadBorrowed(ctx, bad_entry, sizeof(bad_entry), table, sizeof(table), 0, count_release, &released) == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(released == 1);
+
+	uint8_t raw[8 + sizeof(table)] = {0, 3, 9, 0};
+	put_u32_le(raw + 4, (uint32_t)sizeof(table));
+	memcpy(raw + 8, table, sizeof(table));
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadWindowsRawBorrowed(ctx, raw, sizeof(raw), LAZYBIOS_LOAD_NO_INDEX, NULL, NULL) == 0);
+	CHECK(ctx->DMIData->dmi_data == raw + 8 && ctx->DMIData->index == NULL);
+	CHECK(ctx->DMIData->entry_tag == SMBIOS_VER_3X);
+	CHECK(lazybiosCTXGetType32(ctx, &count) != NULL && count == 1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadWindowsRawBorrowed(ctx, raw, 7, 0, count_release, &released) == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(released == 1);
+	return 0;
+}
+
+#if defined(OS_LINUX)
+static int test_linux_sysfs_loader(void) {
+	const char* entry_path = "lazybios_sysfs_entry.bin";
+	const char* table_path = "lazybios_sysfs_table.bin";
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+	const uint8_t table[] = {
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+	CHECK(write_file(entry_path, entry, sizeof(entry)) == 0);
+	CHECK(write_file(table_path, table, sizeof(table)) == 0);
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLinuxSysfs(ctx, entry_path, table_path) == 0);
+	CHECK(ctx->DMIData->entry_len == sizeof(entry) && ctx->DMIData->dmi_len == sizeof(table));
+	CHECK(memcmp(ctx->DMIData->dmi_data, table, sizeof(table)) == 0);
+	CHECK(ctx->DMIData->table_in_entry_block && !ctx->DMIData->table_borrowed);
+	CHECK(ctx->DMIData->dmi_data > ctx->DMIData->entry_data);
+	CHECK(lazybiosIsVersionPlus(ctx->DMIData, 3, 9));
+
+	size_t count = 0;
+	CHECK(lazybiosCTXGetType32(ctx, &count) != NULL && count == 1);
+	CHECK(lazybiosLinuxSysfs(ctx, entry_path, table_path) == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	/* Unsized or missing files are left to the stdio loader, untouched. */
+	CHECK(write_file(table_path, table, 0) == 0);
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLinuxSysfs(ctx, entry_path, table_path) == -1);
+	CHECK(lazybiosLinuxSysfs(ctx, entry_path, "lazybios_sysfs_missing.bin") == -1);
+	CHECK(ctx->DMIData->entry_data == NULL && ctx->DMIData->dmi_data == NULL);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	remove(entry_path);
+	remove(table_path);
+	return 0;
+}
+#endif
+
+#if !defined(_WIN32)
+static int test_physical_memory_loader(void) {
+	const char* path = "lazybios_physmem.bin";
+	const uint8_t table[] = {
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	/* A 3.x entry point whose table lies inside the scanned window. */
+	uint8_t image[0x12000 + sizeof(table)] = {0};
+	make_entry3(image + 0x100, 3, 9, 0);
+	put_u32_le(image + 0x100 + SMBIOS3_TABLE_MAX_SIZE_OFFSET, (uint32_t)sizeof(table));
+	put_u64_le(image + 0x100 + SMBIOS3_TABLE_ADDRESS_OFFSET, 0x400);
+	set_checksum(image + 0x100, 0, SMBIOS3_ENTRY_POINT_LENGTH, SMBIOS3_CHECKSUM_OFFSET);
+	memcpy(image + 0x400, table, sizeof(table));
+	CHECK(write_file(path, image, 0x800) == 0);
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadPhysicalMemory(ctx, path, 0) == 0);
+	CHECK(ctx->DMIData->entry_len == SMBIOS3_ENTRY_POINT_LENGTH && ctx->DMIData->dmi_len == sizeof(table));
+	CHECK(memcmp(ctx->DMIData->dmi_data, table, sizeof(table)) == 0);
+	CHECK(ctx->DMIData->table_in_entry_block && !ctx->DMIData->table_borrowed);
+	CHECK(ctx->DMIData->dmi_data == ctx->DMIData->entry_data + SMBIOS3_ENTRY_POINT_LENGTH);
+	CHECK(lazybiosIsVersionPlus(ctx->DMIData, 3, 9));
+	CHECK(lazybiosLoadPhysicalMemory(ctx, path, 0) == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	/* A garbled sysfs entry point leaves the context fresh for the memory scan that follows it. */
+	uint8_t garbled[SMBIOS3_ENTRY_POINT_LENGTH];
+	memset(garbled, 0x5A, sizeof(garbled));
+	CHECK(write_file("lazybios_physmem_entry", garbled, sizeof(garbled)) == 0);
+	CHECK(write_file("lazybios_physmem_dmi", table, sizeof(table)) == 0);
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosFile(ctx, "lazybios_physmem_entry", "lazybios_physmem_dmi") == -1);
+	CHECK(ctx->DMIData->entry_data == NULL && ctx->DMIData->dmi_data == NULL);
+	CHECK(lazybiosLoadPhysicalMemory(ctx, path, 0) == 0);
+	CHECK(ctx->DMIData->dmi_len == sizeof(table) && lazybiosIsVersionPlus(ctx->DMIData, 3, 9));
+	CHECK(lazybiosCleanup(ctx) == 0);
+	remove("lazybios_physmem_entry");
+	remove("lazybios_physmem_dmi");
+
+	/* A 2.x entry point found from a non-zero base, naming a table past the window. */
+	memset(image + 0x100, 0, SMBIOS3_ENTRY_POINT_LENGTH);
+	make_entry2(image + 0x110, 2, 8);
+	put_u16_le(image + 0x110 + SMBIOS2_TABLE_LENGTH_OFFSET, (uint16_t)sizeof(table));
+	put_u32_le(image + 0x110 + SMBIOS2_TABLE_ADDRESS_OFFSET, 0x12000);
+	set_checksum(image + 0x110, SMBIOS2_INTERMEDIATE_ANCHOR_OFFSET, SMBIOS2_ENTRY_POINT_LENGTH,
+		SMBIOS2_INTERMEDIATE_CHECKSUM_OFFSET);
+	set_checksum(image + 0x110, 0, SMBIOS2_ENTRY_POINT_LENGTH, SMBIOS2_CHECKSUM_OFFSET);
+	memcpy(image + 0x12000, table, sizeof(table));
+	CHECK(write_file(path, image, sizeof(image)) == 0);
+
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadPhysicalMemory(ctx, path, 0x10) == 0);
+	CHECK(ctx->DMIData->dmi_len == sizeof(table));
+	CHECK(memcmp(ctx->DMIData->dmi_data, table, sizeof(table)) == 0);
+	CHECK(lazybiosIsVersionPlus(ctx->DMIData, 2, 8));
+	size_t count = 0;
+	CHECK(lazybiosCTXGetType32(ctx, &count) != NULL && count == 1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	/* A truncated table, no entry point, or no device leaves the context empty. */
+	CHECK(write_file(path, image, 0x12000 + 4) == 0);
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadPhysicalMemory(ctx, path, 0) == -1);
+	CHECK(lazybiosLoadPhysicalMemory(ctx, path, 0x200) == -1);
+	CHECK(lazybiosLoadPhysicalMemory(ctx, "lazybios_physmem_missing.bin", 0) == -1);
+	CHECK(ctx->DMIData->entry_data == NULL && ctx->DMIData->dmi_data == NULL);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	remove(path);
+	return 0;
+}
+#endif
+
+static int test_cache(void) {
+	const char* path = "lazybios_test.cache";
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+
+	/* Sparse handles, so the cached handle table is the hashed kind. */
+	const uint8_t table[] = {
+		17, 0x12, 0x00, 0xDA, 0x00, 0x10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		'A', '0', 0, 0,
+		16, 0x0F, 0x00, 0x10, 3, 3, 3, 0, 0, 0, 0, 0xFE, 0xFF, 2, 0,
+		0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosCacheStore(ctx, path) == -1);
+	CHECK(lazybiosLoadBorrowed(ctx, entry, sizeof(entry), table, sizeof(table), LAZYBIOS_LOAD_NO_INDEX, NULL, NULL) == 0);
+	CHECK(lazybiosCacheStore(ctx, path) == 0);
+	CHECK(ctx->DMIData->index == NULL);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosCacheLoad(ctx, path) == 0);
+	CHECK(ctx->DMIData->mapping != NULL && ctx->DMIData->entry_len == sizeof(entry));
+	CHECK(ctx->DMIData->dmi_len == sizeof(table) && memcmp(ctx->DMIData->dmi_data, table, sizeof(table)) == 0);
+	CHECK(ctx->DMIData->index != NULL && ctx->DMIData->index->borrowed);
+	CHECK(ctx->DMIData->index->count == 2 && ctx->DMIData->index->handles_hashed);
+	CHECK(lazybiosIsVersionPlus(ctx->DMIData, 3, 9));
+	CHECK(lazybiosCacheLoad(ctx, path) == -1);
+
+	size_t count = 0;
+	lazybiosType17_t* devices = lazybiosCTXGetType17(ctx, &count);
+	CHECK(devices != NULL && count == 1 && strcmp(devices[0].device_locator, "A0") == 0);
+	lazybiosHandleRef_t ref;
+	CHECK(lazybiosFindByHandle(ctx, devices[0].physical_memory_array_handle, &ref) == 0);
+	CHECK(ref.type == SMBIOS_TYPE_PHYSICAL_MEMORY_ARRAY);
+	CHECK(lazybiosCacheStore(ctx, path) == 0);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	/* A changed table byte, an unknown version or a truncated file is not trusted. */
+	FILE* f = fopen(path, "rb");
+	CHECK(f != NULL);
+	uint8_t image[4096];
+	size_t len = fread(image, 1, sizeof(image), f);
+	fclose(f);
+	CHECK(len > sizeof(table) && len < sizeof(image));
+
+	uint8_t* located = NULL;
+	for (size_t i = 0; i + sizeof(table) <= len && !located; i++)
+		if (memcmp(image + i, table, sizeof(table)) == 0) located = image + i;
+	CHECK(located != NULL);
+
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	located[18] = 'B';
+	CHECK(write_file(path, image, len) == 0);
+	CHECK(lazybiosCacheLoad(ctx, path) == -1);
+	located[18] = 'A';
+	image[8]++;
+	CHECK(write_file(path, image, len) == 0);
+	CHECK(lazybiosCacheLoad(ctx, path) == -1);
+	image[8]--;
+	CHECK(write_file(path, image, len - 8) == 0);
+	CHECK(lazybiosCacheLoad(ctx, path) == -1);
+	CHECK(lazybiosCacheLoad(ctx, "lazybios_missing.cache") == -1);
+	CHECK(ctx->DMIData->entry_data == NULL && ctx->DMIData->dmi_data == NULL);
+
+	CHECK(write_file(path, image, len) == 0);
+	CHECK(lazybiosCacheLoad(ctx, path) == 0);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	remove(path);
+	return 0;
+}
+
+static int test_fingerprint(void) {
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 9, 0);
+	uint8_t table[] = {
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+
+	uint8_t first[LAZYBIOS_FINGERPRINT_SIZE];
+	uint8_t again[LAZYBIOS_FINGERPRINT_SIZE];
+	uint8_t edited[LAZYBIOS_FINGERPRINT_SIZE];
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosFingerprint(ctx, first) == -1);
+	CHECK(lazybiosLoadRawBuffers(ctx, entry, sizeof(entry), table, sizeof(table)) == 0);
+	CHECK(lazybiosFingerprint(ctx, first) == 0);
+	CHECK(lazybiosFingerprint(NULL, again) == -1);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadBorrowed(ctx, entry, sizeof(entry), table, sizeof(table), 0, NULL, NULL) == 0);
+	CHECK(lazybiosFingerprint(ctx, again) == 0);
+	CHECK(memcmp(first, again, sizeof(first)) == 0);
+	table[4] = 1;
+	CHECK(lazybiosFingerprint(ctx, edited) == 0);
+	CHECK(lazybiosCleanup(ctx) == 0);
+
+	/* A table edit changes the table half only; the entry-point half is what the cheap check compares. */
+	CHECK(memcmp(first, edited, 16) != 0);
+	CHECK(memcmp(first + 16, edited + 16, 16) == 0);
+	CHECK(lazybiosFingerprintChanged(NULL) == -1);
+
+#if defined(OS_LINUX)
+	const char* entry_path = "lazybios_fingerprint_entry.bin";
+	CHECK(write_file(entry_path, entry, sizeof(entry)) == 0);
+	CHECK(lazybiosLinuxEntryChanged(first, entry_path) == 0);
+	make_entry3(entry, 3, 8, 0);
+	CHECK(write_file(entry_path, entry, sizeof(entry)) == 0);
+	CHECK(lazybiosLinuxEntryChanged(first, entry_path) == 1);
+	CHECK(lazybiosLinuxEntryChanged(first, "lazybios_fingerprint_missing.bin") == -1);
+	remove(entry_path);
+#endif
+	return 0;
+}
+
+typedef struct {
+	unsigned char visits[64];
+	unsigned char loaded[64];
+	size_t stop_after;
+} batch_record;
+
+static int record_batch(lazybiosCTX_t* ctx, size_t index, const char* path, void* user) {
+	batch_record* record = user;
+	(void)path;
+	record->visits[index]++;
+	size_t count = 0;
+	record->loaded[index] = ctx && lazybiosCTXGetType32(ctx, &count) != NULL && count == 1;
+	return record->stop_after != 0;
+}
+
+static int test_batch_load(void) {
+	const char* merged_path = "lazybios_batch_merged.bin";
+	const char* missing_path = "lazybios_batch_missing.bin";
+	const uint8_t table[] = {
+		32, 0x0B, 0x20, 0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		127, 4, 0xFF, 0xFF, 0, 0
+	};
+	uint8_t merged[32 + sizeof(table)] = {0};
+	make_entry3(merged, 3, 9, 0);
+	put_u32_le(merged + SMBIOS3_TABLE_MAX_SIZE_OFFSET, (uint32_t)sizeof(table));
+	put_u64_le(merged + SMBIOS3_TABLE_ADDRESS_OFFSET, 32);
+	set_checksum(merged, 0, SMBIOS3_ENTRY_POINT_LENGTH, SMBIOS3_CHECKSUM_OFFSET);
+	memcpy(merged + 32, table, sizeof(table));
+	CHECK(write_file(merged_path, merged, sizeof(merged)) == 0);
+
+	/* A reset context loads again and keeps its parse arena. */
+	lazybiosCTX_t* ctx = lazybiosCTXNew();
+	CHECK(ctx != NULL);
+	CHECK(lazybiosLoadDump(ctx, merged_path) == 0);
+	CHECK(lazybiosParseAll(ctx, 0) == 0);
+	lazybiosArena_t* arena = ctx->arena;
+	CHECK(arena != NULL);
+	CHECK(lazybiosCTXReset(ctx) == 0);
+	CHECK(ctx->DMIData->dmi_data == NULL && ctx->DMIData->index == NULL && ctx->Type32 == NULL);
+	CHECK(ctx->arena == arena);
+	CHECK(lazybiosLoadDump(ctx, missing_path) == -1);
+	CHECK(lazybiosCTXReset(ctx) == 0);
+	CHECK(lazybiosLoadDump(ctx, merged_path) == 0);
+	size_t count = 0;
+	const lazybiosType32_t* boot = lazybiosCTXGetType32(ctx, &count);
+	CHECK(boot != NULL && count == 1 && lazybiosArenaOwns(arena, boot));
+	CHECK(lazybiosCleanup(ctx) == 0);
+	CHECK(lazybiosCTXReset(NULL) == -1);
+
+#if !defined(_WIN32)
+	/* Both directory layouts of the test corpus. */
+	CHECK(mkdir("lazybios_batch_pair", 0755) == 0 || errno == EEXIST);
+	CHECK(write_file("lazybios_batch_pair/smbios_entry_point", merged, SMBIOS3_ENTRY_POINT_LENGTH) == 0);
+	CHECK(write_file("lazybios_batch_pair/DMI", table, sizeof(table)) == 0);
+	CHECK(mkdir("lazybios_batch_bin", 0755) == 0 || errno == EEXIST);
+	CHECK(write_file("lazybios_batch_bin/lazybios_batch_bin.bin", merged, sizeof(merged)) == 0);
+	/* A table without its entry point is not a pair, so the merged file is still found. */
+	CHECK(write_file("lazybios_batch_bin/DMI", table, sizeof(table)) == 0);
+	const char* layouts[] = { merged_path, "lazybios_batch_pair", "lazybios_batch_bin/", missing_path };
+#else
+	const char* layouts[] = { merged_path, missing_path };
+#endif
+	const size_t layout_count = sizeof(layouts) / sizeof(layouts[0]);
+
+	const char* paths[64];
+	for (size_t i = 0; i < 64; i++) paths[i] = layouts[i % layout_count];
+
+	batch_record record;
+	memset(&record, 0, sizeof(record));
+	CHECK(lazybiosBatchLoad(paths, 64, 4, record_batch, &record) == 0);
+	for (size_t i = 0; i < 64; i++) {
+		CHECK(record.visits[i] == 1);
+		CHECK(record.loaded[i] == (paths[i] != missing_path));
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.stop_after = 1;
+	CHECK(lazybiosBatchLoad(paths, 64, 1, record_batch, &record) == 0);
+	CHECK(record.visits[0] == 1 && record.visits[1] == 0);
+
+	CHECK(lazybiosBatchLoad(paths, 0, 4, record_batch, &record) == 0);
+
+#if !defined(_WIN32)
+	/* Custom global hooks keep every load on the calling thread. */
+	owner_hooks hooks;
+	owner_hooks_init(&hooks);
+	memset(&record, 0, sizeof(record));
+	CHECK(lazybiosSetAllocator(NULL, owner_alloc, owner_free, &hooks) == 0);
+	CHECK(lazybiosBatchLoad(paths, 64, 4, record_batch, &record) == 0);
+	CHECK(lazybiosSetAllocator(NULL, NULL, NULL, NULL) == 0);
+	CHECK(hooks.calls > 0 && hooks.foreign == 0);
+	for (size_t i = 0; i < 64; i++) CHECK(record.visits[i] == 1);
+#endif
+	CHECK(lazybiosBatchLoad(paths, 64, 4, NULL, &record) == -1);
+	CHECK(lazybiosBatchLoad(NULL, 1, 4, record_batch, &record) == -1);
+
+	/* The bulk loader finds the same layouts, through io_uring or the pool. */
+	memset(&record, 0, sizeof(record));
+	CHECK(lazybiosBulkLoad(paths, 64, 5, record_batch, &record) == 0);
+	for (size_t i = 0; i < 64; i++) {
+		CHECK(record.visits[i] == 1);
+		CHECK(record.loaded[i] == (paths[i] != missing_path));
+	}
+	CHECK(lazybiosBulkLoad(paths, 64, 5, NULL, &record) == -1);
+
+#if defined(OS_LINUX) && defined(LAZYBIOS_HAVE_IO_URING)
+	/* Kernels that refuse io_uring report 1, which is what sends lazybiosBulkLoad() to the pool. */
+	memset(&record, 0, sizeof(record));
+	int uring = lazybiosBulkLoadUring(paths, 64, 3, record_batch, &record);
+	CHECK(uring == 0 || uring == 1);
+	for (size_t i = 0; uring == 0 && i < 64; i++) {
+		CHECK(record.visits[i] == 1);
+		CHECK(record.loaded[i] == (paths[i] != missing_path));
+	}
+
+	memset(&record, 0, sizeof(record));
+	record.stop_after = 1;
+	uring = lazybiosBulkLoadUring(paths, 64, 1, record_batch, &record);
+	CHECK(uring == 1 || (uring == 0 && record.visits[0] == 1 && record.visits[1] == 0));
+#endif
+
+	remove(merged_path);
+#if !defined(_WIN32)
+	remove("lazybios_batch_pair/smbios_entry_point");
+	remove("lazybios_batch_pair/DMI");
+	remove("lazybios_batch_pair");
+	remove("lazybios_batch_bin/lazybios_batch_bin.bin");
+	remove("lazybios_batch_bin/DMI");
+	remove("lazybios_batch_bin");
+#endif
+	return 0;
+}
+
+static int test_parallel_parse(void) {
+	enum { PAIRS = 320 };
+	const size_t table_size = PAIRS * (0x12 + 12 + 11 + 8) + 6;
+	uint8_t* table = calloc(1, table_size);
+	CHECK(table != NULL);
+
+	/* Type 17 records carry strings and Type 14 records nested arrays, from the workers' arenas. */
+	size_t n = 0;
+	for (unsigned i = 0; i < PAIRS; i++) {
+		uint8_t* memory = table + n;
+		memory[0] = 17;
+		memory[1] = 0x12;
+		put_u16_le(memory + 2, (uint16_t)(2 * i));
+		memory[0x10] = 1;
+		n += 0x12;
+		n += (size_t)sprintf((char*)table + n, "DIMM%u", i) + 2;
+
+		uint8_t* group = table + n;
+		group[0] = 14;
+		group[1] = 11;
+		put_u16_le(group + 2, (uint16_t)(2 * i + 1));
+		group[5] = 17;
+		put_u16_le(group + 6, (uint16_t)(2 * i));
+		group[8] = 17;
+		put_u16_le(group + 9, (uint16_t)i);
+		n += 11 + 2;
+	}
+	const uint8_t end[] = { 127, 4, 0xFF, 0xFF, 0, 0 };
+	memcpy(table + n, end, sizeof(end));
+	n += sizeof(end);
+
+	uint8_t entry[SMBIOS3_ENTRY_POINT_LENGTH];
+	make_entry3(entry, 3, 7, 0);
+	lazybiosCTX_t* serial = lazybiosCTXNew();
+	lazybiosCTX_t* parallel = lazybiosCTXNew();
+	CHECK(serial != NULL && parallel != NULL);
+	CHECK(lazybiosLoadBorrowed(serial, entry, sizeof(entry), table, n, 0, NULL, NULL) == 0);
+	CHECK(lazybiosLoadBorrowed(parallel, entry, sizeof(entry), table, n, 0, NULL, NULL) == 0);
+
+	/* A table this small stays on the calling thread even when asked; the pool is forced below. */
+	CHECK(2 * PAIRS < LAZYBIOS_PARSE_PARALLEL_MIN_STRUCTURES);
+	CHECK(lazybiosParseAll(serial, LAZYBIOS_PARSE_PARALLEL) == 0);
+	CHECK(lazybiosParseAllThreads(parallel, 0, 4) == 0);
+
+	CHECK(serial->type17_count == PAIRS && parallel->type17_count == PAIRS);
+	CHECK(memcmp(serial->Type17, parallel->Type17, PAIRS * sizeof(lazybiosType17_t)) == 0);
+	CHECK(strcmp(parallel->Type17[PAIRS - 1].device_locator, "DIMM319") == 0);
+	CHECK(serial->type14_count == PAIRS && parallel->type14_count == PAIRS);
+	for (size_t i = 0; i < PAIRS; i++) {
+		const lazybiosType14_t* a = &serial->Type14[i];
+		const lazybiosType14_t* b = &parallel->Type14[i];
+		CHECK(a->handle == b->handle && a->item_count == 2 && b->item_count == 2);
+		CHECK(memcmp(a->items, b->items, 2 * sizeof(*a->items)) == 0);
+		CHECK(lazybiosArenaOwns(parallel->arena, b->items));
+	}
+	CHECK(parallel->Type14[PAIRS - 1].items[1].item_handle == PAIRS - 1);
+	CHECK(lazybiosCleanup(serial) == 0);
+	CHECK(lazybiosCleanup(parallel) == 0);
+
+	/* Without an index there is no way to split the work, so the table is walked. */
+	parallel = lazybiosCTXNew();
+	CHECK(parallel != NULL);
+	CHECK(lazybiosLoadBorrowed(parallel, entry, sizeof(entry), table, n, LAZYBIOS_LOAD_NO_INDEX, NULL, NULL) == 0);
+	CHECK(lazybiosParseAllThreads(parallel, 0, 4) == 0);
+	CHECK(parallel->type17_count == PAIRS && parallel->type14_count == PAIRS);
+	CHECK(lazybiosCleanup(parallel) == 0);
+
+#if !defined(_WIN32)
+	/* Custom hooks keep the parse on this thread: it makes exactly the calls a serial one does. */
+	owner_hooks hooks[2];
+	for (unsigned threads = 1; threads <= 4; threads += 3) {
+		owner_hooks* current = &hooks[threads / 4];
+		owner_hooks_init(current);
+		parallel = lazybiosCTXNew();
+		CHECK(parallel != NULL);
+		CHECK(lazybiosSetAllocator(parallel, owner_alloc, owner_free, current) == 0);
+		CHECK(lazybiosLoadBorrowed(parallel, entry, sizeof(entry), table, n, 0, NULL, NULL) == 0);
+		CHECK(lazybiosParseAllThreads(parallel, 0, threads) == 0);
+		CHECK(parallel->type17_count == PAIRS && parallel->type14_count == PAIRS);
+		CHECK(lazybiosCleanup(parallel) == 0);
+		CHECK(current->foreign == 0);
+	}
+	CHECK(hooks[0].calls == hooks[1].calls);
+#endif
+	free(table);
+	return 0;
+}
+
 static int test_single_file_layouts(void) {
 	const uint8_t table[] = {
 		127, 4, 0x34, 0x12, 0, 0
@@ -567,10 +1967,37 @@ int main(void) {
 		test_traversal_helpers() != 0 ||
 		test_type28_signed_temperature() != 0 ||
 		test_type0_type1_counts() != 0 ||
+		test_structure_index() != 0 ||
+		test_string_slots() != 0 ||
+		test_find_by_handle() != 0 ||
+		test_double_nul_scan() != 0 ||
+		test_parse_all() != 0 ||
+		test_ctx_get_type() != 0 ||
+		test_arena() != 0 ||
+		test_byte_views() != 0 ||
+		test_iterator() != 0 ||
+		test_for_each() != 0 ||
+		test_stream() != 0 ||
+		test_columns() != 0 ||
+		test_allocator_hooks() != 0 ||
+		test_snapshot() != 0 ||
+		test_field_descriptors() != 0 ||
 		test_numeric_decoders() != 0 ||
 		test_backend_transformations() != 0 ||
 		test_backend_enum_values() != 0 ||
 		test_single_file_layouts() != 0 ||
+		test_mapped_files() != 0 ||
+		test_borrowed_load() != 0 ||
+#if defined(OS_LINUX)
+		test_linux_sysfs_loader() != 0 ||
+#endif
+#if !defined(_WIN32)
+		test_physical_memory_loader() != 0 ||
+#endif
+		test_cache() != 0 ||
+		test_fingerprint() != 0 ||
+		test_batch_load() != 0 ||
+		test_parallel_parse() != 0 ||
 		test_null_free_contracts() != 0)
 		return EXIT_FAILURE;
 
@@ -55,9 +55,9 @@ static void printType0(lazybiosCTX_t* ctx) {
 		}
 
 		if (lazybiosIsVersionPlus(ctx->DMIData, 2, 1)) {
-			if (ctx->Type0->firmware_char_ext_bytes_count >= 1 && ctx->Type0->firmware_char_ext_bytes) {
+			if (ctx->Type0->firmware_char_ext_bytes.len >= 1) {
 				char buf[LAZYBIOS_DECODER_BUF_SIZE];
-				lazybiosType0CharacteristicsExtByte1Str(ctx->Type0->firmware_char_ext_bytes[0], buf, sizeof(buf));
+				lazybiosType0CharacteristicsExtByte1Str(ctx->Type0->firmware_char_ext_bytes.ptr[0], buf, sizeof(buf));
 				printf("Firmware Characteristics Extension Bytes 1: %s\n", buf);
 			} else {
 				printf("Firmware Characteristics Extension Bytes 1: Not Present\n");
@@ -68,9 +68,9 @@ static void printType0(lazybiosCTX_t* ctx) {
 		}
 
 		if (lazybiosIsVersionPlus(ctx->DMIData, 2, 3)) {
-			if (ctx->Type0->firmware_char_ext_bytes_count >= 2 && ctx->Type0->firmware_char_ext_bytes) {
+			if (ctx->Type0->firmware_char_ext_bytes.len >= 2) {
 				char buf[LAZYBIOS_DECODER_BUF_SIZE];
-				lazybiosType0CharacteristicsExtByte2Str(ctx->Type0->firmware_char_ext_bytes[1], buf, sizeof(buf));
+				lazybiosType0CharacteristicsExtByte2Str(ctx->Type0->firmware_char_ext_bytes.ptr[1], buf, sizeof(buf));
 				printf("Firmware Characteristics Extension Bytes 2: %s\n", buf);
 			} else {
 				printf("Firmware Characteristics Extension Bytes 2: Not Present\n");
@@ -2743,12 +2743,12 @@ static void printType32(lazybiosCTX_t* ctx) {
 
 			if (LAZYBIOS_FIELD_STATUS(type32, additional_data) != LAZYBIOS_FIELD_PRESENT) {
 				printf("Additional Data: Not Present\n");
-			} else if (type32->additional_data_size == 0) {
+			} else if (type32->additional_data.len == 0) {
 				printf("Additional Data: None\n");
 			} else {
 				printf("Additional Data:");
-				for (size_t j = 0; j < type32->additional_data_size; j++) {
-					printf(" %02X", type32->additional_data[j]);
+				for (size_t j = 0; j < type32->additional_data.len; j++) {
+					printf(" %02X", type32->additional_data.ptr[j]);
 				}
 				printf("\n");
 			}
@@ -3215,14 +3215,14 @@ static void printType40(lazybiosCTX_t* ctx) {
 					printf("Entry Length: %hhu bytes\n", entry->entry_length);
 					printf("Referenced Handle: 0x%04hX\n", entry->referenced_handle);
 					printf("Referenced Offset: 0x%02hhX\n", entry->referenced_offset);
-					if (entry->field_status.string != LAZYBIOS_FIELD_PRESENT) {
+					if (LAZYBIOS_FIELD_STATUS(entry, string) != LAZYBIOS_FIELD_PRESENT) {
 						printf("String: Not Present\n");
 					} else {
 						printf("String: %s\n", entry->string ? entry->string : "Not Specified");
 					}
 					printf("Value:");
-					for (size_t k = 0; k < entry->value_length; k++) {
-						printf(" %02hhX", entry->value[k]);
+					for (size_t k = 0; k < entry->value.len; k++) {
+						printf(" %02hhX", entry->value.ptr[k]);
 					}
 					printf("\n");
 				}
@@ -3319,9 +3319,9 @@ static void printType42(lazybiosCTX_t* ctx) {
 			if (LAZYBIOS_FIELD_STATUS(type42, interface_type_specific_data) != LAZYBIOS_FIELD_PRESENT) {
 				printf("Interface Type Specific Data: Not Present\n");
 			} else {
-				printf("Interface Type Specific Data (%zu bytes):", type42->interface_type_specific_data_size);
-				for (size_t j = 0; j < type42->interface_type_specific_data_size; j++) {
-					printf(" %02hhX", type42->interface_type_specific_data[j]);
+				printf("Interface Type Specific Data (%zu bytes):", type42->interface_type_specific_data.len);
+				for (size_t j = 0; j < type42->interface_type_specific_data.len; j++) {
+					printf(" %02hhX", type42->interface_type_specific_data.ptr[j]);
 				}
 				printf("\n");
 			}
@@ -3342,8 +3342,8 @@ static void printType42(lazybiosCTX_t* ctx) {
 						lazybiosType42ProtocolTypeStr(protocol->protocol_type), protocol->protocol_type);
 					printf("Protocol Type Specific Data (%hhu bytes):",
 						protocol->protocol_type_specific_data_length);
-					for (size_t k = 0; k < protocol->protocol_type_specific_data_length; k++) {
-						printf(" %02hhX", protocol->protocol_type_specific_data[k]);
+					for (size_t k = 0; k < protocol->protocol_type_specific_data.len; k++) {
+						printf(" %02hhX", protocol->protocol_type_specific_data.ptr[k]);
 					}
 					printf("\n");
 				}
@@ -3451,8 +3451,8 @@ static void printType44(lazybiosCTX_t* ctx) {
 				printf("Processor-specific Data: Not Present\n");
 			} else {
 				printf("Processor-specific Data:");
-				for (size_t j = 0; j < type44->block_length; j++) {
-					printf(" %02hhX", type44->processor_specific_data[j]);
+				for (size_t j = 0; j < type44->processor_specific_data.len; j++) {
+					printf(" %02hhX", type44->processor_specific_data.ptr[j]);
 				}
 				printf("\n");
 			}
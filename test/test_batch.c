@@ -0,0 +1,150 @@
+/*
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This file is part of lazybios.
+ *
+ * lazybios is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * lazybios is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lazybios. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lazybios/lazybios.h"
+
+typedef struct {
+	char** paths;
+	size_t count;
+	size_t capacity;
+} path_list;
+
+static int add_path(path_list* list, const char* path, size_t len) {
+	if (list->count == list->capacity) {
+		size_t capacity = list->capacity ? list->capacity * 2 : 256;
+		char** grown = realloc(list->paths, capacity * sizeof(*grown));
+		if (!grown) return -1;
+		list->paths = grown;
+		list->capacity = capacity;
+	}
+
+	char* copy = malloc(len + 1);
+	if (!copy) return -1;
+	memcpy(copy, path, len);
+	copy[len] = '\0';
+	list->paths[list->count++] = copy;
+	return 0;
+}
+
+// Reads one path per line; blank lines are skipped.
+static int read_list(path_list* list, const char* list_path) {
+	FILE* f = strcmp(list_path, "-") == 0 ? stdin : fopen(list_path, "r");
+	if (!f) {
+		fprintf(stderr, "Error: cannot open list '%s'\n", list_path);
+		return -1;
+	}
+
+	char line[4096];
+	int result = 0;
+	while (fgets(line, sizeof(line), f)) {
+		size_t len = strcspn(line, "\r\n");
+		if (len == 0) continue;
+		if (add_path(list, line, len) != 0) {
+			result = -1;
+			break;
+		}
+	}
+	if (f != stdin) fclose(f);
+	return result;
+}
+
+/*
+ * Every dump is parsed in full, so a run also checks that the corpus decodes.
+ * Each index is written by exactly one worker, so the status array needs no lock.
+ */
+static int visit_dump(lazybiosCTX_t* ctx, size_t index, const char* path, void* user) {
+	unsigned char* failed = user;
+	uint8_t fingerprint[LAZYBIOS_FINGERPRINT_SIZE];
+	if (!ctx || lazybiosParseAll(ctx, LAZYBIOS_PARSE_OEM) != 0 || lazybiosFingerprint(ctx, fingerprint) != 0) {
+		failed[index] = 1;
+		fprintf(stderr, "Failed to load %s\n", path);
+		return 0;
+	}
+
+	// One write per line keeps lines from different workers whole.
+	char line[2 * 16 + 64 + 4096];
+	int n = 0;
+	for (size_t i = 0; i < 16; i++) n += snprintf(line + n, sizeof(line) - (size_t)n, "%02x", fingerprint[i]);
+	snprintf(line + n, sizeof(line) - (size_t)n, "\t%zu\t%s\n", ctx->DMIData->dmi_len, path);
+	fputs(line, stdout);
+	return 0;
+}
+
+static void print_usage(const char* progname) {
+	printf("Usage: %s [options] <dump>...\n", progname);
+	printf("Loads and parses every dump, printing the table fingerprint, table length and path of each.\n");
+	printf("A dump is a merged .bin file, a directory with smbios_entry_point and DMI, or a directory test-N with test-N.bin.\n");
+	printf("Options:\n");
+	printf("  --help                      Show this help message\n");
+	printf("  --threads <n>               Number of worker threads, 0 (the default) for one per CPU\n");
+	printf("  --list <file>               Also read dump paths from <file>, one per line, or from stdin if <file> is -\n");
+	printf("  --bulk <depth>              Load with lazybiosBulkLoad() keeping <depth> dumps in flight, 0 for the default\n");
+}
+
+int main(int argc, char* argv[]) {
+	path_list list = {0};
+	unsigned threads = 0;
+	int bulk = 0;
+	unsigned depth = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--help") == 0) {
+			print_usage(argv[0]);
+			return 0;
+		} else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threads = (unsigned)strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--bulk") == 0 && i + 1 < argc) {
+			bulk = 1;
+			depth = (unsigned)strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--list") == 0 && i + 1 < argc) {
+			if (read_list(&list, argv[++i]) != 0) return 1;
+		} else if (argv[i][0] == '-' && argv[i][1] == '-') {
+			fprintf(stderr, "Error: Unknown or incomplete argument '%s'\n", argv[i]);
+			print_usage(argv[0]);
+			return 1;
+		} else if (add_path(&list, argv[i], strlen(argv[i])) != 0) {
+			return 1;
+		}
+	}
+
+	if (list.count == 0) {
+		print_usage(argv[0]);
+		return 1;
+	}
+
+	unsigned char* failed = calloc(list.count, 1);
+	int status = 1;
+	const char* const* paths = (const char* const*)list.paths;
+	int loaded = !failed ? -1
+		: bulk ? lazybiosBulkLoad(paths, list.count, depth, visit_dump, failed)
+		: lazybiosBatchLoad(paths, list.count, threads, visit_dump, failed);
+	if (loaded == 0) {
+		size_t failures = 0;
+		for (size_t i = 0; i < list.count; i++) failures += failed[i];
+		if (failures) fprintf(stderr, "%zu of %zu dumps failed\n", failures, list.count);
+		status = failures ? 1 : 0;
+	}
+
+	for (size_t i = 0; i < list.count; i++) free(list.paths[i]);
+	free(list.paths);
+	free(failed);
+	return status;
+}